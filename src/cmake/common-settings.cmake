@@ -182,6 +182,13 @@ endif()
 # Thread safety
 add_definitions("-D_REENTRANT -DXUSE_MTSAFE_API -DCURL_STATICLIB")
 
+# Output variables
+option(ANTARES_COMPACT_INTERMEDIATE_VALUES "Keep the hourly values of the output variables in single precision" OFF)
+if (ANTARES_COMPACT_INTERMEDIATE_VALUES)
+	message(STATUS "{antares} The hourly values of the output variables are kept in single precision")
+	add_definitions("-DANTARES_COMPACT_INTERMEDIATE_VALUES")
+endif()
+
 
 # ICC Optimizations
 if (ICC)
@@ -225,6 +225,8 @@ double DeltaXSurLaVariableHorsBase;
 int   VariableSortante;
 int   SortSurXmaxOuSurXmin;
 int   NombreDeChangementsDeBase; 
+int   NombreDIterationsDePhase1; /* Cumul sur l'appel en cours, y compris les retours en phase 1 */
+int   NombreDeFactorisations;    /* Nombre de (re)factorisations de la base sur l'appel en cours */
 char   StrongBranchingEnCours;
 char   PremierSimplexe;
 char   BBarreAEteCalculeParMiseAJour; /* Vaut OUI_SPX ou NON_SPX */  
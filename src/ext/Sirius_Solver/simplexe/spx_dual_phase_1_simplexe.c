@@ -73,6 +73,7 @@ while ( 1 ) {
 
   Debut: 
   Spx->Iteration++;
+  Spx->NombreDIterationsDePhase1++;
 	Spx->FaireChangementDeBase = OUI_SPX;
 	Spx->NbBoundFlip = 0;
 
@@ -138,6 +138,8 @@ printf("------- Factorisation de la base iteration %d ------ CoefficientPourLaVa
         Spx->Iteration,Spx->CoefficientPourLaValeurDePerturbationDeCoutAPosteriori);
 */
 
+Spx->NombreDeFactorisations++;
+
 OnRetesteSiPivotNul          = OUI_SPX;
 SeuilPivotMarkowitzParDefaut = OUI_LU;
 RestaurerAdmissibiliteDuale  = NON_SPX;
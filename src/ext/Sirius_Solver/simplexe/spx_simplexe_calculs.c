@@ -103,6 +103,9 @@ Spx->AffichageDesTraces = Probleme->AffichageDesTraces;
 
 Spx->NbCycles = 0;
 
+Spx->NombreDIterationsDePhase1 = 0;
+Spx->NombreDeFactorisations    = 0;
+
 Spx->TypeDePricing = (char) Probleme->TypeDePricing;
 if ( Spx->TypeDePricing != PRICING_DANTZIG && Spx->TypeDePricing != PRICING_STEEPEST_EDGE ) {
   printf("TypeDePricing pas correctement renseigne\n");
@@ -0,0 +1,150 @@
+/*
+** Copyright 2007-2018 RTE
+** Authors: Antares_Simulator Team
+**
+** This file is part of Antares_Simulator.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** There are special exceptions to the terms and conditions of the
+** license as they are applied to this software. View the full text of
+** the exceptions in file COPYING.txt in the directory of this software
+** distribution
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with Antares_Simulator. If not, see <http://www.gnu.org/licenses/>.
+**
+** SPDX-License-Identifier: licenceRef-GPL3_WITH_RTE-Exceptions
+*/
+#ifndef __ANTARES_LIBS_ARRAY_FACTORIZATION_CACHE_H__
+# define __ANTARES_LIBS_ARRAY_FACTORIZATION_CACHE_H__
+
+# include <yuni/yuni.h>
+# include <yuni/core/noncopyable.h>
+# include <yuni/thread/mutex.h>
+# include "matrix.h"
+# include <map>
+
+
+namespace Antares
+{
+
+	/*!
+	** \brief Factorization of a correlation matrix
+	**
+	** Only the lower triangles (diagonal included) of the matrices are relevant.
+	*/
+	template<class T>
+	class Factorization final : private Yuni::NonCopyable<Factorization<T> >
+	{
+	public:
+		//! Default constructor
+		Factorization() :
+			rho(T(1))
+		{}
+
+	public:
+		//! Lower triangular matrix L such that L.Lt = B
+		Matrix<T> L;
+		//! The correlation matrix actually factorized (empty when not needed)
+		Matrix<T> B;
+		//! The ratio the source matrix has been shrunk with (see MatrixDPMake())
+		T rho;
+
+	}; // class Factorization
+
+
+
+	/*!
+	** \brief Cache of the factorizations of the correlation matrices
+	**
+	** The correlation matrices given to the time-series generators do not
+	** change during a run. Their factorizations are kept here, so that they
+	** are not computed again at each refresh of the time-series.
+	** A factorization is identified by a checksum of the matrices it has been
+	** computed from (see Checksum()).
+	**
+	** This class is thread-safe.
+	*/
+	class FactorizationCache final : private Yuni::NonCopyable<FactorizationCache>
+	{
+	public:
+		/*!
+		** \brief Add the lower triangle (diagonal included) of a square matrix to a checksum
+		**
+		** \param hash The checksum of the previous data, `MatrixCache::checksumOffsetBasis`
+		**   for the first one
+		** \param matrix The matrix (`matrix[i][j]`, with j <= i)
+		** \param size The size of the matrix
+		*/
+		template<class T, class U>
+		static Yuni::uint64 Checksum(Yuni::uint64 hash, U& matrix, uint size);
+
+	public:
+		//! \name Constructor & Destructor
+		//@{
+		//! Default constructor
+		FactorizationCache();
+		//! Destructor
+		~FactorizationCache();
+		//@}
+
+		/*!
+		** \brief Find the factorization of a given key
+		**
+		** \return The factorization, null if not found
+		*/
+		template<class T> const Factorization<T>* find(Yuni::uint64 key) const;
+
+		/*!
+		** \brief Add a new factorization
+		**
+		** The cache takes the ownership of the factorization. If a factorization
+		** has already been added with the same key in the meantime, the given one
+		** is deleted and the existing one is returned.
+		*/
+		template<class T> const Factorization<T>* add(Yuni::uint64 key, Factorization<T>* factorization);
+
+		/*!
+		** \brief Remove all factorizations
+		**
+		** \warning No factorization must be in use
+		*/
+		void clear();
+
+	private:
+		typedef std::map<Yuni::uint64, Factorization<float>*>  FloatMap;
+		typedef std::map<Yuni::uint64, Factorization<double>*> DoubleMap;
+
+		FloatMap&  entries(const float*)        {return pFloat;}
+		DoubleMap& entries(const double*)       {return pDouble;}
+		const FloatMap&  entries(const float*)  const {return pFloat;}
+		const DoubleMap& entries(const double*) const {return pDouble;}
+
+	private:
+		//! Factorizations in simple precision
+		FloatMap pFloat;
+		//! Factorizations in double precision
+		DoubleMap pDouble;
+		//! Mutex
+		mutable Yuni::Mutex pMutex;
+
+	}; // class FactorizationCache
+
+
+
+
+
+} // namespace Antares
+
+# include "factorization-cache.hxx"
+
+#endif // __ANTARES_LIBS_ARRAY_FACTORIZATION_CACHE_H__
@@ -0,0 +1,83 @@
+/*
+** Copyright 2007-2018 RTE
+** Authors: Antares_Simulator Team
+**
+** This file is part of Antares_Simulator.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** There are special exceptions to the terms and conditions of the
+** license as they are applied to this software. View the full text of
+** the exceptions in file COPYING.txt in the directory of this software
+** distribution
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with Antares_Simulator. If not, see <http://www.gnu.org/licenses/>.
+**
+** SPDX-License-Identifier: licenceRef-GPL3_WITH_RTE-Exceptions
+*/
+#ifndef __ANTARES_LIBS_ARRAY_FACTORIZATION_CACHE_HXX__
+# define __ANTARES_LIBS_ARRAY_FACTORIZATION_CACHE_HXX__
+
+# include "matrix-cache.h"
+
+
+namespace Antares
+{
+
+	template<class T, class U>
+	Yuni::uint64 FactorizationCache::Checksum(Yuni::uint64 hash, U& matrix, uint size)
+	{
+		hash = MatrixCache::Checksum(hash, &size, sizeof(size));
+		for (uint i = 0; i != size; ++i)
+		{
+			auto& row = matrix[i];
+			for (uint j = 0; j <= i; ++j)
+			{
+				const T value = row[j];
+				hash = MatrixCache::Checksum(hash, &value, sizeof(T));
+			}
+		}
+		return hash;
+	}
+
+
+	template<class T>
+	inline const Factorization<T>* FactorizationCache::find(Yuni::uint64 key) const
+	{
+		Yuni::MutexLocker locker(pMutex);
+		auto& map = entries((const T*) nullptr);
+		auto it = map.find(key);
+		return (it != map.end()) ? it->second : nullptr;
+	}
+
+
+	template<class T>
+	const Factorization<T>* FactorizationCache::add(Yuni::uint64 key, Factorization<T>* factorization)
+	{
+		Yuni::MutexLocker locker(pMutex);
+		auto& map = entries((const T*) nullptr);
+		auto it = map.find(key);
+		if (it != map.end())
+		{
+			delete factorization;
+			return it->second;
+		}
+		map[key] = factorization;
+		return factorization;
+	}
+
+
+
+
+} // namespace Antares
+
+#endif // __ANTARES_LIBS_ARRAY_FACTORIZATION_CACHE_HXX__
@@ -0,0 +1,397 @@
+/*
+** Copyright 2007-2018 RTE
+** Authors: Antares_Simulator Team
+**
+** This file is part of Antares_Simulator.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** There are special exceptions to the terms and conditions of the
+** license as they are applied to this software. View the full text of
+** the exceptions in file COPYING.txt in the directory of this software
+** distribution
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with Antares_Simulator. If not, see <http://www.gnu.org/licenses/>.
+**
+** SPDX-License-Identifier: licenceRef-GPL3_WITH_RTE-Exceptions
+*/
+
+#include "matrix-cache.h"
+#include <yuni/io/file.h>
+#include <yuni/core/system/windows.hdr.h>
+#include <string.h>
+#ifndef YUNI_OS_WINDOWS
+# include <unistd.h>
+# include <fcntl.h>
+# include <sys/types.h>
+# include <sys/stat.h>
+# include <sys/mman.h>
+#else
+# include <yuni/core/string/wstring.h>
+#endif
+#include "../logs.h"
+
+
+using namespace Yuni;
+
+
+
+namespace Antares
+{
+namespace MatrixCache
+{
+
+	bool enabled = false;
+
+	const char* const extension = ".cache";
+
+	const uint64 checksumOffsetBasis = 14695981039346656037ULL;
+
+
+	uint64 Checksum(uint64 hash, const void* data, uint64 size)
+	{
+		enum : uint64 { prime = 1099511628211ULL };
+
+		auto* p = reinterpret_cast<const unsigned char*>(data);
+		for (; size >= sizeof(uint64); size -= sizeof(uint64), p += sizeof(uint64))
+		{
+			uint64 word;
+			memcpy(&word, p, sizeof(uint64));
+			hash = (hash ^ word) * prime;
+		}
+		for (; size != 0; --size, ++p)
+			hash = (hash ^ *p) * prime;
+		return hash;
+	}
+
+
+	namespace // anonymous
+	{
+
+		enum
+		{
+			//! Version of the layout of the cache files
+			formatVersion = 1,
+		};
+
+		//! Header of a cache file, the values follow, column by column
+		struct Header final
+		{
+			char   magic[8];
+			uint32 version;
+			uint32 typeID;
+			uint32 minWidth;
+			uint32 maxHeight;
+			uint32 options;
+			uint32 width;
+			uint32 height;
+			uint32 reserved;
+			uint64 sourceSize;
+			sint64 sourceTime;
+			uint64 checksum;
+		};
+
+		static_assert(sizeof(Header) == 64, "the values must remain aligned");
+
+		static const char magicNumber[8] = { 'A', 'N', 'T', 'M', 'T', 'X', 'C', '\0' };
+
+
+		static inline void CacheFilename(String& out, const AnyString& filename)
+		{
+			out.clear() << filename << extension;
+		}
+
+
+	} // anonymous namespace
+
+
+
+
+	Key::Key() :
+		typeID(0),
+		minWidth(0),
+		maxHeight(0),
+		options(0),
+		sourceSize(0),
+		sourceTime(0)
+	{}
+
+
+	bool Key::prepare(const AnyString& filename, uint typeID, uint minWidth, uint maxHeight, uint options)
+	{
+		this->typeID    = typeID;
+		this->minWidth  = minWidth;
+		this->maxHeight = maxHeight;
+		this->options   = options;
+		if (not IO::File::Size(filename, sourceSize))
+			return false;
+		sourceTime = IO::File::LastModificationTime(filename);
+		return (sourceTime != 0);
+	}
+
+
+
+
+	Reader::Reader() :
+		pData(nullptr),
+		pSize(0),
+		pColumnSize(0),
+		pWidth(0),
+		pHeight(0)
+		# ifdef YUNI_OS_WINDOWS
+		, pFileHandle(INVALID_HANDLE_VALUE),
+		pMappingHandle(nullptr)
+		# endif
+	{}
+
+
+	Reader::~Reader()
+	{
+		close();
+	}
+
+
+	void Reader::close()
+	{
+		# ifdef YUNI_OS_WINDOWS
+		if (pData)
+			UnmapViewOfFile(pData);
+		if (pMappingHandle)
+			CloseHandle(pMappingHandle);
+		if (pFileHandle != INVALID_HANDLE_VALUE)
+			CloseHandle(pFileHandle);
+		pMappingHandle = nullptr;
+		pFileHandle = INVALID_HANDLE_VALUE;
+		# else
+		if (pData)
+			munmap((void*) pData, (size_t) pSize);
+		# endif
+
+		pData = nullptr;
+		pSize = 0;
+		pColumnSize = 0;
+		pWidth  = 0;
+		pHeight = 0;
+	}
+
+
+	bool Reader::open(const AnyString& filename, const Key& key, uint sizeofT)
+	{
+		close();
+
+		String cacheFilename;
+		CacheFilename(cacheFilename, filename);
+
+		# ifdef YUNI_OS_WINDOWS
+		{
+			WString wfilename(cacheFilename);
+			if (wfilename.empty())
+				return false;
+			pFileHandle = CreateFileW(wfilename.c_str(), GENERIC_READ, FILE_SHARE_READ,
+				nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+			if (pFileHandle == INVALID_HANDLE_VALUE)
+				return false;
+
+			LARGE_INTEGER filesize;
+			if (not GetFileSizeEx(pFileHandle, &filesize) or (uint64) filesize.QuadPart < sizeof(Header))
+			{
+				close();
+				return false;
+			}
+			pSize = (uint64) filesize.QuadPart;
+
+			pMappingHandle = CreateFileMapping(pFileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			if (not pMappingHandle)
+			{
+				close();
+				return false;
+			}
+			pData = (const char*) MapViewOfFile(pMappingHandle, FILE_MAP_READ, 0, 0, 0);
+			if (not pData)
+			{
+				close();
+				return false;
+			}
+		}
+		# else
+		{
+			int fd = ::open(cacheFilename.c_str(), O_RDONLY);
+			if (fd == -1)
+				return false;
+
+			struct stat s;
+			if (::fstat(fd, &s) != 0 or (uint64) s.st_size < sizeof(Header))
+			{
+				::close(fd);
+				return false;
+			}
+			pSize = (uint64) s.st_size;
+
+			void* p = mmap(nullptr, (size_t) pSize, PROT_READ, MAP_PRIVATE, fd, 0);
+			// the mapping remains valid once the file descriptor is closed
+			::close(fd);
+			if (p == MAP_FAILED)
+			{
+				pSize = 0;
+				return false;
+			}
+			# ifdef MADV_SEQUENTIAL
+			madvise(p, (size_t) pSize, MADV_SEQUENTIAL);
+			# endif
+			pData = (const char*) p;
+		}
+		# endif
+
+		Header header;
+		memcpy(&header, pData, sizeof(Header));
+
+		if (0 != memcmp(header.magic, magicNumber, sizeof(magicNumber))
+			or header.version != (uint32) formatVersion
+			or header.typeID != key.typeID
+			or header.minWidth != key.minWidth
+			or header.maxHeight != key.maxHeight
+			or header.options != key.options
+			or header.sourceSize != key.sourceSize
+			or header.sourceTime != key.sourceTime)
+		{
+			close();
+			return false;
+		}
+
+		uint64 columnSize = (uint64) header.height * sizeofT;
+		if (pSize != sizeof(Header) + columnSize * header.width
+			or header.checksum != Checksum(checksumOffsetBasis, pData + sizeof(Header), pSize - sizeof(Header)))
+		{
+			logs.debug() << "  :: invalid cache " << cacheFilename;
+			close();
+			return false;
+		}
+
+		pColumnSize = columnSize;
+		pWidth  = header.width;
+		pHeight = header.height;
+		return true;
+	}
+
+
+	uint Reader::width() const
+	{
+		return pWidth;
+	}
+
+
+	uint Reader::height() const
+	{
+		return pHeight;
+	}
+
+
+	const void* Reader::column(uint x) const
+	{
+		assert(pData and x < pWidth);
+		return pData + sizeof(Header) + pColumnSize * x;
+	}
+
+
+	uint64 Reader::size() const
+	{
+		return pSize;
+	}
+
+
+
+
+	Writer::Writer(uint sizeofT, uint width, uint height) :
+		pSizeofT(sizeofT),
+		pWidth(width),
+		pHeight(height),
+		pColumnCount(0),
+		pChecksum(checksumOffsetBasis),
+		pValid(false)
+	{}
+
+
+	Writer::~Writer()
+	{
+		if (pFile.opened())
+		{
+			// The cache file is incomplete
+			pFile.close();
+			IO::File::Delete(pFilename);
+		}
+	}
+
+
+	bool Writer::open(const AnyString& filename)
+	{
+		CacheFilename(pFilename, filename);
+
+		// The header is written last, with its magic number
+		pValid = pFile.openRW(pFilename);
+		if (pValid)
+		{
+			char empty[sizeof(Header)];
+			memset(empty, 0, sizeof(empty));
+			pValid = (pFile.write((const char*) empty, sizeof(empty)) == sizeof(empty));
+		}
+		return pValid;
+	}
+
+
+	void Writer::column(const void* data)
+	{
+		assert(pColumnCount < pWidth);
+		if (pValid)
+		{
+			uint64 size = (uint64) pHeight * pSizeofT;
+			pChecksum = Checksum(pChecksum, data, size);
+			pValid = (pFile.write((const char*) data, size) == size);
+			++pColumnCount;
+		}
+	}
+
+
+	bool Writer::commit(const Key& key)
+	{
+		if (pValid and pColumnCount == pWidth)
+		{
+			Header header;
+			memset(&header, 0, sizeof(Header));
+			memcpy(header.magic, magicNumber, sizeof(magicNumber));
+			header.version    = (uint32) formatVersion;
+			header.typeID     = key.typeID;
+			header.minWidth   = key.minWidth;
+			header.maxHeight  = key.maxHeight;
+			header.options    = key.options;
+			header.width      = pWidth;
+			header.height     = pHeight;
+			header.sourceSize = key.sourceSize;
+			header.sourceTime = key.sourceTime;
+			header.checksum   = pChecksum;
+
+			if (pFile.flush() and pFile.seekFromBeginning(0)
+				and pFile.write((const char*) &header, sizeof(Header)) == sizeof(Header))
+			{
+				// Complete
+				if (pFile.close())
+					return true;
+			}
+		}
+		// The destructor will remove the incomplete file
+		return false;
+	}
+
+
+
+
+} // namespace MatrixCache
+} // namespace Antares
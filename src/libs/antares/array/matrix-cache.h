@@ -0,0 +1,251 @@
+/*
+** Copyright 2007-2018 RTE
+** Authors: Antares_Simulator Team
+**
+** This file is part of Antares_Simulator.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** There are special exceptions to the terms and conditions of the
+** license as they are applied to this software. View the full text of
+** the exceptions in file COPYING.txt in the directory of this software
+** distribution
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with Antares_Simulator. If not, see <http://www.gnu.org/licenses/>.
+**
+** SPDX-License-Identifier: licenceRef-GPL3_WITH_RTE-Exceptions
+*/
+#ifndef __ANTARES_LIBS_ARRAY_MATRIX_CACHE_H__
+# define __ANTARES_LIBS_ARRAY_MATRIX_CACHE_H__
+
+# include <yuni/yuni.h>
+# include <yuni/core/string.h>
+# include <yuni/core/noncopyable.h>
+# include <yuni/io/file.h>
+# include <type_traits>
+
+
+namespace Antares
+{
+namespace MatrixCache
+{
+
+	/*!
+	** \brief Flag to enable/disable the binary cache of the matrices
+	**
+	** When enabled, each matrix successfully parsed from a text file is written
+	** next to it (`<filename>.cache`), column by column, as it is stored in memory.
+	** The next loadings of the same file directly map the cache instead of
+	** parsing the text again, as long as the source file has not changed.
+	**
+	** This variable must be set before the loading of any study.
+	** Disabled by default.
+	*/
+	extern bool enabled;
+
+	//! Extension of the cache files
+	extern const char* const extension;
+
+	//! Initial value of a checksum (see Checksum())
+	extern const Yuni::uint64 checksumOffsetBasis;
+
+	/*!
+	** \brief FNV-1a checksum, on words of 64bits
+	**
+	** \param hash The checksum of the previous data, `checksumOffsetBasis` for the first one
+	** \param data The data to add to the checksum
+	** \param size Size of the data (in bytes)
+	*/
+	Yuni::uint64 Checksum(Yuni::uint64 hash, const void* data, Yuni::uint64 size);
+
+
+	/*!
+	** \brief Everything the content of a cache file depends on
+	*/
+	class Key final
+	{
+	public:
+		//! Default constructor
+		Key();
+
+		/*!
+		** \brief Prepare the key of a given source file
+		**
+		** \param filename The text file the matrix is loaded from
+		** \param typeID Identifier of the matrix types (see TypeID())
+		** \param minWidth The expected minimum width
+		** \param maxHeight The expected height
+		** \param options The loading options (only the ones modifying the result are kept)
+		** \return True if the source file exists
+		*/
+		bool prepare(const AnyString& filename, uint typeID, uint minWidth, uint maxHeight, uint options);
+
+	public:
+		//! Identifier of the matrix types
+		uint typeID;
+		//! The expected minimum width
+		uint minWidth;
+		//! The expected height
+		uint maxHeight;
+		//! The loading options
+		uint options;
+		//! Size of the source file (in bytes)
+		Yuni::uint64 sourceSize;
+		//! Timestamp of the last modification of the source file
+		Yuni::sint64 sourceTime;
+
+	}; // class Key
+
+
+	/*!
+	** \brief Read-only mapping of a cache file
+	**
+	** The file is only accepted if its header matches the given key and if
+	** the checksum of its values is correct.
+	*/
+	class Reader final : private Yuni::NonCopyable<Reader>
+	{
+	public:
+		//! \name Constructor & Destructor
+		//@{
+		//! Default constructor
+		Reader();
+		//! Destructor
+		~Reader();
+		//@}
+
+		/*!
+		** \brief Map the cache of a given source file
+		**
+		** \param filename The text file the matrix is loaded from
+		** \param key The key of the source file
+		** \param sizeofT Size of a single value
+		** \return True if the cache exists and is up to date
+		*/
+		bool open(const AnyString& filename, const Key& key, uint sizeofT);
+
+		//! Unmap the cache file
+		void close();
+
+		//! Width of the cached matrix
+		uint width() const;
+		//! Height of the cached matrix
+		uint height() const;
+		//! The values of a single column
+		const void* column(uint x) const;
+		//! Size of the whole file (in bytes)
+		Yuni::uint64 size() const;
+
+	private:
+		//! Address of the mapping
+		const char* pData;
+		//! Size of the mapping
+		Yuni::uint64 pSize;
+		//! Size of a single column (in bytes)
+		Yuni::uint64 pColumnSize;
+		//! Dimensions of the cached matrix
+		uint pWidth;
+		uint pHeight;
+		# ifdef YUNI_OS_WINDOWS
+		void* pFileHandle;
+		void* pMappingHandle;
+		# endif
+
+	}; // class Reader
+
+
+	/*!
+	** \brief Writer of the cache file of a given source file
+	**
+	** The header is written last, thus an interrupted writing never produces
+	** a cache file which could be considered as valid.
+	*/
+	class Writer final : private Yuni::NonCopyable<Writer>
+	{
+	public:
+		//! \name Constructor & Destructor
+		//@{
+		/*!
+		** \brief Constructor
+		**
+		** \param sizeofT Size of a single value
+		** \param width Width of the matrix
+		** \param height Height of the matrix
+		*/
+		Writer(uint sizeofT, uint width, uint height);
+		//! Destructor
+		~Writer();
+		//@}
+
+		/*!
+		** \brief Create the cache file of a given source file
+		*/
+		bool open(const AnyString& filename);
+
+		//! Append the values of the next column
+		void column(const void* data);
+
+		/*!
+		** \brief Write the header, once all columns have been appended
+		**
+		** \return True if the cache file is complete
+		*/
+		bool commit(const Key& key);
+
+	private:
+		//! The cache file
+		Yuni::IO::File::Stream pFile;
+		//! Filename of the cache file
+		Yuni::String pFilename;
+		//! Size of a single value
+		const uint pSizeofT;
+		//! Dimensions of the matrix
+		const uint pWidth;
+		const uint pHeight;
+		//! Number of columns already written
+		uint pColumnCount;
+		//! Checksum of the values
+		Yuni::uint64 pChecksum;
+		//! False if an error has occured
+		bool pValid;
+
+	}; // class Writer
+
+
+	//! Identifier of a single type
+	template<class U>
+	inline uint TypeIDOf()
+	{
+		return (uint) sizeof(U)
+			| (std::is_floating_point<U>::value ? 0x20u : 0u)
+			| (std::is_signed<U>::value ? 0x40u : 0u);
+	}
+
+	/*!
+	** \brief Identifier of a pair of matrix types
+	**
+	** A cache file written for a matrix can only be read back by a matrix
+	** with the same types (the rounding done at loading depends on ReadWriteT)
+	*/
+	template<class T, class ReadWriteT>
+	inline uint TypeID()
+	{
+		return TypeIDOf<T>() | (TypeIDOf<ReadWriteT>() << 8);
+	}
+
+
+
+
+} // namespace MatrixCache
+} // namespace Antares
+
+#endif // __ANTARES_LIBS_ARRAY_MATRIX_CACHE_H__
@@ -36,6 +36,7 @@
 # include "../memory/memory.h"
 # include "../study/fwd.h"
 # include "autoflush.h"
+# include "matrix-cache.h"
 
 
 
@@ -220,6 +221,11 @@ namespace Antares
 		*/
 		void clear();
 
+		/*!
+		** \brief Exchange the content of two matrices (no copy)
+		*/
+		void swap(Matrix& rhs);
+
 		/*!
 		** \brief Empty the matrix and mark it as modified
 		*/
@@ -459,6 +465,16 @@ namespace Antares
 			uint minWidth, uint maxHeight, uint options,
 			BufferType* buffer = NULL);
 
+		/*!
+		** \brief Load data from the binary cache of a CSV file (see MatrixCache)
+		*/
+		bool internalLoadCacheFile(const AnyString& filename, const MatrixCache::Key& key);
+
+		/*!
+		** \brief Write the binary cache of a CSV file, once loaded
+		*/
+		void internalSaveCacheFile(const AnyString& filename, const MatrixCache::Key& key) const;
+
 		//! Initialize the JIT structures and returns true
 		bool internalLoadJITData(const AnyString& filename,
 			uint minWidth, uint maxHeight, uint options);
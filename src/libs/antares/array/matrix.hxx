@@ -30,6 +30,7 @@
 # include <yuni/yuni.h>
 # include <yuni/core/string.h>
 # include <yuni/core/math.h>
+# include <utility>
 # include "../logs.h"
 # include "../string-to-double.h"
 # include "../io/statistics.h"
@@ -605,6 +606,16 @@ namespace Antares
 	}
 
 
+	template<class T, class ReadWriteT>
+	void Matrix<T,ReadWriteT>::swap(Matrix& rhs)
+	{
+		std::swap(width,  rhs.width);
+		std::swap(height, rhs.height);
+		std::swap(entry,  rhs.entry);
+		std::swap(jit,    rhs.jit);
+	}
+
+
 	template<class T, class ReadWriteT>
 	void Matrix<T,ReadWriteT>::reset()
 	{
@@ -1072,11 +1083,28 @@ namespace Antares
 		// Status
 		bool result = false;
 
+		// The binary cache of the file, when still up to date, allows to skip
+		// the parsing of the whole file
+		MatrixCache::Key cacheKey;
+		const bool useCache = MatrixCache::enabled
+			and cacheKey.prepare(filename, MatrixCache::TypeID<T, ReadWriteT>(), minWidth, maxHeight,
+				(options & (optFixedSize | optNeverFails)));
+
 		const bool hasOwnership = (NULL == buffer);
 		if (not buffer)
 			buffer = new BufferType();
 
-		switch (IO::File::LoadFromFile(*buffer, filename, filesizeHardLimit))
+		if (useCache and internalLoadCacheFile(filename, cacheKey))
+		{
+			result = true;
+			// Mark as modified
+			if (0 != (options & optMarkAsModified))
+			{
+				if (jit)
+					jit->markAsModified();
+			}
+		}
+		else switch (IO::File::LoadFromFile(*buffer, filename, filesizeHardLimit))
 		{
 			case IO::errNone:
 				{
@@ -1100,6 +1128,9 @@ namespace Antares
 					result = loadFromBuffer(filename, *buffer, minWidth, maxHeight,
 						(options & optFixedSize), options);
 
+					if (useCache and result)
+						internalSaveCacheFile(filename, cacheKey);
+
 					// Mark as modified
 					if (0 != (options & optMarkAsModified))
 					{
@@ -1170,6 +1201,57 @@ namespace Antares
 
 
 
+	template<class T, class ReadWriteT>
+	bool Matrix<T,ReadWriteT>::internalLoadCacheFile(const AnyString& filename,
+		const MatrixCache::Key& key)
+	{
+		MatrixCache::Reader reader;
+		if (not reader.open(filename, key, sizeof(T)))
+			return false;
+
+		resize(reader.width(), reader.height(), (0 != (key.options & optFixedSize)));
+
+		MatrixAutoFlush<MatrixType> autoflush(*this);
+		for (uint x = 0; x != width; ++x)
+		{
+			++autoflush;
+			# ifdef ANTARES_SWAP_SUPPORT
+			entry[x].copy(height, reinterpret_cast<const T*>(reader.column(x)));
+			# else
+			(void)::memcpy(entry[x], reader.column(x), sizeof(T) * height);
+			# endif
+		}
+
+		// IO statistics
+		Statistics::HasReadFromDisk(reader.size());
+		return true;
+	}
+
+
+	template<class T, class ReadWriteT>
+	void Matrix<T,ReadWriteT>::internalSaveCacheFile(const AnyString& filename,
+		const MatrixCache::Key& key) const
+	{
+		if (0 == width or 0 == height)
+			return;
+
+		MatrixCache::Writer writer(sizeof(T), width, height);
+		if (writer.open(filename))
+		{
+			MatrixAutoFlush<MatrixType> autoflush(*this);
+			for (uint x = 0; x != width; ++x)
+			{
+				++autoflush;
+				writer.column(Antares::Memory::RawPointer(entry[x]));
+			}
+			if (not writer.commit(key))
+				logs.debug() << "  :: impossible to write the cache of `" << filename << "'";
+		}
+	}
+
+
+
+
 	namespace // anonymous
 	{
 
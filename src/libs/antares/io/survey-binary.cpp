@@ -0,0 +1,311 @@
+/*
+** Copyright 2007-2018 RTE
+** Authors: Antares_Simulator Team
+**
+** This file is part of Antares_Simulator.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** There are special exceptions to the terms and conditions of the
+** license as they are applied to this software. View the full text of
+** the exceptions in file COPYING.txt in the directory of this software
+** distribution
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with Antares_Simulator. If not, see <http://www.gnu.org/licenses/>.
+**
+** SPDX-License-Identifier: licenceRef-GPL3_WITH_RTE-Exceptions
+*/
+
+#include "survey-binary.h"
+#include <yuni/io/file.h>
+#include <yuni/core/math.h>
+#include <string.h>
+#include <stdio.h>
+#include <vector>
+#include "../logs/logs.h"
+
+using namespace Yuni;
+
+
+namespace Antares
+{
+namespace SurveyBinary
+{
+
+	const char* const extension = ".bin";
+
+
+	namespace // anonymous
+	{
+
+		//! Magic of the binary survey files
+		static const char magic[8] = { 'A', 'N', 'T', 'S', 'U', 'R', 'V', '\0' };
+
+
+		//! Sequential reading of a binary survey file loaded in memory
+		class Reader final
+		{
+		public:
+			explicit Reader(const Clob& buffer) :
+				pBuffer(buffer),
+				pOffset(0),
+				pError(false)
+			{}
+
+			bool error() const
+			{
+				return pError;
+			}
+
+			const char* read(uint size)
+			{
+				if (pError or (uint64) pOffset + size > pBuffer.size())
+				{
+					pError = true;
+					return nullptr;
+				}
+				const char* p = pBuffer.data() + pOffset;
+				pOffset += size;
+				return p;
+			}
+
+			uint readInteger()
+			{
+				uint value = 0;
+				const char* p = read((uint) sizeof(uint));
+				if (p)
+					memcpy(&value, p, sizeof(uint));
+				return value;
+			}
+
+			AnyString readString()
+			{
+				uint size = readInteger();
+				const char* p = read(size);
+				return (p) ? AnyString(p, size) : AnyString();
+			}
+
+			void align()
+			{
+				pOffset = (pOffset + 7u) & ~7u;
+			}
+
+		private:
+			const Clob& pBuffer;
+			uint pOffset;
+			bool pError;
+		};
+
+
+		//! Column metadata, as read from the file
+		struct Column
+		{
+			uint decimals;
+			bool notApplicable;
+			const char* values;
+		};
+
+
+		//! Same conversion as the text output of the solver
+		void AppendValue(Clob& out, double v, const Column& column, char* conversionBuffer, uint bufferSize)
+		{
+			if (column.notApplicable)
+			{
+				out.append("\tN/A", 4);
+				return;
+			}
+			if (Math::Zero(v))
+			{
+				out.append("\t0", 2);
+				return;
+			}
+			if (Math::NaN(v))
+			{
+				out.append("\tNaN", 4);
+				return;
+			}
+			if (Math::Infinite(v))
+			{
+				out.append((v > 0) ? "\t+inf" : "\t-inf", 5);
+				return;
+			}
+
+			# ifdef YUNI_OS_MSVC
+			int sizePrintf = ::sprintf_s(conversionBuffer, bufferSize, "%.*f", (int) column.decimals, v);
+			# else
+			int sizePrintf = ::snprintf(conversionBuffer, bufferSize, "%.*f", (int) column.decimals, v);
+			# endif
+
+			if (sizePrintf >= 0 and (uint) sizePrintf < bufferSize)
+			{
+				out += '\t';
+				out.append((const char*) conversionBuffer, (uint) sizePrintf);
+			}
+			else
+				out += "\tERR";
+		}
+
+	} // anonymous namespace
+
+
+
+
+
+	Writer::Writer(Clob& buffer) :
+		pBuffer(buffer)
+	{
+		pBuffer.clear();
+	}
+
+
+	void Writer::writeInteger(uint value)
+	{
+		pBuffer.append((const char*) &value, sizeof(uint));
+	}
+
+
+	void Writer::writeString(const AnyString& text)
+	{
+		writeInteger(text.size());
+		pBuffer.append(text.c_str(), text.size());
+	}
+
+
+	void Writer::header(uint dataLevel, uint fileLevel, uint precisionLevel,
+		uint columnCount, uint firstRow, uint rowCount, const AnyString& textHeader)
+	{
+		// Large files : only one allocation
+		pBuffer.reserve(256 + textHeader.size() + columnCount * (96 + rowCount * sizeof(double))
+			+ rowCount * 24);
+
+		pBuffer.append(magic, sizeof(magic));
+		writeInteger(formatVersion);
+		writeInteger(dataLevel);
+		writeInteger(fileLevel);
+		writeInteger(precisionLevel);
+		writeInteger(columnCount);
+		writeInteger(firstRow);
+		writeInteger(rowCount);
+		writeString(textHeader);
+	}
+
+
+	void Writer::column(const AnyString& name, const AnyString& unit, const AnyString& statistic,
+		uint decimals, bool notApplicable)
+	{
+		writeString(name);
+		writeString(unit);
+		writeString(statistic);
+		writeInteger(decimals);
+		writeInteger(notApplicable ? 1 : 0);
+	}
+
+
+	void Writer::rowLabels(const AnyString& labels)
+	{
+		writeString(labels);
+		// The values are aligned on 8 bytes
+		while (0 != (pBuffer.size() & 7u))
+			pBuffer += '\0';
+	}
+
+
+
+
+
+	bool ConvertToText(const AnyString& filename, Clob& out)
+	{
+		out.clear();
+
+		Clob buffer;
+		if (IO::errNone != IO::File::LoadFromFile(buffer, filename, 1024u * 1024u * 1024u))
+		{
+			logs.error() << "impossible to read " << filename;
+			return false;
+		}
+
+		Reader reader(buffer);
+		const char* fileMagic = reader.read((uint) sizeof(magic));
+		if (not fileMagic or 0 != memcmp(fileMagic, magic, sizeof(magic)))
+		{
+			logs.error() << filename << ": not a binary survey file";
+			return false;
+		}
+		uint version = reader.readInteger();
+		if (version != formatVersion)
+		{
+			logs.error() << filename << ": unsupported format version " << version;
+			return false;
+		}
+
+		// levels, not required for the conversion
+		reader.readInteger();
+		reader.readInteger();
+		reader.readInteger();
+
+		uint columnCount = reader.readInteger();
+		reader.readInteger(); // first row
+		uint rowCount    = reader.readInteger();
+		AnyString textHeader = reader.readString();
+
+		std::vector<Column> columns(columnCount);
+		for (uint x = 0; x != columnCount and not reader.error(); ++x)
+		{
+			reader.readString(); // name
+			reader.readString(); // unit
+			reader.readString(); // statistic
+			columns[x].decimals      = Math::Min<uint>(reader.readInteger(), 20);
+			columns[x].notApplicable = (0 != reader.readInteger());
+		}
+
+		AnyString labels = reader.readString();
+		reader.align();
+		for (uint x = 0; x != columnCount and not reader.error(); ++x)
+			columns[x].values = reader.read(rowCount * (uint) sizeof(double));
+
+		if (reader.error())
+		{
+			logs.error() << filename << ": the file is truncated";
+			return false;
+		}
+
+		out.reserve(textHeader.size() + labels.size() + rowCount * columnCount * 10);
+		out += textHeader;
+
+		char conversionBuffer[256];
+		uint labelOffset = 0;
+		double v;
+		for (uint y = 0; y != rowCount; ++y)
+		{
+			// Row label
+			uint end = labelOffset;
+			while (end < labels.size() and labels[end] != '\n')
+				++end;
+			out.append(labels.c_str() + labelOffset, end - labelOffset);
+			labelOffset = end + 1;
+
+			for (uint x = 0; x != columnCount; ++x)
+			{
+				memcpy(&v, columns[x].values + y * sizeof(double), sizeof(double));
+				AppendValue(out, v, columns[x], conversionBuffer, (uint) sizeof(conversionBuffer));
+			}
+			out += '\n';
+		}
+		return true;
+	}
+
+
+
+
+
+} // namespace SurveyBinary
+} // namespace Antares
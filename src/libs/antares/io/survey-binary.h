@@ -0,0 +1,117 @@
+/*
+** Copyright 2007-2018 RTE
+** Authors: Antares_Simulator Team
+**
+** This file is part of Antares_Simulator.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** There are special exceptions to the terms and conditions of the
+** license as they are applied to this software. View the full text of
+** the exceptions in file COPYING.txt in the directory of this software
+** distribution
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with Antares_Simulator. If not, see <http://www.gnu.org/licenses/>.
+**
+** SPDX-License-Identifier: licenceRef-GPL3_WITH_RTE-Exceptions
+*/
+#ifndef __ANTARES_LIBS_IO_SURVEY_BINARY_H__
+# define __ANTARES_LIBS_IO_SURVEY_BINARY_H__
+
+# include <yuni/yuni.h>
+# include <yuni/core/string.h>
+
+
+namespace Antares
+{
+namespace SurveyBinary
+{
+
+	/*!
+	** \brief Binary columnar format of the survey results (values-*.bin, details-*.bin...)
+	**
+	** A file contains the same results as its text counterpart, the values being stored
+	** as raw float64 column by column. All integers are uint32, strings are prefixed by
+	** their length (uint32) and the byte order is the native one (little endian) :
+	**
+	**  - magic "ANTSURV" + '\0' (8 bytes), format version
+	**  - data level, file level and precision level (see Solver::Variable::Category)
+	**  - column count, index of the first row (one-based), row count
+	**  - text header : all the lines preceding the values in the text format
+	**  - for each column : name, unit, statistic, decimal count (uint32), not applicable (uint32)
+	**  - row labels, as in the first columns of the text format (one line per row)
+	**  - padding to a multiple of 8 bytes, then columnCount x rowCount float64
+	*/
+	enum
+	{
+		//! Version of the format
+		formatVersion = 1,
+	};
+
+	//! Extension of the binary files
+	extern const char* const extension;
+
+
+
+	/*!
+	** \brief Build a binary survey file in memory (the file is then written in one go)
+	**
+	** The methods must be called in the order of the format : header(), column() for
+	** each column, rowLabels(), then value() for all values column by column.
+	*/
+	class Writer final
+	{
+	public:
+		//! Constructor, the buffer is cleared
+		explicit Writer(Yuni::Clob& buffer);
+
+		void header(uint dataLevel, uint fileLevel, uint precisionLevel,
+			uint columnCount, uint firstRow, uint rowCount, const AnyString& textHeader);
+
+		void column(const AnyString& name, const AnyString& unit, const AnyString& statistic,
+			uint decimals, bool notApplicable);
+
+		void rowLabels(const AnyString& labels);
+
+		void value(double v)
+		{
+			pBuffer.append((const char*) &v, sizeof(double));
+		}
+
+	private:
+		void writeInteger(uint value);
+		void writeString(const AnyString& text);
+
+	private:
+		Yuni::Clob& pBuffer;
+
+	}; // class Writer
+
+
+
+	/*!
+	** \brief Convert a binary survey file into its text layout
+	**
+	** \param filename The binary file
+	** \param[out] out The content of the text file
+	** \return True if the operation succeeded
+	*/
+	bool ConvertToText(const AnyString& filename, Yuni::Clob& out);
+
+
+
+
+
+} // namespace SurveyBinary
+} // namespace Antares
+
+#endif // __ANTARES_LIBS_IO_SURVEY_BINARY_H__
@@ -0,0 +1,132 @@
+/*
+** Copyright 2007-2018 RTE
+** Authors: Antares_Simulator Team
+**
+** This file is part of Antares_Simulator.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** There are special exceptions to the terms and conditions of the
+** license as they are applied to this software. View the full text of
+** the exceptions in file COPYING.txt in the directory of this software
+** distribution
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with Antares_Simulator. If not, see <http://www.gnu.org/licenses/>.
+**
+** SPDX-License-Identifier: licenceRef-GPL3_WITH_RTE-Exceptions
+*/
+#ifndef __ANTARES_LIBS_LOGS_DEFERRED_H__
+# define __ANTARES_LIBS_LOGS_DEFERRED_H__
+
+# include <yuni/yuni.h>
+# include <yuni/core/string.h>
+# include <yuni/core/noncopyable.h>
+# include <yuni/core/logs/null.h>
+# include <vector>
+# include <utility>
+
+
+namespace Antares
+{
+namespace Private
+{
+namespace Logs
+{
+
+	//! Write a log entry kept aside, with its original verbosity (see logs.h)
+	template<class VerbosityType> void WriteDeferredEntry(const AnyString& message);
+
+
+	/*!
+	** \brief Log entries kept aside by a thread, to be written later
+	**
+	** While an instance is active on a thread, all the entries logged by this
+	** thread are stored instead of being written. They can be written afterwards,
+	** in the same order, from any thread. This is useful to get the same logs
+	** from some tasks run concurrently than from the same tasks run one after
+	** another.
+	*/
+	class DeferredEntries final : private Yuni::NonCopyable<DeferredEntries>
+	{
+	public:
+		//! Function to write a single entry
+		typedef void (*WriteFunction)(const AnyString& message);
+
+	public:
+		//! \name Constructor & Destructor
+		//@{
+		//! Default constructor
+		DeferredEntries();
+		//! Destructor
+		~DeferredEntries();
+		//@}
+
+		//! Keep aside all the entries logged by the calling thread from now
+		void activate();
+		//! Stop keeping aside the entries logged by the calling thread
+		void deactivate();
+
+		/*!
+		** \brief Write all the entries kept aside so far
+		**
+		** The instance must not be active on the calling thread
+		*/
+		void flush();
+
+		//! Append a new entry
+		void append(WriteFunction write, const AnyString& message);
+
+		//! The instance active on the calling thread, if any
+		static DeferredEntries* Current();
+
+	private:
+		//! All entries, in the order they have been logged
+		std::vector<std::pair<WriteFunction, Yuni::String> > pEntries;
+
+	}; // class DeferredEntries
+
+
+
+	/*!
+	** \brief Log Handler: keep aside the entries of the threads with active deferred entries
+	**
+	** The entries of the other threads are transmitted to the next handlers.
+	*/
+	template<class NextHandler = Yuni::Logs::NullHandler>
+	class Deferrable : public NextHandler
+	{
+	public:
+		template<class LoggerT, class VerbosityType>
+		void internalDecoratorWriteWL(LoggerT& logger, const AnyString& s) const
+		{
+			auto* deferred = DeferredEntries::Current();
+			if (deferred)
+			{
+				deferred->append(&WriteDeferredEntry<VerbosityType>, s);
+				return;
+			}
+
+			// Transmit the message to the next handler
+			NextHandler::template internalDecoratorWriteWL<LoggerT, VerbosityType>(logger, s);
+		}
+
+	}; // class Deferrable
+
+
+
+
+
+} // namespace Logs
+} // namespace Private
+} // namespace Antares
+
+#endif // __ANTARES_LIBS_LOGS_DEFERRED_H__
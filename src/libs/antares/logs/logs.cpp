@@ -29,6 +29,7 @@
 #include <stdlib.h>
 #include <stdarg.h>
 #include <stdio.h>
+#include <assert.h>
 #include "logs.h"
 #include <yuni/core/logs.h>
 #include "../emergency.h"
@@ -50,6 +51,75 @@ using namespace Yuni;
 
 
 
+namespace Antares
+{
+namespace Private
+{
+namespace Logs
+{
+
+	namespace // anonymous
+	{
+
+		//! The deferred entries active on the current thread
+		thread_local DeferredEntries* gCurrentDeferredEntries = nullptr;
+
+	} // anonymous namespace
+
+
+	DeferredEntries::DeferredEntries()
+	{}
+
+
+	DeferredEntries::~DeferredEntries()
+	{
+		if (gCurrentDeferredEntries == this)
+			gCurrentDeferredEntries = nullptr;
+	}
+
+
+	void DeferredEntries::activate()
+	{
+		gCurrentDeferredEntries = this;
+	}
+
+
+	void DeferredEntries::deactivate()
+	{
+		if (gCurrentDeferredEntries == this)
+			gCurrentDeferredEntries = nullptr;
+	}
+
+
+	void DeferredEntries::flush()
+	{
+		assert(gCurrentDeferredEntries != this and "the deferred entries would be kept aside again");
+		for (auto& entry : pEntries)
+			entry.first(entry.second);
+		pEntries.clear();
+		pEntries.shrink_to_fit();
+	}
+
+
+	void DeferredEntries::append(WriteFunction write, const AnyString& message)
+	{
+		pEntries.emplace_back(write, message);
+	}
+
+
+	DeferredEntries* DeferredEntries::Current()
+	{
+		return gCurrentDeferredEntries;
+	}
+
+
+} // namespace Logs
+} // namespace Private
+} // namespace Antares
+
+
+
+
 int LogCompatibility(const char format[], ...)
 {
 	va_list parg;
@@ -69,6 +69,7 @@
 # include <yuni/core/logs.h>
 # include <yuni/core/logs/decorators/applicationname.h>
 # include <yuni/core/logs/handler/callback.h>
+# include "deferred.h"
 
 
 namespace Antares
@@ -87,10 +88,11 @@ namespace Antares
 
 
 	//! Handlers for logging
-	typedef Yuni::Logs::StdCout<       // For writing to the standard output
+	typedef Private::Logs::Deferrable< // For keeping aside the entries of some threads
+		Yuni::Logs::StdCout<           // For writing to the standard output
 		Yuni::Logs::File<              // For writing into a log file
 		Yuni::Logs::Callback<>         // Callback
-		> > LoggingHandlers;
+		> > > LoggingHandlers;
 
 	//! Decorators for logging
 	typedef Yuni::Logs::Time<          // Date/Time when the entry log is added
@@ -104,6 +106,21 @@ namespace Antares
 	extern Yuni::Logs::Logger<LoggingHandlers, LoggingDecorators>  logs;
 
 
+	namespace Private
+	{
+	namespace Logs
+	{
+
+		template<class VerbosityType>
+		void WriteDeferredEntry(const AnyString& message)
+		{
+			logs.custom<VerbosityType>() << message;
+		}
+
+	} // namespace Logs
+	} // namespace Private
+
+
 } // namespace Antares
 
 # endif
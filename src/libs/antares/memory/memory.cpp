@@ -64,9 +64,6 @@ namespace Antares
 	bool Memory::InformAboutDiskSpaceReservation = true;
 
 
-	/*extern*/ Memory memory;
-
-
 
 	namespace // anonymous
 	{
@@ -77,21 +74,85 @@ namespace Antares
 		//! handle mapping
 		typedef std::unordered_map<Memory::Handle, Memory::Mapping*> MappingMap;
 
-		// Global mutex for memory handler
+
+		/*!
+		** \brief A subset of the handles, with its own lock
+		**
+		** Acquiring or flushing a mapping only locks its shard. The global mutex
+		** is only required for the blocks of the swap files (allocation, release).
+		** Lock order: the global mutex first, then a shard.
+		*/
+		class Shard final
+		{
+		public:
+			Shard() :
+				mostRecent(nullptr),
+				leastRecent(nullptr),
+				residentSize(0)
+			{}
+
+		public:
+			//! Mutex for the mapping and the resident list
+			Yuni::Mutex mutex;
+			//! handle mapping
+			MappingMap mapping;
+			//! Resident mappings (currently mapped into memory), from the most recently acquired
+			Memory::Mapping* mostRecent;
+			Memory::Mapping* leastRecent;
+			//! Size in bytes of the resident mappings
+			uint64 residentSize;
+		};
+
+
+		// Global mutex for the swap files
 		static Yuni::Mutex gMutex;
 
 		//! The next handle which should be used
 		static Memory::Handle pNextHandle = 0; // It will be incremented by internalAllocate()
-		//! Mapping handle
-		static MappingMap pMapping;
+		//! Mapping handle, by shard
+		static Shard gShards[Memory::shardCount];
 		//! All swap files
 		static SwapFileList pSwapFile;
 
 
+		static inline Shard& ShardOf(Memory::Handle handle)
+		{
+			return gShards[handle & (Memory::shardCount - 1)];
+		}
+
+
+		static inline void LinkAsMostRecentWL(Shard& shard, Memory::Mapping& mapping)
+		{
+			mapping.previous = nullptr;
+			mapping.next = shard.mostRecent;
+			if (shard.mostRecent)
+				shard.mostRecent->previous = &mapping;
+			else
+				shard.leastRecent = &mapping;
+			shard.mostRecent = &mapping;
+			shard.residentSize += (uint64) mapping.nbBlocks * Memory::blockSize;
+		}
+
+
+		static inline void UnlinkWL(Shard& shard, Memory::Mapping& mapping)
+		{
+			if (mapping.previous)
+				mapping.previous->next = mapping.next;
+			else
+				shard.mostRecent = mapping.next;
+			if (mapping.next)
+				mapping.next->previous = mapping.previous;
+			else
+				shard.leastRecent = mapping.previous;
+			mapping.previous = nullptr;
+			mapping.next = nullptr;
+			shard.residentSize -= (uint64) mapping.nbBlocks * Memory::blockSize;
+		}
 
 
-		static inline void FlushMappingWL(Memory::Mapping& mapping)
+		static inline void FlushMappingWL(Shard& shard, Memory::Mapping& mapping)
 		{
+			// A mapping is resident as long as it knows the pointer to reset
 			void** p = const_cast<void**>(mapping.pointer);
 			if (p)
 			{
@@ -106,6 +167,7 @@ namespace Antares
 					*p = nullptr;
 				}
 				mapping.pointer = nullptr;
+				UnlinkWL(shard, mapping);
 			}
 		}
 
@@ -114,9 +176,13 @@ namespace Antares
 
 
 
+	// The memory manager must be destroyed before the swap files and the shards
+	/*extern*/ Memory memory;
+
 
 
 	Memory::Memory() :
+		pResidentLimit(0),
 		pAlreadyInitialized(false)
 	{
 		// Nothing must be called here. There is a circular
@@ -209,10 +275,12 @@ namespace Antares
 		if (not pSwapFile.empty())
 		{
 			// Flush all handle first
+			for (uint s = 0; s != shardCount; ++s)
 			{
-				const MappingMap::iterator end = pMapping.end();
-				for (MappingMap::iterator i = pMapping.begin(); i != end; ++i)
-					FlushMappingWL(*(i->second));
+				Shard& shard = gShards[s];
+				Yuni::MutexLocker shardLocker(shard.mutex);
+				while (shard.mostRecent)
+					FlushMappingWL(shard, *shard.mostRecent);
 			}
 
 			bool stop = true;
@@ -257,6 +325,7 @@ namespace Antares
 					<< s.nbFreeBlocks << " free blocks";
 				++index;
 			}
+			logs.info() << "[memory][summary] -- resident: " << (residentMemory() / 1024 / 1024) << "Mo";
 		}
 		else
 			logs.info() << "[memory][summary] No swap file available";
@@ -310,14 +379,12 @@ namespace Antares
 		{
 			mapOverheadPerElement = (sizeof(Handle) + sizeof(Mapping*) + sizeof(32/*std::_Rb_tree_node_base*/))
 		};
-		result += pMapping.size() * (sizeof(Mapping) + mapOverheadPerElement);
-
-		const MappingMap::const_iterator end = pMapping.end();
-		for (MappingMap::const_iterator i = pMapping.begin(); i != end; ++i)
+		for (uint s = 0; s != shardCount; ++s)
 		{
-			const Mapping& mapping = *(i->second);
-			if (mapping.pointer)
-				result += mapping.nbBlocks * blockSize;
+			Shard& shard = gShards[s];
+			Yuni::MutexLocker shardLocker(shard.mutex);
+			result += shard.mapping.size() * (sizeof(Mapping) + mapOverheadPerElement);
+			result += shard.residentSize;
 		}
 		return result;
 	}
@@ -334,6 +401,31 @@ namespace Antares
 	}
 
 
+	uint64 Memory::residentMemory() const
+	{
+		uint64 result = 0;
+		for (uint s = 0; s != shardCount; ++s)
+		{
+			Shard& shard = gShards[s];
+			Yuni::MutexLocker locker(shard.mutex);
+			result += shard.residentSize;
+		}
+		return result;
+	}
+
+
+	uint64 Memory::residentLimit() const
+	{
+		return pResidentLimit;
+	}
+
+
+	void Memory::residentLimit(uint64 bytes)
+	{
+		pResidentLimit = bytes;
+	}
+
+
 	Memory::Handle Memory::internalAllocate(size_t size)
 	{
 		// This allocator does not suit well for small chunks
@@ -398,25 +490,32 @@ namespace Antares
 				for (uint j = 0; j != blockNeeded; ++j)
 					bitmap.set(offset + j);
 
-				// Looking for a valid handle
-				{
-					const MappingMap::iterator end = pMapping.end();
-					while (pMapping.find(++pNextHandle) != end or not pNextHandle) // or (uint) -1 == pNextHandle)
-					{
-						// does nothing
-					}
-				}
-
 				// Less blocks are now available
 				swap.nbFreeBlocks -= blockNeeded;
 
-				// Registering the new handle
+				// The new mapping, not resident yet
 				Mapping* mapping      = new Mapping();
 				mapping->pointer      = nullptr;
 				mapping->offset       = offset;
 				mapping->nbBlocks     = blockNeeded;
 				mapping->swapFile     = &swap;
-				pMapping[pNextHandle] = mapping;
+				mapping->previous     = nullptr;
+				mapping->next         = nullptr;
+
+				// Looking for a valid handle and registering the mapping into its shard
+				do
+				{
+					if (not ++pNextHandle) // or (uint) -1 == pNextHandle)
+						continue;
+					Shard& shard = ShardOf(pNextHandle);
+					Yuni::MutexLocker shardLocker(shard.mutex);
+					if (shard.mapping.find(pNextHandle) == shard.mapping.end())
+					{
+						shard.mapping[pNextHandle] = mapping;
+						break;
+					}
+				}
+				while (true);
 				// std::cout << "  allocate handle " << pNextHandle << " of " << blockNeeded << " blocks" << '\n';
 
 				// Returning the current handle
@@ -438,15 +537,22 @@ namespace Antares
 	{
 		Yuni::MutexLocker locker(gMutex);
 
-		// higher pointers should be located into the last swap files
-		MappingMap::iterator end = pMapping.end();
-		for (MappingMap::iterator i = pMapping.begin(); i != end; ++i)
+		for (uint s = 0; s != shardCount; ++s)
 		{
-			Mapping& mapping = *(i->second);
-			releaseWL(mapping);
-			delete i->second;
+			Shard& shard = gShards[s];
+			Yuni::MutexLocker shardLocker(shard.mutex);
+
+			// higher pointers should be located into the last swap files
+			MappingMap::iterator end = shard.mapping.end();
+			for (MappingMap::iterator i = shard.mapping.begin(); i != end; ++i)
+			{
+				Mapping& mapping = *(i->second);
+				FlushMappingWL(shard, mapping);
+				releaseWL(mapping);
+				delete i->second;
+			}
+			shard.mapping.clear();
 		}
-		pMapping.clear();
 
 		// Reset the next handle
 		pNextHandle = 0;
@@ -455,27 +561,15 @@ namespace Antares
 
 	void Memory::releaseWL(Mapping& mapping)
 	{
+		// The mapping must have been unmapped (and removed from the resident list
+		// of its shard) : only its blocks remain to be released
+		assert(mapping.pointer == nullptr and "the mapping must be flushed first");
+
 		// alias to the current swap file
 		SwapFileInfo& currentSwapFile = *mapping.swapFile;
 		// Updating the new amount of free blocks
 		currentSwapFile.nbFreeBlocks += mapping.nbBlocks;
 
-		// unmapping the pointer
-		// On Windows, all pointers must be unmapped before closing the file
-		// descriptor
-		// This is not mandatory on Unixes but it will be better like that.
-		void** p = const_cast<void**>(mapping.pointer);
-		if (p and *p)
-		{
-			// Unmapping
-			# ifdef YUNI_OS_WINDOWS
-			UnmapViewOfFile(*p);
-			# else
-			munmap(*p, mapping.nbBlocks * blockSize);
-			# endif
-			*p = nullptr;
-		}
-
 		// Checking if we should merely remove the swap file
 		if (currentSwapFile.nbFreeBlocks == blockPerSwap and pSwapFile.size() != 1)
 		{
@@ -520,20 +614,25 @@ namespace Antares
 	void Memory::release(Memory::Handle handle)
 	{
 		assert(handle != 0);
-		gMutex.lock();
-
-		MappingMap::iterator i = pMapping.find(handle);
-		if (i != pMapping.end())
+		Mapping* mapping;
+		{
+			// On Windows, all pointers must be unmapped before closing the file
+			// descriptor
+			// This is not mandatory on Unixes but it will be better like that.
+			Shard& shard = ShardOf(handle);
+			Yuni::MutexLocker shardLocker(shard.mutex);
+			MappingMap::iterator i = shard.mapping.find(handle);
+			if (i == shard.mapping.end())
+				return;
+			mapping = i->second;
+			FlushMappingWL(shard, *mapping);
+			shard.mapping.erase(i);
+		}
 		{
-			Mapping* mapping = i->second;
+			Yuni::MutexLocker locker(gMutex);
 			releaseWL(*mapping);
-			pMapping.erase(i);
-			gMutex.unlock();
-
-			delete mapping;
 		}
-		else
-			gMutex.unlock();
+		delete mapping;
 	}
 
 
@@ -543,22 +642,23 @@ namespace Antares
 		assert(pointer != NULL);
 
 		// Locking
-		Yuni::MutexLocker locker(gMutex);
+		Shard& shard = ShardOf(handle);
+		Yuni::MutexLocker locker(shard.mutex);
 
-		MappingMap::iterator i = pMapping.find(handle);
-		if (i != pMapping.end())
+		MappingMap::iterator i = shard.mapping.find(handle);
+		if (i != shard.mapping.end())
 		{
 			Mapping& m = *(i->second);
-			m.pointer = (volatile void**) pointer;
 
-			// Unmapping
+			// Mapping
 			# ifdef YUNI_OS_WINDOWS
 			// On Windows, for code safety, we have to use exceptions....
+			void* p = nullptr;
 			try
 			{
 				LARGE_INTEGER offset;
 				offset.QuadPart = m.offset * blockSize;
-				void* p = MapViewOfFile(m.swapFile->mappingHandle, FILE_MAP_ALL_ACCESS,
+				p = MapViewOfFile(m.swapFile->mappingHandle, FILE_MAP_ALL_ACCESS,
 					offset.HighPart, offset.LowPart, m.nbBlocks * blockSize);
 				if (p == nullptr)
 				{
@@ -575,14 +675,13 @@ namespace Antares
 					}
 					return nullptr;
 				}
-				return p;
 			}
 			catch (...)
 			{
 				logs.error() << "memory pool: impossible to access to the swap file : "
 					<< m.swapFile->filename << " (offset: " << (sint64)m.offset << ')';
+				return nullptr;
 			}
-			return nullptr;
 
 			# else
 
@@ -594,16 +693,24 @@ namespace Antares
 					<< m.swapFile->filename;
 				return nullptr;
 			}
-			return p;
 			# endif
+
+			// The mapping becomes the most recently acquired one of its shard
+			if (m.pointer)
+				UnlinkWL(shard, m);
+			m.pointer = (volatile void**) pointer;
+			LinkAsMostRecentWL(shard, m);
+			// The pointer is set under the lock, a concurrent flush can not miss it
+			*(m.pointer) = p;
+			return p;
 		}
 
 		logs.error() << "memory pool: impossible to acquire the ressource " << handle << ": Resource ID not found";
 		# ifndef NDEBUG
 		{
 			logs.info() << "trace: ";
-			const MappingMap::iterator end = pMapping.end();
-			for (MappingMap::iterator i = pMapping.begin(); i != end; ++i)
+			const MappingMap::iterator end = shard.mapping.end();
+			for (MappingMap::iterator i = shard.mapping.begin(); i != end; ++i)
 			{
 				logs.info() << "  id: " << i->first << ",  ptr: " << (void*) i->second->pointer
 					<< ",  offset: " << i->second->offset;
@@ -620,10 +727,15 @@ namespace Antares
 	# ifdef ANTARES_SWAP_SUPPORT
 	void Memory::flushAll()
 	{
-		Yuni::MutexLocker locker(gMutex);
-		const MappingMap::iterator end = pMapping.end();
-		for (MappingMap::iterator i = pMapping.begin(); i != end; ++i)
-			FlushMappingWL(*(i->second));
+		// Only the resident mappings are browsed, from the least recently acquired
+		const uint64 limit = pResidentLimit / shardCount;
+		for (uint s = 0; s != shardCount; ++s)
+		{
+			Shard& shard = gShards[s];
+			Yuni::MutexLocker locker(shard.mutex);
+			while (shard.leastRecent and shard.residentSize > limit)
+				FlushMappingWL(shard, *shard.leastRecent);
+		}
 	}
 	# endif
 
@@ -633,10 +745,11 @@ namespace Antares
 	{
 		if (handle)
 		{
-			Yuni::MutexLocker locker(gMutex);
-			MappingMap::iterator i = pMapping.find(handle);
-			if (i != pMapping.end())
-				FlushMappingWL(*(i->second));
+			Shard& shard = ShardOf(handle);
+			Yuni::MutexLocker locker(shard.mutex);
+			MappingMap::iterator i = shard.mapping.find(handle);
+			if (i != shard.mapping.end())
+				FlushMappingWL(shard, *(i->second));
 		}
 	}
 
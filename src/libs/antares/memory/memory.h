@@ -98,6 +98,10 @@ namespace Antares
 			uint offset;
 			//! The number of block used by this data block
 			uint nbBlocks;
+
+			//! Resident mappings of the same shard, from the most recently acquired
+			Mapping* previous;
+			Mapping* next;
 		};
 
 
@@ -124,6 +128,12 @@ namespace Antares
 			//! Blocks per swap file
 			blockPerSwap = swapSize / blockSize,
 			/*!
+			** \brief Number of shards for the handles (must be a power of 2)
+			**
+			** Each shard has its own lock and its own list of resident mappings
+			*/
+			shardCount   = 16,
+			/*!
 			** \brief Minimal allocation size required to be managed by our custom memory cache
 			**
 			** Below this value, the system allocator will be used
@@ -418,10 +428,31 @@ namespace Antares
 		//! \name Memory management
 		//@{
 		/*!
-		** \brief Flush all memory into swap files
+		** \brief Flush the resident memory into swap files
+		**
+		** Only the mappings acquired since they were last flushed are browsed. The least
+		** recently acquired ones are unmapped first, until the resident memory does not
+		** exceed the limit (everything is unmapped with the default limit).
 		*/
 		void flushAll();
 
+		/*!
+		** \brief Get the amount of memory from the swap files currently mapped
+		*/
+		Yuni::uint64 residentMemory() const;
+
+		/*!
+		** \brief Get the amount of memory from the swap files kept mapped by flushAll()
+		*/
+		Yuni::uint64 residentLimit() const;
+
+		/*!
+		** \brief Set the amount of memory from the swap files kept mapped by flushAll()
+		**
+		** \param bytes A size in bytes (0 to unmap everything at each flush)
+		*/
+		void residentLimit(Yuni::uint64 bytes);
+
 		/*!
 		** \brief Get the amount of memory currently used
 		*/
@@ -544,6 +575,9 @@ namespace Antares
 		//! The process ID used
 		Yuni::uint64 pProcessID;
 
+		//! Amount of memory kept mapped by flushAll()
+		Yuni::uint64 pResidentLimit;
+
 		//! Avoid multiple initializations
 		bool pAlreadyInitialized;
 
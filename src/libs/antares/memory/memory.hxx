@@ -220,8 +220,10 @@ namespace Antares
 	void Memory::Array<T>::assign(uint count, const T& value)
 	{
 		ANTARES_SWAP_ACQUIRE_PTR;
+		T* const p = (T*) pPointer; // not re-read at each iteration
+		const T v = value;
 		for (uint i = 0; i != count; ++i)
-			((T*)pPointer)[i] = value;
+			p[i] = v;
 	}
 
 	template<class T>
@@ -247,8 +249,10 @@ namespace Antares
 	void Memory::Array<T>::increment(uint count, const T& value)
 	{
 		ANTARES_SWAP_ACQUIRE_PTR;
+		T* const p = (T*) pPointer;
+		const T v = value;
 		for (uint i = 0; i != count; ++i)
-			((T*) pPointer)[i] += value;
+			p[i] += v;
 	}
 
 
@@ -256,8 +260,9 @@ namespace Antares
 	void Memory::Array<T>::increment(uint count, const T* value)
 	{
 		ANTARES_SWAP_ACQUIRE_PTR;
+		T* const p = (T*) pPointer;
 		for (uint i = 0; i != count; ++i)
-			((T*) pPointer)[i] += value[i];
+			p[i] += value[i];
 	}
 
 
@@ -269,8 +274,10 @@ namespace Antares
 		if (not value.pPointer)
 			value.pPointer = (T*) Antares::memory.acquireMapping(value.pHandle, &value.pPointer);
 		# endif
+		T* const p = (T*) pPointer;
+		const T* const q = (const T*) value.pPointer;
 		for (uint i = 0; i != count; ++i)
-			((T*) pPointer)[i] += ((T*) value.pPointer)[i];
+			p[i] += q[i];
 	}
 
 
@@ -278,8 +285,10 @@ namespace Antares
 	void Memory::Array<T>::multiply(uint count, const T& value)
 	{
 		ANTARES_SWAP_ACQUIRE_PTR;
+		T* const p = (T*) pPointer;
+		const T v = value;
 		for (uint i = 0; i != count; ++i)
-			((T*) pPointer)[i] *= value;
+			p[i] *= v;
 	}
 
 
@@ -287,8 +296,9 @@ namespace Antares
 	void Memory::Array<T>::multiply(uint count, const T* value)
 	{
 		ANTARES_SWAP_ACQUIRE_PTR;
+		T* const p = (T*) pPointer;
 		for (uint i = 0; i != count; ++i)
-			((T*) pPointer)[i] *= value[i];
+			p[i] *= value[i];
 	}
 
 
@@ -300,8 +310,10 @@ namespace Antares
 		if (not value.pPointer)
 			value.pPointer = (T*) Antares::memory.acquireMapping(value.pHandle, &value.pPointer);
 		# endif
+		T* const p = (T*) pPointer;
+		const T* const q = (const T*) value.pPointer;
 		for (uint i = 0; i != count; ++i)
-			((T*) pPointer)[i] *= ((T*) value.pPointer)[i];
+			p[i] *= q[i];
 	}
 
 
@@ -37,6 +37,7 @@
 #include "../memory-usage.h"
 #include "../../config.h"
 #include "../filter.h"
+#include "../loading-tasks.h"
 #include "constants.h"
 #include "../../../internet/limits.h"
 
@@ -1242,17 +1243,32 @@ namespace Data
 			pStudy.ensureDataAreAllInitialized();
 
 		// Load all nodes
-		uint indx = 0;
+		// The areas are independent from each other at this stage and can be
+		// loaded concurrently, except for old studies where the thermal clusters
+		// may have to be renamed
+		std::vector<Data::Area*> list;
+		list.reserve(areas.size());
 		each([&] (Data::Area& area)
 		{
+			list.push_back(&area);
+		});
+
+		const uint threadCount = (pStudy.header.version < 390) ? 1 : options.loadingThreadCount;
+		ret = RunLoadingTasks(threadCount, (uint) list.size(), [&] (uint indx) -> bool
+		{
+			auto& area = *(list[indx]);
+			// Progression and buffers of its own
+			StudyLoadOptions areaOptions(options);
+			Clob areaBuffer;
+
 			// Progression
-			options.logMessage.clear() << "Loading the area " << (++indx) << '/' << areas.size()
+			areaOptions.logMessage.clear() << "Loading the area " << (indx + 1) << '/' << list.size()
 				<< ": " << area.name;
-			logs.info() << options.logMessage;
+			logs.info() << areaOptions.logMessage;
 
 			// Load a single area
-			ret = AreaListLoadFromFolderSingleArea(pStudy, this, area, buffer, options) and ret;
-		});
+			return AreaListLoadFromFolderSingleArea(pStudy, this, area, areaBuffer, areaOptions);
+		}) and ret;
 
 		// update nameid set
 		updateNameIDSet();
@@ -32,6 +32,7 @@
 #include "../../utils.h"
 #include "../runtime.h"
 #include "../memory-usage.h"
+#include "../loading-tasks.h"
 
 using namespace Yuni;
 using namespace Antares;
@@ -1002,32 +1003,44 @@ namespace Data
 			}
 		}
 
-		auto* e = new BindingConstraint::EnvForLoading(study.areas, study.header.version);
-		auto& env = *e;
-		env.folder = folder;
-
-		env.iniFilename << env.folder << SEP << "bindingconstraints.ini";
+		Clob iniFilename;
+		iniFilename << folder << SEP << "bindingconstraints.ini";
 		IniFile ini;
-		if (not ini.open(env.iniFilename))
-		{
-			delete e;
+		if (not ini.open(iniFilename))
 			return false;
+
+		// All sections, the binding constraints are independent from each other
+		// and can be loaded concurrently
+		std::vector<IniFile::Section*> sections;
+		for (auto* section = ini.firstSection; section; section = section->next)
+		{
+			if (section->firstProperty)
+				sections.push_back(section);
 		}
 
-		// For each section
-		if (ini.firstSection)
+		std::vector<BindingConstraint*> loaded(sections.size(), nullptr);
+		RunLoadingTasks(options.loadingThreadCount, (uint) sections.size(), [&] (uint i) -> bool
 		{
-			for (env.section = ini.firstSection; env.section; env.section = env.section->next)
-			{
-				if (env.section->firstProperty)
-				{
-					BindingConstraint* bc = new BindingConstraint();
-					if (bc->loadFromEnv(env))
-						pList.push_back(bc);
-					else
-						delete bc;
-				}
-			}
+			// Buffers of its own
+			auto* e = new BindingConstraint::EnvForLoading(study.areas, study.header.version);
+			auto& env = *e;
+			env.folder = folder;
+			env.iniFilename = iniFilename;
+			env.section = sections[i];
+
+			BindingConstraint* bc = new BindingConstraint();
+			if (bc->loadFromEnv(env))
+				loaded[i] = bc;
+			else
+				delete bc;
+			delete e;
+			return (loaded[i] != nullptr);
+		});
+
+		for (auto* bc : loaded)
+		{
+			if (bc)
+				pList.push_back(bc);
 		}
 
 		// Logs
@@ -1043,8 +1056,6 @@ namespace Data
 				logs.info() << pList.size() << " binding constraints found";
 		}
 
-		delete e;
-
 		// When ran from the solver and if the simplex is in `weekly` mode,
 		// all weekly constraints will become daily ones.
 		if (study.usedByTheSolver)
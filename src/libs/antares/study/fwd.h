@@ -204,6 +204,19 @@ namespace Data
 
 	}; // enum LinkType
 
+
+	/*!
+	** \brief Format of the survey results written by the solver
+	*/
+	enum ResultFormat
+	{
+		//! Text files (values-hourly.txt...)
+		rfTxtFiles = 0,
+		//! Binary columnar files (values-hourly.bin...), see io/survey-binary.h
+		rfBinary,
+
+	}; // enum ResultFormat
+
 	/*!
 	** \brief Types of timeSeries
 	**
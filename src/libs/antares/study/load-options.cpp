@@ -47,6 +47,7 @@ namespace Data
 		enableParallel(false),
 		forceParallel(false),
 		maxNbYearsInParallel(0),
+		loadingThreadCount(0),
 		usedByTheSolver(false),
 		mpsToExport(false)
 	{}
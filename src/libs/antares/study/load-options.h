@@ -82,6 +82,9 @@ namespace Data
 		bool forceParallel;
 		uint maxNbYearsInParallel;
 
+		//! Maximum number of threads for loading the areas and the constraints (<= 1 to not use any thread)
+		uint loadingThreadCount;
+
 		//! A non-zero value if the data will be used for a simulation
 		bool usedByTheSolver;
 
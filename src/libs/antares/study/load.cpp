@@ -172,10 +172,6 @@ namespace Data
 		maxNbYearsInParallel = 1;
 		# endif
 
-		// In case the study is run in the draft mode, only 1 core is allowed
-		if (parameters.mode == Data::stdmAdequacyDraft)
-			maxNbYearsInParallel = 1;
-
 		// In case parallel mode was not chosen, only 1 core is allowed
 		if (!options.enableParallel && !options.forceParallel)
 			maxNbYearsInParallel = 1;
@@ -0,0 +1,112 @@
+/*
+** Copyright 2007-2018 RTE
+** Authors: Antares_Simulator Team
+**
+** This file is part of Antares_Simulator.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** There are special exceptions to the terms and conditions of the
+** license as they are applied to this software. View the full text of
+** the exceptions in file COPYING.txt in the directory of this software
+** distribution
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with Antares_Simulator. If not, see <http://www.gnu.org/licenses/>.
+**
+** SPDX-License-Identifier: licenceRef-GPL3_WITH_RTE-Exceptions
+*/
+
+#include "loading-tasks.h"
+#include <yuni/job/job.h>
+#include <yuni/job/queue/service.h>
+#include "../logs.h"
+#include "../memory/memory.h"
+#include <vector>
+
+using namespace Yuni;
+
+
+
+namespace Antares
+{
+namespace Data
+{
+
+	namespace // anonymous
+	{
+
+		class LoadingJob final : public Yuni::Job::IJob
+		{
+		public:
+			LoadingJob(const std::function<bool (uint)>& task, uint index, char& result,
+				Private::Logs::DeferredEntries& entries) :
+				task(task),
+				index(index),
+				result(result),
+				entries(entries)
+			{}
+
+		protected:
+			virtual void onExecute() override
+			{
+				entries.activate();
+				result = task(index) ? 1 : 0;
+				entries.deactivate();
+			}
+
+		private:
+			const std::function<bool (uint)>& task;
+			const uint index;
+			char& result;
+			Private::Logs::DeferredEntries& entries;
+		};
+
+	} // anonymous namespace
+
+
+
+	bool RunLoadingTasks(uint threadCount, uint taskCount, const std::function<bool (uint)>& task)
+	{
+		bool ret = true;
+
+		if (threadCount < 2 or taskCount < 2 or Antares::Memory::swapSupport)
+		{
+			for (uint i = 0; i != taskCount; ++i)
+				ret = task(i) and ret;
+			return ret;
+		}
+
+		std::vector<char> results(taskCount, 0);
+		std::vector<Private::Logs::DeferredEntries> entries(taskCount);
+
+		Yuni::Job::QueueService qs;
+		qs.maximumThreadCount((threadCount < taskCount) ? threadCount : taskCount);
+		for (uint i = 0; i != taskCount; ++i)
+			qs.add(new LoadingJob(task, i, results[i], entries[i]));
+		qs.start();
+		qs.wait(Yuni::qseIdle);
+		qs.stop();
+
+		// Writing the logs as if the tasks had been run one after another
+		for (uint i = 0; i != taskCount; ++i)
+		{
+			entries[i].flush();
+			ret = (0 != results[i]) and ret;
+		}
+		return ret;
+	}
+
+
+
+
+} // namespace Data
+} // namespace Antares
@@ -0,0 +1,61 @@
+/*
+** Copyright 2007-2018 RTE
+** Authors: Antares_Simulator Team
+**
+** This file is part of Antares_Simulator.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** There are special exceptions to the terms and conditions of the
+** license as they are applied to this software. View the full text of
+** the exceptions in file COPYING.txt in the directory of this software
+** distribution
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with Antares_Simulator. If not, see <http://www.gnu.org/licenses/>.
+**
+** SPDX-License-Identifier: licenceRef-GPL3_WITH_RTE-Exceptions
+*/
+#ifndef __ANTARES_LIBS_STUDY_LOADING_TASKS_H__
+# define __ANTARES_LIBS_STUDY_LOADING_TASKS_H__
+
+# include <yuni/yuni.h>
+# include <functional>
+
+
+namespace Antares
+{
+namespace Data
+{
+
+	/*!
+	** \brief Run independent loading tasks on a bounded number of threads
+	**
+	** The tasks are started in order. The log entries of each task are kept aside
+	** and written in the order of the tasks once they are all complete, thus the
+	** logs remain the same than with a sequential loading.
+	** The tasks are run one after another by the calling thread when
+	** the swap support is enabled or when a single thread is allowed.
+	**
+	** \param threadCount The maximum number of threads
+	** \param taskCount The number of tasks
+	** \param task The task to run, from its index
+	** \return True if all tasks have succeeded
+	*/
+	bool RunLoadingTasks(uint threadCount, uint taskCount, const std::function<bool (uint)>& task);
+
+
+
+
+} // namespace Data
+} // namespace Antares
+
+#endif // __ANTARES_LIBS_STUDY_LOADING_TASKS_H__
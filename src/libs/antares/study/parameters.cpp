@@ -236,6 +236,7 @@ namespace Data
 		refreshIntervalHydro   = 100;
 		refreshIntervalWind    = 100;
 		refreshIntervalThermal = 100;
+		refreshInBackground    = false;
 		// Archive
 		timeSeriesToArchive    = 0; // None
 		// Pre-Processor
@@ -251,6 +252,7 @@ namespace Data
 		// readonly
 		readonly               = false;
 		synthesis              = true;
+		resultFormat           = rfTxtFiles;
 
 		// Initial reservoir levels
 		initialReservoirLevels.iniLevels = irlColdStart;
@@ -265,6 +267,7 @@ namespace Data
 		shedding.policy        = shpShavePeaks;
 
 		unitCommitment.ucMode    = ucHeuristic;
+		unitCommitment.parallelClusters = false;
 		nbCores.ncMode			 = ncAvg;
 		reserveManagement.daMode = daGlobal;
 
@@ -284,6 +287,9 @@ namespace Data
 		include.reserve.spinning       = true;
 		include.reserve.primary        = true;
 		simplexOptimizationRange       = sorWeek;
+		simplexParallelDays            = false;
+		simplexWarmStart               = false;
+		simplexTelemetry               = false;
 
 		include.exportMPS              = false;
 
@@ -654,12 +660,27 @@ namespace Data
 			return value.to<uint>(d.refreshIntervalThermal);
 		if (key == "refreshintervalsolar")
 			return value.to<uint>(d.refreshIntervalSolar);
+		if (key == "refresh-in-background")
+			return value.to<bool>(d.refreshInBackground);
 		// What timeSeries to refresh ?
 		if (key == "refreshtimeseries")
 			return ConvertCStrToListTimeSeries(value, d.timeSeriesToRefresh);
 		// readonly
 		if (key == "readonly")
 			return value.to<bool>(d.readonly);
+		if (key == "result-format")
+		{
+			CString<64, false> v = value;
+			v.trim();
+			v.toLower();
+			if (v == "binary")
+				d.resultFormat = rfBinary;
+			else if (v == "txt-files")
+				d.resultFormat = rfTxtFiles;
+			else
+				return false;
+			return true;
+		}
 		// Error
 		return false;
 	}
@@ -757,6 +778,12 @@ namespace Data
 						d.simplexOptimizationRange = (!value.ifind("day")) ? sorDay : sorWeek;
 						return true;
 					}
+					if (key == "simplex-parallel-days")
+						return value.to<bool>(d.simplexParallelDays);
+					if (key == "simplex-warm-start")
+						return value.to<bool>(d.simplexWarmStart);
+					if (key == "simplex-telemetry")
+						return value.to<bool>(d.simplexTelemetry);
 					if (key == "simulation.start")
 					{
 						uint day;
@@ -872,6 +899,8 @@ namespace Data
 			d.unitCommitment.ucMode = ucHeuristic;
 			return false;
 		}
+		if (key == "unit-commitment-parallel-clusters")
+			return value.to<bool>(d.unitCommitment.parallelClusters);
 
 		// Error
 		return false;
@@ -1141,6 +1170,8 @@ namespace Data
 		{
 			case sorDay:
 				logs.info() << "  simplex optimization range: day";
+				if (simplexParallelDays)
+					logs.info() << "  simplex optimization: the days of a week are solved in parallel";
 				break;
 			case sorWeek:
 				logs.info() << "  simplex optimization range: week";
@@ -1148,6 +1179,16 @@ namespace Data
 			case sorUnknown:
 				break;
 		}
+		if (simplexWarmStart)
+			logs.info() << "  simplex optimization: warm start from the previous year";
+		if (simplexTelemetry)
+			logs.info() << "  simplex optimization: telemetry written into the output";
+		if (unitCommitment.ucMode == ucMILP and unitCommitment.parallelClusters)
+			logs.info() << "  unit commitment: the thermal clusters are adjusted in parallel";
+		if (resultFormat == rfBinary)
+			logs.info() << "  results written in binary format (see the results-converter tool to get text files)";
+		if (refreshInBackground and timeSeriesToRefresh)
+			logs.info() << "  refreshed time-series generated in background";
 
 		if (mode == stdmAdequacyDraft)
 		{
@@ -1438,6 +1479,7 @@ namespace Data
 		{
 			auto* section = ini.addSection("output");
 			section->add("synthesis", synthesis);
+			section->add("result-format", (resultFormat == rfBinary) ? "binary" : "txt-files");
 			section->add("storeNewSet", storeTimeseriesNumbers);
 			ParametersSaveTimeSeries(section, "archives", timeSeriesToArchive);
 		}
@@ -1452,6 +1494,9 @@ namespace Data
 				case sorWeek: section->add("simplex-range", "week");break;
 				case sorUnknown: break;
 			}
+			section->add("simplex-parallel-days", simplexParallelDays);
+			section->add("simplex-warm-start", simplexWarmStart);
+			section->add("simplex-telemetry", simplexTelemetry);
 			// Optimization preferences
 			switch (transmissionCapacities)
 			{
@@ -1486,6 +1531,7 @@ namespace Data
 			section->add("shedding-strategy",				SheddingStrategyToCString(shedding.strategy));
 			section->add("shedding-policy",					SheddingPolicyToCString(shedding.policy));
 			section->add("unit-commitment-mode",			UnitCommitmentModeToCString(unitCommitment.ucMode));
+			section->add("unit-commitment-parallel-clusters",	unitCommitment.parallelClusters);
 			section->add("number-of-cores-mode",			NumberOfCoresModeToCString(nbCores.ncMode));
 			section->add("day-ahead-reserve-management",	DayAheadReserveManagementModeToCString(reserveManagement.daMode));
 		}
@@ -1497,6 +1543,8 @@ namespace Data
 			ParametersSaveTimeSeries(section, "accuracy-on-correlation", timeSeriesAccuracyOnCorrelation);
 			// Adequacy Block size (adequacy draft)
 			section->add("adequacy-block-size", adequacyBlockSize);
+			// Generation of the refreshed time-series in advance
+			section->add("refresh-in-background", refreshInBackground);
 		}
 
 		// User's playlist
@@ -259,6 +259,13 @@ namespace Data
 		uint refreshIntervalThermal;
 		//! Refresh interval (in years) for timeSeries : Solar
 		uint refreshIntervalSolar;
+		/*!
+		** \brief Generate the refreshed time-series while the previous years are simulated
+		**
+		** The time-series of the next refresh window are generated into a copy of
+		** the matrices, which doubles the memory used by the regenerated time-series.
+		*/
+		bool refreshInBackground;
 		//@}
 
 
@@ -331,6 +338,8 @@ namespace Data
 
 		//! Write the simulation synthesis into the output
 		bool synthesis;
+		//! Format of the survey results (text or binary)
+		ResultFormat resultFormat;
 
 		//! \name Optimization
 		//@{
@@ -403,6 +412,8 @@ namespace Data
 		{
 			//! Unit Commitment Mode
 			UnitCommitmentMode  ucMode;
+			//! Adjust the started units of the thermal clusters in parallel (accurate mode)
+			bool parallelClusters;
 		} unitCommitment;
 
 		
@@ -442,6 +453,13 @@ namespace Data
 		LinkType linkType;
 		//! Simplex optimization range (day/week)
 		SimplexOptimization  simplexOptimizationRange;
+		//! Solve the daily intervals of a week simultaneously (simplex range = day)
+		bool simplexParallelDays;
+		//! Start the first week of a year from the optimal basis of the previous year on the same space
+		//! (and the problems of the hydro ventilation from their previous resolution on this space)
+		bool simplexWarmStart;
+		//! Record the duration and the statistics of each simplex resolution into the output
+		bool simplexTelemetry;
 		//@}
 
 		//! \name Scenariio Builder - Rules
@@ -171,7 +171,7 @@ namespace Data
 		};
 
 		data.resize(hydroPreproMax, 12, true);
-		String& buffer = s.bufferLoadingTS;
+		String buffer;
 
 		buffer.clear() << folder << SEP << areaID << SEP << "prepro.ini";
 		bool ret = (PreproHydroLoadSettings(this, buffer.c_str()) ? true : false);
@@ -264,7 +264,7 @@ namespace Data
 		else
 		{
 			buffer.clear() << folder << SEP << areaID << SEP << "energy.txt";
-			ret = data.loadFromCSVFile(buffer, hydroPreproMax, 12, mtrxOption, &s.dataBuffer) && ret;
+			ret = data.loadFromCSVFile(buffer, hydroPreproMax, 12, mtrxOption) && ret;
 		}
 
 		if (s.header.version < 640)
@@ -51,14 +51,14 @@ namespace Data
 		assert(folder);
 		assert('\0' != *folder);
 
-		Yuni::String& buffer = study.buffer;
+		Yuni::String buffer;
 
 		int ret = 1;
 		/* Solar the matrix */
 		if (study.header.version >= 330)
 		{
 			buffer.clear() << folder << SEP << "solar_" << areaID << '.' << study.inputExtension;
-			ret = s->series.loadFromCSVFile(buffer, 1, HOURS_PER_YEAR, &study.dataBuffer) && ret;
+			ret = s->series.loadFromCSVFile(buffer, 1, HOURS_PER_YEAR) && ret;
 
 			if (study.usedByTheSolver && study.parameters.derated)
 				s->series.averageTimeseries();
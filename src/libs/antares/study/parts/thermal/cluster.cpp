@@ -1523,9 +1523,14 @@ namespace Data
 	void Data::ThermalCluster::calculationOfSpinning()
 	{
 		assert(this->series);
-
 		// nominal capacity (for solver)
-		nominalCapacityWithSpinning = nominalCapacity;
+		nominalCapacityWithSpinning = calculationOfSpinning(series->series);
+	}
+
+
+	double Data::ThermalCluster::calculationOfSpinning(Matrix<double, Yuni::sint32>& ts) const
+	{
+		double capacityWithSpinning = nominalCapacity;
 
 		// Nothing to do if the spinning is equal to zero
 		// because it will the same multiply all entries of the matrix by 1.
@@ -1533,7 +1538,6 @@ namespace Data
 		{
 			logs.debug() << "  Calculation of spinning... " << parentArea->name << "::" << pName;
 
-			auto& ts = series->series;
 			// The formula
 			// const double s = 1. - cluster.spinning / 100.; */
 
@@ -1541,10 +1545,11 @@ namespace Data
 			// It is no really useful to test if the result of the formula
 			// is equal to zero, since the method `Matrix::multiplyAllValuesBy()`
 			// already does this test.
-			nominalCapacityWithSpinning *= 1 - (spinning / 100.);
+			capacityWithSpinning *= 1 - (spinning / 100.);
 			ts.multiplyAllEntriesBy(1. - (spinning / 100.));
 			ts.flush();
 		}
+		return capacityWithSpinning;
 	}
 
 
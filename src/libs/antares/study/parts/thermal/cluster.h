@@ -188,6 +188,17 @@ namespace Data
 		*/
 		void calculationOfSpinning();
 
+		/*!
+		** \brief Calculation of spinning on a given matrix of time-series
+		**
+		** The nominal capacity with spinning is not modified, so that the time-series
+		** can be generated while the cluster is read by the simulation.
+		**
+		** \param ts The time-series of the cluster (or a copy of them)
+		** \return The nominal capacity with spinning
+		*/
+		double calculationOfSpinning(Matrix<double, Yuni::sint32>& ts) const;
+
 		/*!
 		** \brief Calculation of spinning (reverse)
 		**
@@ -68,13 +68,13 @@ namespace Data
 	{
 		if (t and ag and not folder.empty())
 		{
-			auto& buffer = s.bufferLoadingTS;
+			String buffer;
 
 			int ret = 1;
 			buffer.clear() << folder << SEP << ag->parentArea->id
 				<< SEP << ag->id()
 				<< SEP << "series." << s.inputExtension;
-			ret = t->series.loadFromCSVFile(buffer, 1, HOURS_PER_YEAR, &s.dataBuffer) && ret;
+			ret = t->series.loadFromCSVFile(buffer, 1, HOURS_PER_YEAR) && ret;
 
 			if (s.usedByTheSolver && s.parameters.derated)
 				t->series.averageTimeseries();
@@ -47,11 +47,11 @@ namespace Data
 	{
 		if (!d)
 			return 1;
-		String& buffer = s.bufferLoadingTS;
+		String buffer;
 
 		int ret = 1;
 		buffer.clear() << folder << SEP << "wind_" << areaID << '.' << s.inputExtension;
-		ret = d->series.loadFromCSVFile(buffer, 1, HOURS_PER_YEAR, &s.dataBuffer) && ret;
+		ret = d->series.loadFromCSVFile(buffer, 1, HOURS_PER_YEAR) && ret;
 
 		if (s.usedByTheSolver && s.parameters.derated)
 			d->series.averageTimeseries();
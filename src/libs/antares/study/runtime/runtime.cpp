@@ -145,11 +145,25 @@ namespace Data
 
 
 
+	template<class ColumnT>
+	static bool ColumnIsConstant(const ColumnT& column, uint height)
+	{
+		for (uint y = 1; y < height; ++y)
+		{
+			if (column[y] != column[0])
+				return false;
+		}
+		return true;
+	}
+
+
 	static bool StudyRuntimeInfosInitializeAreaLinks(Study& study, StudyRuntimeInfos& r)
 	{
 		r.interconnectionsCount = study.areas.areaLinkCount();
 		typedef AreaLink* AreaLinkPointer;
 		r.areaLink = new AreaLinkPointer[r.interconnectionsCount];
+		r.linkWithConstantNTC = new bool[r.interconnectionsCount];
+		r.linkWithConstantHurdlesCosts = new bool[r.interconnectionsCount];
 
 		uint indx = 0;
 		uint areaIndx = 0;
@@ -165,6 +179,17 @@ namespace Data
 				r.areaLink[indx] = link;
 				link->index = indx;
 				link->indexForArea = areaIndx;
+
+				// The weekly problems do not have to copy again the data
+				// which remain the same throughout the year
+				auto& data = link->data;
+				r.linkWithConstantNTC[indx] = ColumnIsConstant(data[fhlNTCDirect], data.height)
+					and ColumnIsConstant(data[fhlNTCIndirect], data.height)
+					and ColumnIsConstant(data[fhlLoopFlow], data.height);
+				r.linkWithConstantHurdlesCosts[indx] = ColumnIsConstant(data[fhlHurdlesCostDirect], data.height)
+					and ColumnIsConstant(data[fhlHurdlesCostIndirect], data.height);
+				data.flush();
+
 				++indx;
 				++areaIndx;
 			}
@@ -190,6 +215,7 @@ namespace Data
 		assert(rti.clusterCount < 50000000 and "Seems a bit large..."); // arbitrary value
 		rti.bounds.resize(1, b.matrix().height);
 		rti.bounds.pasteToColumn(0, b.matrix()[C]);
+		rti.constantBounds = ColumnIsConstant(rti.bounds[0], rti.bounds.height);
 
 		rti.linkWeight    = new double[rti.linkCount];
 		rti.linkOffset    = new int[rti.linkCount];
@@ -350,6 +376,7 @@ namespace Data
 
 
 	BindingConstraintRTI::BindingConstraintRTI() :
+		constantBounds(false),
 		linkWeight(nullptr),
 		linkOffset(nullptr),
 		linkIndex(nullptr),
@@ -456,6 +483,8 @@ namespace Data
 		mode(),
 		interconnectionsCount(0),
 		areaLink(nullptr),
+		linkWithConstantNTC(nullptr),
+		linkWithConstantHurdlesCosts(nullptr),
 		timeseriesNumberYear(nullptr),
 		bindingConstraintCount(0),
 		bindingConstraint(nullptr),
@@ -669,6 +698,8 @@ namespace Data
 		delete[] currentYear;
 		delete[] timeseriesNumberYear;
 		delete[] areaLink;
+		delete[] linkWithConstantNTC;
+		delete[] linkWithConstantHurdlesCosts;
 		delete[] bindingConstraint;
 		# ifdef ANTARES_USE_GLOBAL_MAXIMUM_COST
 		delete[] hydroCostByAreaShouldBeInfinite;
@@ -682,7 +713,7 @@ namespace Data
 		if (r)
 		{
 			return sizeof(StudyRuntimeInfos)
-				+ sizeof(AreaLink*) * r->interconnectionsCount
+				+ (sizeof(AreaLink*) + 2 * sizeof(bool)) * r->interconnectionsCount
 				+ sizeof(BindingConstraint*) * r->bindingConstraintCount;
 		}
 		return 0;
@@ -698,7 +729,7 @@ namespace Data
 
 		u.study.areas.each([&] (const Data::Area& area)
 		{
-			u.requiredMemoryForInput += sizeof(AreaLink*) * area.links.size();
+			u.requiredMemoryForInput += (sizeof(AreaLink*) + 2 * sizeof(bool)) * area.links.size();
 		});
 
 		// Binding constraints
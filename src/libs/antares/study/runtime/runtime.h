@@ -91,6 +91,8 @@ namespace Data
 
 	public:
 		Matrix<double> bounds;
+		//! True if the bounds are the same throughout the year
+		bool constantBounds;
 		BindingConstraint::Type  type;
 		char operatorType;
 
@@ -159,6 +161,10 @@ namespace Data
 		uint interconnectionsCount;
 		//! All interconnections
 		AreaLink** areaLink;
+		//! True for each interconnection whose NTC and loop flow are the same throughout the year
+		bool* linkWithConstantNTC;
+		//! True for each interconnection whose hurdle costs are the same throughout the year
+		bool* linkWithConstantHurdlesCosts;
 
 		//! Random numbers generators
 		MersenneTwister random[seedMax];
@@ -145,6 +145,7 @@ namespace Data
 		preproSolarCorrelation.clear();
 		preproWindCorrelation.clear();
 		preproHydroCorrelation.clear();
+		correlationFactorizations.clear();
 
 		bindingConstraints.clear();
 		areas.clear();
@@ -44,6 +44,7 @@
 # include "sets.h"
 # include "ui-runtimeinfos.h"
 # include "../array/correlation.h"
+# include "../array/factorization-cache.h"
 # include "progression/progression.h"
 # include "load-options.h"
 # include "../date.h"
@@ -789,6 +790,8 @@ namespace Data
 		** \warning These variables should not be used directly
 		*/
 		void* cacheTSGenerator[timeSeriesCount];
+		//! Factorizations of the correlation matrices used by the TS generators
+		FactorizationCache correlationFactorizations;
 		//@}
 
 		//! \name Layers
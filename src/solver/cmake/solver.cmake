@@ -15,6 +15,9 @@ set(RTESOLVER_OPT
 		optimisation/opt_gestion_des_pmax.cpp
 		optimisation/opt_gestion_second_membre_cas_lineaire.cpp
 		optimisation/opt_optimisation_lineaire.cpp
+		optimisation/opt_resolution_parallele_des_intervalles.cpp
+		optimisation/opt_telemetrie_du_solveur.cpp
+		optimisation/opt_ecriture_mps.cpp
 		optimisation/opt_chainage_intercos.cpp
 		optimisation/opt_fonctions.h
 		optimisation/opt_pilotage_optimisation_lineaire.cpp
@@ -6,6 +6,9 @@
 set(SRC_GENERATORS
 	ts-generator/generator.h
 	ts-generator/generator.hxx
+	ts-generator/back-buffer.h
+	ts-generator/back-buffer.cpp
+	ts-generator/seed.h
 	ts-generator/thermal.cpp
 	ts-generator/hydro.cpp
 )
@@ -16,6 +16,8 @@ set(SRC_VARIABLE
 		variable/area.inc.hxx
 		variable/setofareas.h
 		variable/setofareas.hxx
+		variable/summary.h
+		variable/summary.cpp
 		variable/constants.h
 		variable/categories.h
 		variable/surveyresults.h
@@ -31,6 +33,7 @@ set(SRC_VARIABLE_STORAGE
 		variable/storage/intermediate.h
 		variable/storage/intermediate.hxx
 		variable/storage/intermediate.cpp
+		variable/storage/kernels.h
 		variable/storage/results.h
 		variable/storage/empty.h
 		variable/storage/raw.h
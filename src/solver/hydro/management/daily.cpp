@@ -39,6 +39,12 @@
 #include "../../simulation/sim_extern_variables_globales.h"
 #include <cassert>
 
+extern "C"
+{
+# include "../ext/Sirius_Solver/simplexe/spx_definition_arguments.h"
+# include "../ext/Sirius_Solver/simplexe/spx_fonctions.h"
+}
+
 using namespace Yuni;
 
 # define SEP IO::Separator
@@ -53,6 +59,61 @@ namespace Antares
 	enum { maxDTG = 32 };
 
 
+	struct HydroManagement::DailyProblems final
+	{
+		DailyProblems() :
+			problem(nullptr),
+			extendedProblem(nullptr)
+		{}
+
+		~DailyProblems()
+		{
+			if (problem)
+				H2O_J_Free(problem);
+			if (extendedProblem)
+				H2O2_J_Free(extendedProblem);
+		}
+
+		//! Problem without reservoir management (one linear problem per month length)
+		DONNEES_MENSUELLES* problem;
+		//! Problem with reservoir management (one linear problem per month length)
+		DONNEES_MENSUELLES_ETENDUES* extendedProblem;
+
+	}; // struct DailyProblems
+
+
+	HydroManagement::DailyProblems& HydroManagement::dailyProblems(uint numSpace)
+	{
+		assert(numSpace < study.maxNbYearsInParallel);
+		if (not pDailyProblems[numSpace])
+			pDailyProblems[numSpace] = new DailyProblems();
+		return *(pDailyProblems[numSpace]);
+	}
+
+
+	void HydroManagement::ReleaseSimplexProblems(void** problems, int count)
+	{
+		for (int i = 0; i < count; ++i)
+		{
+			if (problems[i])
+			{
+				SPX_LibererProbleme((PROBLEME_SPX*) problems[i]);
+				problems[i] = nullptr;
+			}
+		}
+	}
+
+
+	void HydroManagement::releaseDailyProblems()
+	{
+		for (uint numSpace = 0; numSpace < study.maxNbYearsInParallel; ++numSpace)
+			delete pDailyProblems[numSpace];
+		delete[] pDailyProblems;
+		pDailyProblems = nullptr;
+	}
+
+
+
 	
 	inline void HydroManagement::prepareDailyOptimalGenerations(Solver::Variable::State & state, Data::Area& area, uint y, uint numSpace)
 	{
@@ -241,7 +302,10 @@ namespace Antares
 				uint firstDay = study.calendar.months[simulationMonth].daysYear.first;
 				uint endDay = firstDay + daysPerMonth;
 
-				DONNEES_MENSUELLES & problem = *H2O_J_Instanciation();
+				auto& problems = dailyProblems(numSpace);
+				if (not problems.problem)
+					problems.problem = H2O_J_Instanciation();
+				DONNEES_MENSUELLES & problem = *problems.problem;
 				problem.NombreDeJoursDuMois = (int)daysPerMonth;
 				problem.TurbineDuMois = data.MOG[realmonth];
 
@@ -254,6 +318,11 @@ namespace Antares
 					dayMonth++;
 				}
 
+				if (not study.parameters.simplexWarmStart)
+				{
+					ReleaseSimplexProblems(problem.ProblemeHydraulique->ProblemeSpx,
+						problem.ProblemeHydraulique->NombreDeProblemes);
+				}
 				H2O_J_OptimiserUnMois(&problem);
 				switch (problem.ResultatsValides)
 				{
@@ -274,8 +343,6 @@ namespace Antares
 					break;
 				}
 
-				H2O_J_Free(&problem);
-
 				# ifndef NDEBUG
 				for (uint day = firstDay; day != endDay; ++day)
 				{
@@ -362,7 +429,10 @@ namespace Antares
 				uint firstDay = study.calendar.months[simulationMonth].daysYear.first;
 				uint endDay = firstDay + daysPerMonth;
 
-				DONNEES_MENSUELLES_ETENDUES & problem = *H2O2_J_Instanciation();
+				auto& problems = dailyProblems(numSpace);
+				if (not problems.extendedProblem)
+					problems.extendedProblem = H2O2_J_Instanciation();
+				DONNEES_MENSUELLES_ETENDUES & problem = *problems.extendedProblem;
 
 				# if HYDRO_DAILY_SOLVER_DEBUG != 0
 				previousMonthWaste[realmonth] = wasteFromPreviousMonth / reservoirCapacity;
@@ -390,6 +460,11 @@ namespace Antares
 					dayMonth++;
 				}
 
+				if (not study.parameters.simplexWarmStart)
+				{
+					ReleaseSimplexProblems(problem.ProblemeHydrauliqueEtendu->ProblemeSpx,
+						problem.ProblemeHydrauliqueEtendu->NombreDeProblemes);
+				}
 				H2O2_J_OptimiserUnMois(&problem);
 
 				
@@ -443,8 +518,6 @@ namespace Antares
 					break;
 				}
 
-				H2O2_J_Free(&problem);
-
 			} 
 
 			
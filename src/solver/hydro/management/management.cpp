@@ -93,6 +93,14 @@ namespace Antares
 		for(uint numSpace = 0; numSpace < study.maxNbYearsInParallel; numSpace++)
 			pAreas[numSpace] = new PerArea[study.areas.size()];
 
+		pDailyProblems = new DailyProblems*[study.maxNbYearsInParallel];
+		pMonthlyProblems = new MonthlyProblems*[study.maxNbYearsInParallel];
+		for(uint numSpace = 0; numSpace < study.maxNbYearsInParallel; numSpace++)
+		{
+			pDailyProblems[numSpace] = nullptr;
+			pMonthlyProblems[numSpace] = nullptr;
+		}
+
 		
 		random.reset(study.parameters.seed[Data::seedHydroManagement]);
 	}
@@ -103,6 +111,9 @@ namespace Antares
 		for(uint numSpace = 0; numSpace < study.maxNbYearsInParallel; numSpace++)
 			delete[] pAreas[numSpace];
 		delete[] pAreas;
+
+		releaseDailyProblems();
+		releaseMonthlyProblems();
 	}
 
 
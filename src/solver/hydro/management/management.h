@@ -83,6 +83,29 @@ namespace Antares
 		void prepareDailyOptimalGenerations(Solver::Variable::State & state, Data::Area& area, uint y, uint numSpace);
 		//@}
 
+		//! \name Linear problems
+		//@{
+		// forward declarations (the structures depend on the optimisation headers)
+		struct DailyProblems;
+		struct MonthlyProblems;
+
+		//! The linear problems of the daily ventilation for a given numSpace, built at the first use
+		DailyProblems& dailyProblems(uint numSpace);
+		//! The linear problem of the monthly ventilation for a given numSpace, built at the first use
+		MonthlyProblems& monthlyProblems(uint numSpace);
+		//! Release all linear problems of the daily ventilation
+		void releaseDailyProblems();
+		//! Release all linear problems of the monthly ventilation
+		void releaseMonthlyProblems();
+		/*!
+		** \brief Release the simplex problems kept by a linear problem
+		**
+		** Without simplex warm start, each resolution starts from scratch as if
+		** the linear problem had just been instantiated.
+		*/
+		static void ReleaseSimplexProblems(void** problems, int count);
+		//@}
+
 		//! \name Utilities
 		//@{
 		//! Beta variable
@@ -133,6 +156,18 @@ namespace Antares
 		//! Temporary data per area
 		PerArea** pAreas;
 
+		/*!
+		** \brief Linear problems, for each numSpace
+		**
+		** The problems are allocated once and reused from one area, month and
+		** year to another: only the bounds and the right-hand sides change.
+		** The simplex starts from the optimal basis of the previous resolution
+		** on the same numSpace only with the simplex warm start, since this basis
+		** depends on the scheduling of the years.
+		*/
+		DailyProblems** pDailyProblems;
+		MonthlyProblems** pMonthlyProblems;
+
 	}; // class HydroManagement
 
 
@@ -47,6 +47,43 @@ namespace Antares
 {
 
 
+	struct HydroManagement::MonthlyProblems final
+	{
+		MonthlyProblems() :
+			problem(nullptr)
+		{}
+
+		~MonthlyProblems()
+		{
+			if (problem)
+				H2O_M_Free(problem);
+		}
+
+		//! Problem of a single reservoir
+		DONNEES_ANNUELLES* problem;
+
+	}; // struct MonthlyProblems
+
+
+	HydroManagement::MonthlyProblems& HydroManagement::monthlyProblems(uint numSpace)
+	{
+		assert(numSpace < study.maxNbYearsInParallel);
+		if (not pMonthlyProblems[numSpace])
+			pMonthlyProblems[numSpace] = new MonthlyProblems();
+		return *(pMonthlyProblems[numSpace]);
+	}
+
+
+	void HydroManagement::releaseMonthlyProblems()
+	{
+		for (uint numSpace = 0; numSpace < study.maxNbYearsInParallel; ++numSpace)
+			delete pMonthlyProblems[numSpace];
+		delete[] pMonthlyProblems;
+		pMonthlyProblems = nullptr;
+	}
+
+
+
 	template<class ProblemT>
 	static void CheckHydroAllocationProblem(Data::Area& area, ProblemT& problem, int initLevelMonth, double lvi)
 	{
@@ -179,7 +216,10 @@ namespace Antares
 
 			if (area.hydro.reservoirManagement)
 			{				
-				auto& problem = *H2O_M_Instanciation(1);
+				auto& problems = monthlyProblems(numSpace);
+				if (not problems.problem)
+					problems.problem = H2O_M_Instanciation(1);
+				auto& problem = *problems.problem;
 
 				
 				double totalInflowsYear = prepareMonthlyTargetGenerations(area, data);
@@ -205,6 +245,11 @@ namespace Antares
 				}
 
 
+				if (not study.parameters.simplexWarmStart)
+				{
+					ReleaseSimplexProblems(problem.ProblemeHydraulique->ProblemeSpx,
+						problem.ProblemeHydraulique->NombreDeReservoirs);
+				}
 				H2O_M_OptimiserUneAnnee(&problem, 0);
 				switch (problem.ResultatsValides)
 				{
@@ -233,8 +278,6 @@ namespace Antares
 						AntaresSolverEmergencyShutdown();
 						break;
 				}
-
-				H2O_M_Free(&problem);
 			}
 
 			
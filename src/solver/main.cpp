@@ -134,6 +134,11 @@ bool SolverApplication::prepare(int argc, char* argv[])
 	}
 	else
 		logs.info() << "  memory pool: scratch folder:" << Antares::memory.cacheFolder();
+	if (pSettings.swapResidentLimit)
+	{
+		logs.info() << "  memory pool: resident limit: " << pSettings.swapResidentLimit << "Mo";
+		Antares::memory.residentLimit((Yuni::uint64) pSettings.swapResidentLimit * 1024 * 1024);
+	}
 	# endif
 
 
@@ -414,6 +419,9 @@ bool SolverApplication::readDataForTheStudy(Data::StudyLoadOptions& options)
 	options.ignoreConstraints = pSettings.ignoreConstraints;
 	options.loadOnlyNeeded    = true;
 
+	// Binary cache of the input matrices
+	MatrixCache::enabled = pSettings.inputCache;
+
 	// Load the study from a folder
 	if (study.loadFromFolder(pSettings.studyFolder, options) and not study.gotFatalError)
 	{
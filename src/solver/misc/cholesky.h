@@ -59,6 +59,29 @@ namespace Solver
 	bool Cholesky(U1& L, U2& A, uint size, T* temp);
 
 
+	enum
+	{
+		//! Number of columns processed together by CholeskyBlocked()
+		choleskyBlockSize = 32,
+		//! Minimum size of a matrix for Cholesky() to use CholeskyBlocked()
+		choleskyBlockedMinSize = 128,
+	};
+
+	/*!
+	** \brief Factorisation de Cholesky, par blocs de colonnes
+	**
+	** Same results as the plain algorithm (the operations are performed in the
+	** same order, without FMA contraction the results are identical), but the contribution of the
+	** previous columns is computed for a whole block of columns at once.
+	** Each row of L is thus read once per block instead of once per column,
+	** which matters when the matrix does not fit into the caches.
+	**
+	** \see Cholesky()
+	*/
+	template<class T, class U1, class U2>
+	bool CholeskyBlocked(U1& L, U2& A, uint size, T* temp);
+
+
 
 } // namespace Solver
 } // namespace Antares
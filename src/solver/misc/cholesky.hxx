@@ -42,6 +42,9 @@ namespace Solver
 	{
 		using namespace Yuni;
 
+		if (size >= (uint) choleskyBlockedMinSize)
+			return CholeskyBlocked<T>(L, A, size, temp);
+
 		for (uint i = 0; i != size; ++i)
 			temp[i] = 0;
 
@@ -100,6 +103,112 @@ namespace Solver
 	}
 
 
+	template<class T, class U1, class U2>
+	bool CholeskyBlocked(U1& L, U2& A, uint size, T* temp)
+	{
+		using namespace Yuni;
+		enum { bs = choleskyBlockSize };
+
+		for (uint i = 0; i != size; ++i)
+			temp[i] = 0;
+
+		// A[k][i] minus the contribution of the columns before the current block,
+		// for each row k >= i0 and each column i of the block
+		T* partial = new T[(size_t) size * bs];
+		// The rows of the current block, transposed (L[i][j] for j < i0)
+		T* block = new T[(size_t) size * bs];
+
+		bool failure = false;
+		T som;
+
+		for (uint i0 = 0; i0 < size and not failure; i0 += bs)
+		{
+			const uint i1 = (i0 + bs < size) ? (i0 + bs) : size;
+			const uint width = i1 - i0;
+
+			for (uint c = 0; c != width; ++c)
+			{
+				typename MatrixSubColumn<U1>::Type Lc = L[i0 + c];
+				for (uint j = 0; j != i0; ++j)
+					block[(size_t) j * bs + c] = Lc[j];
+			}
+
+			for (uint k = i0; k < size; ++k)
+			{
+				typename MatrixSubColumn<U1>::Type Lk = L[k];
+				typename MatrixSubColumn<U2>::Type Ak = A[k];
+				T* acc = partial + (size_t) (k - i0) * bs;
+				// only the lower triangle
+				const uint count = (k < i1) ? (k - i0 + 1) : width;
+
+				for (uint c = 0; c != count; ++c)
+					acc[c] = Ak[i0 + c];
+				for (uint j = 0; j != i0; ++j)
+				{
+					const T lkj = Lk[j];
+					const T* bj = block + (size_t) j * bs;
+					for (uint c = 0; c != count; ++c)
+						acc[c] -= bj[c] * lkj;
+				}
+			}
+
+			// The columns of the block, as the plain algorithm does
+			for (uint i = i0; i < i1 and not failure; ++i)
+			{
+				const uint c = i - i0;
+				typename MatrixSubColumn<U1>::Type Li = L[i];
+
+				// on calcule d'abord L[i][i]
+				som = partial[(size_t) c * bs + c];
+				for (uint j = i0; j < i; ++j)
+					som -= Li[j] * Li[j];
+
+				if (som > ANTARES_CHOLESKY_EPSIMIN)
+				{
+					Li[i] = Math::SquareRootNoCheck(som);
+
+					// maintenant on cherche L[k][i], k > i.
+					for (uint k = i + 1; k < size; ++k)
+					{
+						typename MatrixSubColumn<U1>::Type Lk = L[k];
+						typename MatrixSubColumn<U2>::Type Ak = A[k];
+
+						if (temp[k] == Ak[k])
+						{
+							Lk[i] = 0;
+						}
+						else
+						{
+							som = partial[(size_t) (k - i0) * bs + c];
+							for (uint j = i0; j < i; ++j)
+								som -= Li[j] * Lk[j];
+
+							Lk[i]  = som / Li[i];
+							temp[k] += Lk[i] * Lk[i];
+
+							if (temp[k] > Ak[k])
+							{
+								failure = true;
+								break;
+							}
+						}
+					}
+				}
+				else
+				{
+					// annule le reste de la colonne
+					for (uint k = i; k != size; ++k)
+						L[k][i] = 0;
+				}
+			}
+		}
+
+		delete[] partial;
+		delete[] block;
+		return failure;
+	}
+
+
 
 
 } // namespace Solver
@@ -30,6 +30,7 @@
 #include <yuni/core/getopt.h>
 #include <yuni/io/directory.h>
 #include <yuni/io/file.h>
+#include <yuni/core/system/cpu.h>
 
 #include <antares/logs.h>
 #include <antares/study/study.h>
@@ -63,6 +64,8 @@ bool GrabOptionsFromCommandLine(int argc, char* argv[], Settings& settings,
 	settings.noOutput             = false;
 	settings.displayProgression   = false;
 	settings.ignoreConstraints    = false;
+	settings.inputCache           = false;
+	settings.swapResidentLimit    = 0;
 
 	bool optForceExpansion = false;
 	bool optForceEconomy = false;
@@ -143,6 +146,12 @@ bool GrabOptionsFromCommandLine(int argc, char* argv[], Settings& settings,
 	getopt.addParagraph("\nMisc.");
 	// --progress
 	getopt.addFlag(settings.displayProgression, ' ', "progress", "Display the progress of each task");
+	// --loading-threads
+	getopt.add(options.loadingThreadCount, ' ', "loading-threads",
+		"Maximum number of threads used to load the study (default: the number of cores, 1 to disable)");
+	// --input-cache
+	getopt.addFlag(settings.inputCache, ' ', "input-cache",
+		"Write and use a binary cache next to each input file to speed up the loading of the next simulations");
 	// --swap
 	getopt.add(settings.swap, ' ', "swap-folder",
 		# ifdef ANTARES_SWAP_SUPPORT
@@ -152,6 +161,10 @@ bool GrabOptionsFromCommandLine(int argc, char* argv[], Settings& settings,
 		"Folder where the swap files will be written. This option has no effect (swap files are only available for 'antares-solver-swap')"
 		# endif
 		);
+	// --swap-resident-limit
+	getopt.add(settings.swapResidentLimit, ' ', "swap-resident-limit",
+		"Amount of swapped memory (Mo) which may remain mapped between two flushes, the least"
+		" recently used data being unmapped first (default: 0, everything is unmapped)");
 
 	// --pid
 	String optPID;
@@ -197,6 +210,9 @@ bool GrabOptionsFromCommandLine(int argc, char* argv[], Settings& settings,
 	if (options.maxNbYearsInParallel)
 		options.forceParallel = true;
 
+	if (not options.loadingThreadCount)
+		options.loadingThreadCount = System::CPU::Count();
+
 	if (options.enableParallel && options.forceParallel)
 	{
 		logs.error() << "Options --parallel and --force-parallel are incompatible";
@@ -61,6 +61,10 @@ public:
 	bool displayProgression;
 	//! Swap folder
 	Yuni::String swap;
+	//! Amount of swapped memory (Mo) kept mapped between two flushes
+	uint swapResidentLimit;
+	//! True to use the binary cache of the input matrices
+	bool inputCache;
 
 }; // class Settings
 
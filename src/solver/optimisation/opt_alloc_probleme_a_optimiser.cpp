@@ -52,7 +52,7 @@ using namespace Antares;
 
 static void optimisationAllocateProblem( PROBLEME_HEBDO * ProblemeHebdo, const int mxPaliers )
 {
-	int NbTermes; int NbIntervalles; int NumIntervalle; int i;
+	int NbTermes; int NbIntervalles; int NumIntervalle; int i; int NombreDeThreads;
 	size_t szNbVarsDouble; size_t szNbVarsint; size_t szNbContint;
 	int NombreDePasDeTempsPourUneOptimisation;
 	int Adder;     
@@ -168,8 +168,14 @@ static void optimisationAllocateProblem( PROBLEME_HEBDO * ProblemeHebdo, const i
 			ProblemesSpxDUneClasseDeManoeuvrabilite[i] = (PROBLEMES_SIMPLEXE*) MemAlloc( sizeof( PROBLEMES_SIMPLEXE ));
 
 			ProblemesSpxDUneClasseDeManoeuvrabilite[i]->ProblemeSpx = (void **) MemAlloc(NbIntervalles * sizeof( void * ));
+			ProblemesSpxDUneClasseDeManoeuvrabilite[i]->PositionDeLaVariable       = (int **) MemAlloc(NbIntervalles * sizeof( void * ));
+			ProblemesSpxDUneClasseDeManoeuvrabilite[i]->ComplementDeLaBase         = (int **) MemAlloc(NbIntervalles * sizeof( void * ));
+			ProblemesSpxDUneClasseDeManoeuvrabilite[i]->NbVarDeBaseComplementaires = (int *)  MemAlloc(NbIntervalles * sizeof( int ));
 			for ( NumIntervalle = 0; NumIntervalle < NbIntervalles ; NumIntervalle++ ) {
 				ProblemesSpxDUneClasseDeManoeuvrabilite[i]->ProblemeSpx[NumIntervalle] = NULL;
+				ProblemesSpxDUneClasseDeManoeuvrabilite[i]->PositionDeLaVariable[NumIntervalle]       = NULL;
+				ProblemesSpxDUneClasseDeManoeuvrabilite[i]->ComplementDeLaBase[NumIntervalle]         = NULL;
+				ProblemesSpxDUneClasseDeManoeuvrabilite[i]->NbVarDeBaseComplementaires[NumIntervalle] = 0;
 			}
 		}
 	}
@@ -181,6 +187,17 @@ static void optimisationAllocateProblem( PROBLEME_HEBDO * ProblemeHebdo, const i
 	
 	ProblemeAResoudre->Pi      = (double *) MemAlloc( ProblemeAResoudre->NombreDeVariables * sizeof( double ) );
 	ProblemeAResoudre->Colonne = (int *)    MemAlloc( ProblemeAResoudre->NombreDeVariables * sizeof( int   ) );
+
+	
+	NombreDeThreads = 1;
+	if ( ProblemeHebdo->ResolutionParalleleDesIntervalles == OUI_ANTARES && ProblemeHebdo->OptimisationAuPasHebdomadaire == NON_ANTARES ) {
+		OPT_AllocDesProblemesDesIntervalles( ProblemeHebdo, NbIntervalles );
+		NombreDeThreads = (NbIntervalles < ProblemeHebdo->NombreDeThreadsDuProbleme) ? NbIntervalles : ProblemeHebdo->NombreDeThreadsDuProbleme;
+	}
+	/* Les memes threads ajustent les paliers (couts de demarrage) */
+	if ( ProblemeHebdo->NombreDeThreadsDesPaliers > NombreDeThreads )
+		NombreDeThreads = ProblemeHebdo->NombreDeThreadsDesPaliers;
+	OPT_AllocDesThreadsDuProbleme( ProblemeAResoudre, NombreDeThreads );
 	
 	
 	logs.info(); 
@@ -241,12 +258,21 @@ void OPT_AugmenterLaTailleDeLaMatriceDesContraintes( PROBLEME_ANTARES_A_RESOUDRE
 
 void OPT_LiberationMemoireDuProblemeAOptimiser( PROBLEME_HEBDO * ProblemeHebdo )
 {
-int i; PROBLEME_ANTARES_A_RESOUDRE * ProblemeAResoudre;
+int i; int NumIntervalle; int NbIntervalles; PROBLEME_ANTARES_A_RESOUDRE * ProblemeAResoudre;
 
 ProblemeAResoudre = ProblemeHebdo->ProblemeAResoudre;
 
 if (ProblemeAResoudre)
 {
+	if (ProblemeAResoudre->NombreDeConstructionsDeLaMatrice > 0)
+	{
+		logs.debug().appendFormat(" Constraint matrix: %d build(s) in %.1f ms, %d reuse(s) in %.1f ms (rebuilding each time would have cost %.1f ms)",
+			ProblemeAResoudre->NombreDeConstructionsDeLaMatrice, ProblemeAResoudre->TempsDeConstructionDeLaMatrice,
+			ProblemeAResoudre->NombreDeReutilisationsDeLaMatrice, ProblemeAResoudre->TempsDeReutilisationDeLaMatrice,
+			ProblemeAResoudre->TempsDeConstructionDeLaMatrice / ProblemeAResoudre->NombreDeConstructionsDeLaMatrice
+				* ProblemeAResoudre->NombreDeReutilisationsDeLaMatrice);
+	}
+
 	MemFree(ProblemeAResoudre->Sens);
 	MemFree(ProblemeAResoudre->IndicesDebutDeLigne);
 	MemFree(ProblemeAResoudre->NombreDeTermesDesLignes);
@@ -266,7 +292,15 @@ if (ProblemeAResoudre)
 	MemFree(ProblemeAResoudre->CoutsReduits);
 
 	if (ProblemeAResoudre->ProblemesSpxDUneClasseDeManoeuvrabilite) {
+		NbIntervalles = (int) (ProblemeHebdo->NombreDePasDeTemps / ProblemeHebdo->NombreDePasDeTempsPourUneOptimisation);
 		for ( i = 0; i < ProblemeHebdo->NombreDeClassesDeManoeuvrabiliteActives; ++i) {
+			for ( NumIntervalle = 0; NumIntervalle < NbIntervalles ; NumIntervalle++ ) {
+				MemFree(ProblemeAResoudre->ProblemesSpxDUneClasseDeManoeuvrabilite[i]->PositionDeLaVariable[NumIntervalle]);
+				MemFree(ProblemeAResoudre->ProblemesSpxDUneClasseDeManoeuvrabilite[i]->ComplementDeLaBase[NumIntervalle]);
+			}
+			MemFree(ProblemeAResoudre->ProblemesSpxDUneClasseDeManoeuvrabilite[i]->PositionDeLaVariable);
+			MemFree(ProblemeAResoudre->ProblemesSpxDUneClasseDeManoeuvrabilite[i]->ComplementDeLaBase);
+			MemFree(ProblemeAResoudre->ProblemesSpxDUneClasseDeManoeuvrabilite[i]->NbVarDeBaseComplementaires);
 			MemFree(ProblemeAResoudre->ProblemesSpxDUneClasseDeManoeuvrabilite[i]->ProblemeSpx);
 			MemFree(ProblemeAResoudre->ProblemesSpxDUneClasseDeManoeuvrabilite[i]);
 		}
@@ -278,6 +312,9 @@ if (ProblemeAResoudre)
 	MemFree( ProblemeAResoudre->Pi );
 	MemFree( ProblemeAResoudre->Colonne );
 
+	OPT_LiberationDesProblemesDesIntervalles( ProblemeAResoudre );
+	OPT_LiberationDesThreadsDuProbleme( ProblemeAResoudre );
+
 	MemFree( ProblemeAResoudre );
 
 	ProblemeAResoudre = nullptr;
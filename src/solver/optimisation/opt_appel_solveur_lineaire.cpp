@@ -56,27 +56,22 @@ using namespace Antares;
 using namespace Antares::Data;
 using namespace Yuni;
 
-# ifdef _MSC_VER
-#	define SNPRINTF sprintf_s
-# else
-#	define SNPRINTF snprintf
-# endif
+bool OPT_AppelDuSimplexe( PROBLEME_HEBDO * , PROBLEME_ANTARES_A_RESOUDRE * , uint, int );
+bool OPT_AppelDuSolveurPne( PROBLEME_HEBDO * , PROBLEME_ANTARES_A_RESOUDRE * , uint , int );
 
-bool OPT_AppelDuSimplexe( PROBLEME_HEBDO * , uint, int );
-bool OPT_AppelDuSolveurPne( PROBLEME_HEBDO * , uint , int );
 
 
 
 
-
-bool OPT_AppelDuSolveurLineaire( PROBLEME_HEBDO * ProblemeHebdo, uint numSpace, int NumIntervalle )
+bool OPT_AppelDuSolveurLineaire( PROBLEME_HEBDO * ProblemeHebdo, PROBLEME_ANTARES_A_RESOUDRE * ProblemeAResoudre,
+                                 uint numSpace, int NumIntervalle )
 {
 
 
 
 
 if ( ProblemeHebdo->SolveurDuProblemeLineaire == ANTARES_SIMPLEXE ) {
-  if ( OPT_AppelDuSimplexe( ProblemeHebdo, numSpace, NumIntervalle ) == true ) {
+  if ( OPT_AppelDuSimplexe( ProblemeHebdo, ProblemeAResoudre, numSpace, NumIntervalle ) == true ) {
 	  return true;
 	}
 	else {
@@ -84,7 +79,7 @@ if ( ProblemeHebdo->SolveurDuProblemeLineaire == ANTARES_SIMPLEXE ) {
 	}
 }
 else {
-  if ( OPT_AppelDuSolveurPne( ProblemeHebdo, numSpace, NumIntervalle ) == true ) {
+  if ( OPT_AppelDuSolveurPne( ProblemeHebdo, ProblemeAResoudre, numSpace, NumIntervalle ) == true ) {
 	  return true;
 	}
 	else {
@@ -97,33 +92,41 @@ return true;
 
 
 
-bool OPT_AppelDuSimplexe( PROBLEME_HEBDO * ProblemeHebdo, uint numSpace, int NumIntervalle )
+bool OPT_AppelDuSimplexe( PROBLEME_HEBDO * ProblemeHebdo, PROBLEME_ANTARES_A_RESOUDRE * ProblemeAResoudre,
+                          uint numSpace, int NumIntervalle )
 {
 int Var; int Cnt; double * pt; int il; int ilMax; int Classe; char PremierPassage;
-double CoutOpt; PROBLEME_ANTARES_A_RESOUDRE * ProblemeAResoudre; PROBLEME_SIMPLEXE Probleme;
-PROBLEME_SPX * ProbSpx;
-
-
-
-
-
-
-ProblemeAResoudre = ProblemeHebdo->ProblemeAResoudre;
+double CoutOpt; PROBLEME_SIMPLEXE Probleme;
+PROBLEME_SPX * ProbSpx; PROBLEMES_SIMPLEXE * ProblemesSpx; char ReinitOptimisation; int NbVarDeBaseComplementaires;
+MESURE_DU_SOLVEUR * Mesure; double DebutDeResolution;
 
 PremierPassage = OUI_ANTARES;
 
+Mesure = NULL;
+if ( ProblemeHebdo->TelemetrieDuSolveur != NULL )
+	Mesure = &(ProblemeHebdo->TelemetrieDuSolveur->MesureDeLIntervalle[NumIntervalle]);
+
 Classe = ProblemeAResoudre->NumeroDeClasseDeManoeuvrabiliteActiveEnCours;
-ProbSpx = (PROBLEME_SPX *) ((ProblemeAResoudre->ProblemesSpxDUneClasseDeManoeuvrabilite[Classe])->ProblemeSpx[(int) NumIntervalle]);
+ProblemesSpx = ProblemeAResoudre->ProblemesSpxDUneClasseDeManoeuvrabilite[Classe];
+ProbSpx = (PROBLEME_SPX *) (ProblemesSpx->ProblemeSpx[(int) NumIntervalle]);
+
+/* En demarrage a chaud, la premiere semaine de l'annee repart de la base optimale de la premiere semaine
+   de l'annee precedente et la seconde optimisation de la semaine conserve le probleme de la premiere */
+ReinitOptimisation = ProblemeHebdo->ReinitOptimisation;
+if ( ProblemeHebdo->DemarrageAChaudDuSimplexe == OUI_ANTARES && ProblemeAResoudre->NumeroDOptimisation == DEUXIEME_OPTIMISATION )
+	ReinitOptimisation = NON_ANTARES;
 
 RESOLUTION:
 
+NbVarDeBaseComplementaires = 0;
+
 if ( ProbSpx == NULL ) {
 	Probleme.Contexte            = SIMPLEXE_SEUL;
 	Probleme.BaseDeDepartFournie = NON_SPX;
 }
 else {
 
-  if (ProblemeHebdo->ReinitOptimisation == OUI_ANTARES ) {	
+  if ( ReinitOptimisation == OUI_ANTARES ) {	
     if ( ProbSpx != NULL ) {
       SPX_LibererProbleme( ProbSpx );
       (ProblemeAResoudre->ProblemesSpxDUneClasseDeManoeuvrabilite[Classe])->ProblemeSpx[(int) NumIntervalle] = NULL;			
@@ -151,6 +154,16 @@ else {
 }
 
 
+if ( ProbSpx == NULL && ReinitOptimisation == OUI_ANTARES && PremierPassage == OUI_ANTARES
+     && ProblemeHebdo->DemarrageAChaudDuSimplexe == OUI_ANTARES && ProblemesSpx->PositionDeLaVariable[NumIntervalle] != NULL ) {
+	memcpy( ProblemeAResoudre->PositionDeLaVariable, ProblemesSpx->PositionDeLaVariable[NumIntervalle],
+	        ProblemeAResoudre->NombreDeVariables * sizeof( int ) );
+	memcpy( ProblemeAResoudre->ComplementDeLaBase, ProblemesSpx->ComplementDeLaBase[NumIntervalle],
+	        ProblemeAResoudre->NombreDeContraintes * sizeof( int ) );
+	NbVarDeBaseComplementaires   = ProblemesSpx->NbVarDeBaseComplementaires[NumIntervalle];
+	Probleme.BaseDeDepartFournie = OUI_SPX;
+}
+
 Probleme.NombreMaxDIterations = -1; 
 Probleme.DureeMaxDuCalcul     = -1.;
 
@@ -179,7 +192,7 @@ if (PremierPassage == OUI_ANTARES) Probleme.FaireDuScaling = OUI_SPX;
 Probleme.StrategieAntiDegenerescence = AGRESSIF;
 
 Probleme.PositionDeLaVariable       = ProblemeAResoudre->PositionDeLaVariable;
-Probleme.NbVarDeBaseComplementaires = 0; 
+Probleme.NbVarDeBaseComplementaires = NbVarDeBaseComplementaires; 
 Probleme.ComplementDeLaBase         = ProblemeAResoudre->ComplementDeLaBase;
 
 Probleme.LibererMemoireALaFin = NON_SPX;
@@ -200,10 +213,42 @@ Probleme.CoutsReduits                 = ProblemeAResoudre->CoutsReduits;
 Probleme.NombreDeContraintesCoupes = 0;
 
 
+if ( Mesure != NULL ) DebutDeResolution = OPT_TempsEnMillisecondes();
+
 ProbSpx = SPX_Simplexe( &Probleme , ProbSpx );
 
+if ( Mesure != NULL ) {
+	Mesure->TempsDeResolution += OPT_TempsEnMillisecondes() - DebutDeResolution;
+	Mesure->Scaling     = (Probleme.FaireDuScaling == OUI_SPX) ? OUI_ANTARES : NON_ANTARES;
+	Mesure->ModeSecours = (PremierPassage == NON_ANTARES) ? OUI_ANTARES : NON_ANTARES;
+}
+
 if ( ProbSpx != NULL ) {  
-	(ProblemeAResoudre->ProblemesSpxDUneClasseDeManoeuvrabilite[Classe])->ProblemeSpx[NumIntervalle] = (void *) ProbSpx;
+	ProblemesSpx->ProblemeSpx[NumIntervalle] = (void *) ProbSpx;
+
+	ProblemeHebdo->nombreDIterationsDuSimplexe[NumIntervalle] += ProbSpx->Iteration;
+	logs.debug().appendFormat(" Solver: interval %d, %d simplex iterations (%s)", NumIntervalle, ProbSpx->Iteration,
+	                          (Probleme.BaseDeDepartFournie == NON_SPX) ? "cold start" : "warm start");
+
+	/* Cumul sur les 2 passages en cas de reprise en mode secours */
+	if ( Mesure != NULL ) {
+		Mesure->NombreDIterations         += ProbSpx->Iteration;
+		Mesure->NombreDIterationsDePhase1 += ProbSpx->NombreDIterationsDePhase1;
+		Mesure->NombreDeFactorisations    += ProbSpx->NombreDeFactorisations;
+	}
+}
+
+if ( Probleme.ExistenceDUneSolution == OUI_SPX && ReinitOptimisation == OUI_ANTARES
+     && ProblemeHebdo->DemarrageAChaudDuSimplexe == OUI_ANTARES ) {
+	if ( ProblemesSpx->PositionDeLaVariable[NumIntervalle] == NULL ) {
+		ProblemesSpx->PositionDeLaVariable[NumIntervalle] = (int *) MemAlloc( ProblemeAResoudre->NombreDeVariables   * sizeof( int ) );
+		ProblemesSpx->ComplementDeLaBase[NumIntervalle]   = (int *) MemAlloc( ProblemeAResoudre->NombreDeContraintes * sizeof( int ) );
+	}
+	memcpy( ProblemesSpx->PositionDeLaVariable[NumIntervalle], ProblemeAResoudre->PositionDeLaVariable,
+	        ProblemeAResoudre->NombreDeVariables * sizeof( int ) );
+	memcpy( ProblemesSpx->ComplementDeLaBase[NumIntervalle], ProblemeAResoudre->ComplementDeLaBase,
+	        ProblemeAResoudre->NombreDeContraintes * sizeof( int ) );
+	ProblemesSpx->NbVarDeBaseComplementaires[NumIntervalle] = Probleme.NbVarDeBaseComplementaires;
 }
 
 if ( ProblemeHebdo->ExportMPS == OUI_ANTARES) OPT_EcrireJeuDeDonneesLineaireAuFormatMPS( (void *) &Probleme, numSpace, ANTARES_SIMPLEXE );
@@ -320,12 +365,11 @@ return true;
 
 
 
-bool OPT_AppelDuSolveurPne( PROBLEME_HEBDO * ProblemeHebdo, uint numSpace, int NumIntervalle )
+bool OPT_AppelDuSolveurPne( PROBLEME_HEBDO * ProblemeHebdo, PROBLEME_ANTARES_A_RESOUDRE * ProblemeAResoudre,
+                            uint numSpace, int NumIntervalle )
 {
-int Var; int Cnt; double * pt; int il; int ilMax; double CoutOpt; PROBLEME_ANTARES_A_RESOUDRE * ProblemeAResoudre;
-int * TypeEntierOuReel; PROBLEME_A_RESOUDRE ProblemePourPne; double u;
-
-ProblemeAResoudre = ProblemeHebdo->ProblemeAResoudre;
+int Var; int Cnt; double * pt; int il; int ilMax; double CoutOpt;
+int * TypeEntierOuReel; PROBLEME_A_RESOUDRE ProblemePourPne; double u; double Debut;
 
 TypeEntierOuReel = (int *) ProblemeAResoudre->CoutsReduits; 
 for ( Var = 0 ; Var < ProblemeAResoudre->NombreDeVariables ; Var++ ) TypeEntierOuReel[Var] = REEL;
@@ -369,8 +413,13 @@ ProblemePourPne.ToleranceDOptimalite         = 1.e-4;
 
 
 
+if ( ProblemeHebdo->TelemetrieDuSolveur != NULL ) Debut = OPT_TempsEnMillisecondes();
+
 PNE_Solveur( &ProblemePourPne );
 
+if ( ProblemeHebdo->TelemetrieDuSolveur != NULL )
+	ProblemeHebdo->TelemetrieDuSolveur->MesureDeLIntervalle[NumIntervalle].TempsDeResolution += OPT_TempsEnMillisecondes() - Debut;
+
 if ( ProblemeHebdo->ExportMPS == OUI_ANTARES) OPT_EcrireJeuDeDonneesLineaireAuFormatMPS( (void *) &ProblemePourPne, numSpace, ANTARES_PNE );
 
 ProblemeAResoudre->ExistenceDUneSolution = ProblemePourPne.ExistenceDUneSolution;
@@ -498,274 +547,3 @@ void OPT_EcrireResultatFonctionObjectiveAuFormatTXT(void * Prob, uint numSpace,
 
 	return;
 }
-
-
-
-void OPT_EcrireJeuDeDonneesLineaireAuFormatMPS( void * Prob, uint numSpace, char Type )
-{
-FILE * Flot; int Cnt; int Var; int il; int ilk; int ilMax; char * Nombre;
-int * Cder; int * Cdeb; int * NumeroDeContrainte; int * Csui; double CoutOpt;
-PROBLEME_SIMPLEXE * Probleme; PROBLEME_A_RESOUDRE * ProblemePourPne;
-
-
-int NombreDeVariables; int * TypeDeBorneDeLaVariable;
-double * Xmax; double * Xmin; double * CoutLineaire; int NombreDeContraintes;
-double * SecondMembre; char * Sens; int * IndicesDebutDeLigne;
-int * NombreDeTermesDesLignes;	double * CoefficientsDeLaMatriceDesContraintes;
-int * IndicesColonnes; int ExistenceDUneSolution; double * X;
-
-
-if ( Type == ANTARES_SIMPLEXE ) {
-  Probleme = (PROBLEME_SIMPLEXE *) Prob;
-
-  ExistenceDUneSolution	  = Probleme->ExistenceDUneSolution;            
-  if ( ExistenceDUneSolution == OUI_SPX ) ExistenceDUneSolution = OUI_ANTARES;	
-
-  NombreDeVariables       = Probleme->NombreDeVariables;
-  TypeDeBorneDeLaVariable = Probleme->TypeDeVariable;
-  Xmax                    = Probleme->Xmax;
-  Xmin                    = Probleme->Xmin;
-  X                       = Probleme->X;
-  CoutLineaire            = Probleme->CoutLineaire;
-  NombreDeContraintes                   = Probleme->NombreDeContraintes;
-  SecondMembre                          = Probleme->SecondMembre;
-  Sens                                  = Probleme->Sens;
-  IndicesDebutDeLigne                   = Probleme->IndicesDebutDeLigne;
-  NombreDeTermesDesLignes               = Probleme->NombreDeTermesDesLignes;
-  CoefficientsDeLaMatriceDesContraintes = Probleme->CoefficientsDeLaMatriceDesContraintes;
-  IndicesColonnes                       = Probleme->IndicesColonnes;
-}
-else {
-  
-  ProblemePourPne = (PROBLEME_A_RESOUDRE *) Prob;
-
-  ExistenceDUneSolution	  = ProblemePourPne->ExistenceDUneSolution;            
-  if ( ExistenceDUneSolution == SOLUTION_OPTIMALE_TROUVEE ) ExistenceDUneSolution = OUI_ANTARES;
-
-  NombreDeVariables       = ProblemePourPne->NombreDeVariables;
-  TypeDeBorneDeLaVariable = ProblemePourPne->TypeDeBorneDeLaVariable; 
-  Xmax                    = ProblemePourPne->Xmax;
-  Xmin                    = ProblemePourPne->Xmin;
-  X                       = ProblemePourPne->X;
-  CoutLineaire            = ProblemePourPne->CoutLineaire;
-  NombreDeContraintes                   = ProblemePourPne->NombreDeContraintes;
-  SecondMembre                          = ProblemePourPne->SecondMembre;
-  Sens                                  = ProblemePourPne->Sens;
-  IndicesDebutDeLigne                   = ProblemePourPne->IndicesDebutDeLigne;
-  NombreDeTermesDesLignes               = ProblemePourPne->NombreDeTermesDesLignes;
-  CoefficientsDeLaMatriceDesContraintes = ProblemePourPne->CoefficientsDeLaMatriceDesContraintes;
-  IndicesColonnes                       = ProblemePourPne->IndicesColonnes;	
-}
-
-
-if ( ExistenceDUneSolution == OUI_ANTARES ) {
-  CoutOpt = 0;
-	for ( Var = 0 ; Var < NombreDeVariables ; Var++ ) CoutOpt += CoutLineaire[Var] * X[Var];
-	
-}
-
-
-for ( ilMax = -1 , Cnt = 0 ; Cnt < NombreDeContraintes; Cnt++ ) {
-  if ( ( IndicesDebutDeLigne[Cnt] + NombreDeTermesDesLignes[Cnt] - 1 ) > ilMax ) {
-    ilMax = IndicesDebutDeLigne[Cnt] + NombreDeTermesDesLignes[Cnt] - 1;
-  }
-}
-ilMax+= NombreDeContraintes; 
-
-Cder               = (int *) malloc( NombreDeVariables * sizeof( int ) );
-Cdeb               = (int *) malloc( NombreDeVariables * sizeof( int ) );
-NumeroDeContrainte = (int *) malloc( ilMax             * sizeof( int ) );
-Csui               = (int *) malloc( ilMax             * sizeof( int ) );
-Nombre             = (char *) malloc( 1024 );
-if ( Cder == NULL || Cdeb == NULL || NumeroDeContrainte == NULL || Csui == NULL || Nombre == NULL ) {
-	logs.fatal() << "Not enough memory";
-	AntaresSolverEmergencyShutdown();
-}
-
-for ( Var = 0 ; Var < NombreDeVariables ; Var++ ) Cdeb[Var] = -1;
-for ( Cnt = 0 ; Cnt < NombreDeContraintes ; Cnt++ ) {
-  il    = IndicesDebutDeLigne[Cnt];
-  ilMax = il + NombreDeTermesDesLignes[Cnt];
-  while ( il < ilMax ) {
-    Var = IndicesColonnes[il];
-    if ( Cdeb[Var] < 0 ) {
-      Cdeb              [Var] = il;
-      NumeroDeContrainte[il]  = Cnt;
-      Csui              [il]  = -1;
-      Cder              [Var] = il;
-    }
-    else {
-      ilk                     = Cder[Var];
-      Csui              [ilk] = il;
-      NumeroDeContrainte[il]  = Cnt;
-      Csui              [il]  = -1;
-      Cder              [Var] = il;
-    }
-    il++;
-  }
-}
-free( Cder );
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-auto& study = *Data::Study::Current::Get();
-Flot = study.createMPSFileIntoOutput(numSpace);
-if (!Flot)
-	exit(2);
-
-
-fprintf(Flot,"* Number of variables:   %d\n",NombreDeVariables);
-fprintf(Flot,"* Number of constraints: %d\n",NombreDeContraintes);
-
-
-
-
-
-
-
-
-
-
-
-
-fprintf(Flot,"NAME          Pb Solve\n");
-
-
-fprintf(Flot,"ROWS\n");
-
-
-
-
-
-
-
-
-
-
-
-fprintf(Flot," N  OBJECTIF\n");
-
-for ( Cnt = 0 ; Cnt < NombreDeContraintes ; Cnt++ ) {
-  if ( Sens[Cnt] == '=' ) {
-    fprintf(Flot," E  R%07d\n",Cnt);
-  }
-  else if (  Sens[Cnt] == '<' ) {
-    fprintf(Flot," L  R%07d\n",Cnt);
-  }
-  else if (  Sens[Cnt] == '>' ) {
-    fprintf(Flot," G  R%07d\n",Cnt);
-  }
-  else {
-    fprintf(Flot,"PNE_EcrireJeuDeDonneesMPS : le sens de la contrainte %c ne fait pas partie des sens reconnus\n",
-            Sens[Cnt]);
-	AntaresSolverEmergencyShutdown(); 
-    exit(0);
-  }
-}
-
-
-fprintf(Flot,"COLUMNS\n");
-for ( Var = 0 ; Var < NombreDeVariables ; Var++ ) {
-  if ( CoutLineaire[Var] != 0.0 ) {
-    SNPRINTF(Nombre,1024,"%-.10lf",CoutLineaire[Var]);
-     
-    fprintf(Flot,"    C%07d  OBJECTIF  %s\n",Var,Nombre);
-  }
-  il = Cdeb[Var];
-  while ( il >= 0 ) {
-    SNPRINTF(Nombre,1024,"%-.10lf",CoefficientsDeLaMatriceDesContraintes[il]);
-     
-    fprintf(Flot,"    C%07d  R%07d  %s\n",Var,NumeroDeContrainte[il],Nombre);
-    il = Csui[il];
-  }
-}
-
-
-fprintf(Flot,"RHS\n");
-for ( Cnt = 0 ; Cnt < NombreDeContraintes ; Cnt++ ) {
-  if ( SecondMembre[Cnt] != 0.0 ) {
-    SNPRINTF(Nombre,1024,"%-.9lf",SecondMembre[Cnt]);
-     
-    fprintf(Flot,"    RHSVAL    R%07d  %s\n",Cnt,Nombre);
-  }
-}
-
-
-fprintf(Flot,"BOUNDS\n");
-
-
-
-
-
-
-
-
-
-
-
-
-for ( Var = 0 ; Var < NombreDeVariables ; Var++ ) {
-  if ( TypeDeBorneDeLaVariable[Var] == VARIABLE_FIXE ) {
-    SNPRINTF(Nombre,1024,"%-.9lf",Xmin[Var]);
-     
-    fprintf(Flot," FX BNDVALUE  C%07d  %s\n",Var,Nombre);
-    continue;
-  }
-  
-  
-  if ( TypeDeBorneDeLaVariable[Var] == VARIABLE_BORNEE_DES_DEUX_COTES ) {
-    if ( Xmin[Var] != 0.0 ) {
-      SNPRINTF(Nombre,1024,"%-.9lf",Xmin[Var]);
-       
-      fprintf(Flot," LO BNDVALUE  C%07d  %s\n",Var,Nombre);
-    }
-    SNPRINTF(Nombre,1024,"%-.9lf",Xmax[Var]);
-     
-    fprintf(Flot," UP BNDVALUE  C%07d  %s\n",Var,Nombre);
-  }
-  if ( TypeDeBorneDeLaVariable[Var] == VARIABLE_BORNEE_INFERIEUREMENT ) {
-    if ( Xmin[Var] != 0.0 ) {
-      SNPRINTF(Nombre,1024,"%-.9lf",Xmin[Var]);
-       
-      fprintf(Flot," LO BNDVALUE  C%07d  %s\n",Var,Nombre);
-    }
-  }
-  if ( TypeDeBorneDeLaVariable[Var] == VARIABLE_BORNEE_SUPERIEUREMENT ) {
-    fprintf(Flot," MI BNDVALUE  C%07d\n",Var);
-    if ( Xmax[Var] != 0.0 ) {
-      SNPRINTF(Nombre,1024,"%-.9lf",Xmax[Var]);
-       
-      fprintf(Flot," UP BNDVALUE  C%07d  %s\n",Var,Nombre);
-    }
-  }
-  if ( TypeDeBorneDeLaVariable[Var] == VARIABLE_NON_BORNEE ) {
-    fprintf(Flot," FR BNDVALUE  C%07d\n",Var);
-  }
-}
-
-
-fprintf(Flot,"ENDATA\n");
-
-free ( Cdeb );
-free ( NumeroDeContrainte );
-free ( Csui );
-free ( Nombre );
-
-fclose( Flot );
-
-return;
-}
@@ -1076,3 +1076,31 @@ void OPT_ConstruireLaMatriceDesContraintesDuProblemeLineaire(PROBLEME_HEBDO * Pr
 
 
 
+void OPT_ObtenirLaMatriceDesContraintesDuProblemeLineaire(PROBLEME_HEBDO * ProblemeHebdo, uint numSpace)
+{
+	PROBLEME_ANTARES_A_RESOUDRE * ProblemeAResoudre; double Debut; double Duree;
+
+	ProblemeAResoudre = ProblemeHebdo->ProblemeAResoudre;
+	Debut = OPT_TempsEnMillisecondes();
+
+	/* Les coefficients (poids et decalages des contraintes couplantes, rendement du pompage, tailles des
+	   groupes, ...) sont des donnees de l'etude : la matrice ne change qu'avec le nombre de pas de temps */
+	if (ProblemeAResoudre->NombreDePasDeTempsDeLaMatriceConstruite != ProblemeHebdo->NombreDePasDeTemps)
+	{
+		OPT_ConstruireLaMatriceDesContraintesDuProblemeLineaire(ProblemeHebdo, numSpace);
+		ProblemeAResoudre->NombreDePasDeTempsDeLaMatriceConstruite = ProblemeHebdo->NombreDePasDeTemps;
+
+		Duree = OPT_TempsEnMillisecondes() - Debut;
+		ProblemeAResoudre->NombreDeConstructionsDeLaMatrice++;
+		ProblemeAResoudre->TempsDeConstructionDeLaMatrice += Duree;
+	}
+	else
+	{
+		Duree = OPT_TempsEnMillisecondes() - Debut;
+		ProblemeAResoudre->NombreDeReutilisationsDeLaMatrice++;
+		ProblemeAResoudre->TempsDeReutilisationDeLaMatrice += Duree;
+	}
+
+	if (ProblemeHebdo->TelemetrieDuSolveur != NULL)
+		ProblemeHebdo->TelemetrieDuSolveur->TempsDeConstructionDeLaMatrice = Duree;
+}
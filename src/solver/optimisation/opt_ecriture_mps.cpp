@@ -0,0 +1,548 @@
+/*
+** Copyright 2007-2018 RTE
+** Authors: Antares_Simulator Team
+**
+** This file is part of Antares_Simulator.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** There are special exceptions to the terms and conditions of the
+** license as they are applied to this software. View the full text of
+** the exceptions in file COPYING.txt in the directory of this software
+** distribution
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with Antares_Simulator. If not, see <http://www.gnu.org/licenses/>.
+**
+** SPDX-License-Identifier: licenceRef-GPL3_WITH_RTE-Exceptions
+*/
+
+#include <yuni/yuni.h>
+#include <yuni/core/string.h>
+#include <yuni/job/job.h>
+#include <yuni/job/queue/service.h>
+#include <yuni/thread/signal.h>
+#include "opt_structure_probleme_a_resoudre.h"
+
+#include "../simulation/simulation.h"
+#include "../simulation/sim_structure_donnees.h"
+#include "../simulation/sim_structure_probleme_economique.h"
+#include "../simulation/sim_extern_variables_globales.h"
+
+#include "opt_fonctions.h"
+
+extern "C"
+{
+# include "../ext/Sirius_Solver/simplexe/spx_definition_arguments.h"
+# include "../ext/Sirius_Solver/simplexe/spx_fonctions.h"
+
+# include "../ext/Sirius_Solver/pne/pne_definition_arguments.h"
+# include "../ext/Sirius_Solver/pne/pne_fonctions.h"
+
+}
+
+#include <antares/logs.h>
+#include <antares/study.h>
+#include <antares/emergency.h>
+#include <cmath>
+#include <string.h>
+
+using namespace Antares;
+using namespace Yuni;
+
+# ifdef _MSC_VER
+#	define SNPRINTF sprintf_s
+# else
+#	define SNPRINTF snprintf
+# endif
+
+
+
+namespace // anonymous
+{
+
+	enum
+	{
+		//! Taille du tampon de formatage, ecrit dans le fichier lorsqu'il est plein
+		TailleDuTampon = 1024 * 1024,
+		//! Place reservee pour une ligne (un reel au format "%-.10lf" peut compter plus de 300 caracteres)
+		TailleMaximaleDUneLigne = 1024,
+		//! Volume maximal des jeux de donnees en attente d'ecriture
+		OctetsEnAttenteMaximum = 256 * 1024 * 1024,
+	};
+
+
+	/*!
+	** \brief Copie d'un probleme a exporter au format MPS
+	**
+	** Les termes de la matrice sont ranges ligne par ligne de facon contigue. Les tableaux
+	** du chainage par colonne sont alloues dans le meme bloc et remplis par l'ecrivain.
+	*/
+	struct JeuDeDonneesMPS final
+	{
+		FILE*   Flot;
+		size_t  Taille;
+		char*   Bloc;
+
+		int     NombreDeVariables;
+		int     NombreDeContraintes;
+		int     NombreDeTermes;
+
+		double* Xmin;
+		double* Xmax;
+		double* CoutLineaire;
+		double* SecondMembre;
+		double* Coefficients;
+		int*    TypeDeBorneDeLaVariable;
+		int*    IndicesDebutDeLigne;
+		int*    IndicesColonnes;
+		char*   Sens;
+
+		/* Chainage par colonne : les termes de la colonne Var sont DebutDeColonne[Var] ... DebutDeColonne[Var+1]-1 */
+		int*    DebutDeColonne;
+		int*    TermeDeLaColonne;
+	};
+
+
+	//! Volume des jeux de donnees en attente d'ecriture, protege par gMutex
+	static Yuni::Mutex gMutex;
+	static size_t gOctetsEnAttente = 0;
+	//! Notifie a la fin de chaque ecriture
+	static Yuni::Thread::Signal gEcritureTerminee;
+	//! L'ecrivain, demarre a la premiere exportation
+	static Yuni::Job::QueueService* gEcrivain = nullptr;
+
+
+
+	template<uint N>
+	static inline char* EcrireTexte(char* p, const char (&texte)[N])
+	{
+		memcpy(p, texte, N - 1);
+		return p + (N - 1);
+	}
+
+
+	//! Equivalent de "%07d" pour un indice positif
+	static inline char* EcrireIndice(char* p, int valeur)
+	{
+		char chiffres[16];
+		int n = 0;
+		do
+		{
+			chiffres[n++] = (char) ('0' + valeur % 10);
+			valeur /= 10;
+		}
+		while (valeur != 0);
+
+		for (int i = n; i < 7; ++i)
+			*p++ = '0';
+		while (n > 0)
+			*p++ = chiffres[--n];
+		return p;
+	}
+
+
+	/*!
+	** \brief Equivalent de "%-.<Decimales>lf"
+	**
+	** Les valeurs entieres (la grande majorite des coefficients et des bornes) sont ecrites directement,
+	** les autres par snprintf : le fichier reste identique caractere pour caractere.
+	*/
+	template<int Decimales>
+	static inline char* EcrireReel(char* p, double valeur)
+	{
+		if (std::fabs(valeur) < 1e15 and valeur == std::floor(valeur) and not (valeur == 0. and std::signbit(valeur)))
+		{
+			long long entier = (long long) valeur;
+			if (entier < 0)
+			{
+				*p++ = '-';
+				entier = -entier;
+			}
+			char chiffres[24];
+			int n = 0;
+			do
+			{
+				chiffres[n++] = (char) ('0' + entier % 10);
+				entier /= 10;
+			}
+			while (entier != 0);
+			while (n > 0)
+				*p++ = chiffres[--n];
+			*p++ = '.';
+			memset(p, '0', Decimales);
+			return p + Decimales;
+		}
+		return p + SNPRINTF(p, TailleMaximaleDUneLigne / 2, "%-.*f", Decimales, valeur);
+	}
+
+
+	class Tampon final
+	{
+	public:
+		explicit Tampon(FILE* flot) :
+			pFlot(flot),
+			pData((char*) malloc(TailleDuTampon)),
+			pFin(pData)
+		{
+			if (!pData)
+			{
+				logs.fatal() << "Not enough memory";
+				AntaresSolverEmergencyShutdown();
+			}
+		}
+
+		~Tampon()
+		{
+			vider();
+			free(pData);
+		}
+
+		//! Debut d'une ligne d'au plus TailleMaximaleDUneLigne caracteres
+		char* ligne()
+		{
+			if ((size_t) (pFin - pData) > (size_t) (TailleDuTampon - TailleMaximaleDUneLigne))
+				vider();
+			return pFin;
+		}
+
+		void fin(char* p)
+		{
+			*p++ = '\n';
+			pFin = p;
+		}
+
+		void vider()
+		{
+			if (pFin != pData)
+				fwrite(pData, 1, (size_t) (pFin - pData), pFlot);
+			pFin = pData;
+		}
+
+	private:
+		FILE* pFlot;
+		char* pData;
+		char* pFin;
+	};
+
+
+
+	static void EcrireLeJeuDeDonnees(JeuDeDonneesMPS& jeu)
+	{
+		int Cnt; int Var; int il; int ilMax; char * p;
+
+		/* Chainage par colonne, dans l'ordre croissant des contraintes */
+		int* DebutDeColonne = jeu.DebutDeColonne;
+		for ( Var = 0 ; Var <= jeu.NombreDeVariables ; Var++ ) DebutDeColonne[Var] = 0;
+		for ( il = 0 ; il < jeu.NombreDeTermes ; il++ ) DebutDeColonne[jeu.IndicesColonnes[il] + 1]++;
+		for ( Var = 0 ; Var < jeu.NombreDeVariables ; Var++ ) DebutDeColonne[Var + 1] += DebutDeColonne[Var];
+		for ( Cnt = 0 ; Cnt < jeu.NombreDeContraintes ; Cnt++ ) {
+			ilMax = jeu.IndicesDebutDeLigne[Cnt + 1];
+			for ( il = jeu.IndicesDebutDeLigne[Cnt] ; il < ilMax ; il++ )
+				jeu.TermeDeLaColonne[DebutDeColonne[jeu.IndicesColonnes[il]]++] = il;
+		}
+		/* DebutDeColonne[Var] est a present la fin de la colonne Var */
+		for ( Var = jeu.NombreDeVariables ; Var > 0 ; Var-- ) DebutDeColonne[Var] = DebutDeColonne[Var - 1];
+		DebutDeColonne[0] = 0;
+
+		/* Retrouver la contrainte d'un terme */
+		int* ContrainteDuTerme = jeu.IndicesColonnes;
+		for ( Cnt = 0 ; Cnt < jeu.NombreDeContraintes ; Cnt++ ) {
+			ilMax = jeu.IndicesDebutDeLigne[Cnt + 1];
+			for ( il = jeu.IndicesDebutDeLigne[Cnt] ; il < ilMax ; il++ ) ContrainteDuTerme[il] = Cnt;
+		}
+
+		Tampon tampon(jeu.Flot);
+
+		fprintf(jeu.Flot, "* Number of variables:   %d\n", jeu.NombreDeVariables);
+		fprintf(jeu.Flot, "* Number of constraints: %d\n", jeu.NombreDeContraintes);
+		fprintf(jeu.Flot, "NAME          Pb Solve\n");
+		fprintf(jeu.Flot, "ROWS\n");
+		fprintf(jeu.Flot, " N  OBJECTIF\n");
+
+		for ( Cnt = 0 ; Cnt < jeu.NombreDeContraintes ; Cnt++ ) {
+			p = tampon.ligne();
+			if ( jeu.Sens[Cnt] == '=' )      p = EcrireTexte(p, " E  R");
+			else if ( jeu.Sens[Cnt] == '<' ) p = EcrireTexte(p, " L  R");
+			else                             p = EcrireTexte(p, " G  R");
+			tampon.fin(EcrireIndice(p, Cnt));
+		}
+
+		tampon.fin(EcrireTexte(tampon.ligne(), "COLUMNS"));
+		for ( Var = 0 ; Var < jeu.NombreDeVariables ; Var++ ) {
+			if ( jeu.CoutLineaire[Var] != 0.0 ) {
+				p = EcrireIndice(EcrireTexte(tampon.ligne(), "    C"), Var);
+				p = EcrireTexte(p, "  OBJECTIF  ");
+				tampon.fin(EcrireReel<10>(p, jeu.CoutLineaire[Var]));
+			}
+			ilMax = DebutDeColonne[Var + 1];
+			for ( il = DebutDeColonne[Var] ; il < ilMax ; il++ ) {
+				int Terme = jeu.TermeDeLaColonne[il];
+				p = EcrireIndice(EcrireTexte(tampon.ligne(), "    C"), Var);
+				p = EcrireIndice(EcrireTexte(p, "  R"), ContrainteDuTerme[Terme]);
+				p = EcrireTexte(p, "  ");
+				tampon.fin(EcrireReel<10>(p, jeu.Coefficients[Terme]));
+			}
+		}
+
+		tampon.fin(EcrireTexte(tampon.ligne(), "RHS"));
+		for ( Cnt = 0 ; Cnt < jeu.NombreDeContraintes ; Cnt++ ) {
+			if ( jeu.SecondMembre[Cnt] != 0.0 ) {
+				p = EcrireIndice(EcrireTexte(tampon.ligne(), "    RHSVAL    R"), Cnt);
+				p = EcrireTexte(p, "  ");
+				tampon.fin(EcrireReel<9>(p, jeu.SecondMembre[Cnt]));
+			}
+		}
+
+		tampon.fin(EcrireTexte(tampon.ligne(), "BOUNDS"));
+		for ( Var = 0 ; Var < jeu.NombreDeVariables ; Var++ ) {
+			const int Type = jeu.TypeDeBorneDeLaVariable[Var];
+			const double Xmin = jeu.Xmin[Var];
+			const double Xmax = jeu.Xmax[Var];
+
+			if ( Type == VARIABLE_FIXE ) {
+				p = EcrireIndice(EcrireTexte(tampon.ligne(), " FX BNDVALUE  C"), Var);
+				tampon.fin(EcrireReel<9>(EcrireTexte(p, "  "), Xmin));
+				continue;
+			}
+			if ( Type == VARIABLE_BORNEE_DES_DEUX_COTES ) {
+				if ( Xmin != 0.0 ) {
+					p = EcrireIndice(EcrireTexte(tampon.ligne(), " LO BNDVALUE  C"), Var);
+					tampon.fin(EcrireReel<9>(EcrireTexte(p, "  "), Xmin));
+				}
+				p = EcrireIndice(EcrireTexte(tampon.ligne(), " UP BNDVALUE  C"), Var);
+				tampon.fin(EcrireReel<9>(EcrireTexte(p, "  "), Xmax));
+			}
+			if ( Type == VARIABLE_BORNEE_INFERIEUREMENT ) {
+				if ( Xmin != 0.0 ) {
+					p = EcrireIndice(EcrireTexte(tampon.ligne(), " LO BNDVALUE  C"), Var);
+					tampon.fin(EcrireReel<9>(EcrireTexte(p, "  "), Xmin));
+				}
+			}
+			if ( Type == VARIABLE_BORNEE_SUPERIEUREMENT ) {
+				tampon.fin(EcrireIndice(EcrireTexte(tampon.ligne(), " MI BNDVALUE  C"), Var));
+				if ( Xmax != 0.0 ) {
+					p = EcrireIndice(EcrireTexte(tampon.ligne(), " UP BNDVALUE  C"), Var);
+					tampon.fin(EcrireReel<9>(EcrireTexte(p, "  "), Xmax));
+				}
+			}
+			if ( Type == VARIABLE_NON_BORNEE ) {
+				tampon.fin(EcrireIndice(EcrireTexte(tampon.ligne(), " FR BNDVALUE  C"), Var));
+			}
+		}
+
+		tampon.fin(EcrireTexte(tampon.ligne(), "ENDATA"));
+	}
+
+
+	class EcritureMPSJob final : public Yuni::Job::IJob
+	{
+	public:
+		explicit EcritureMPSJob(JeuDeDonneesMPS* jeu) :
+			pJeu(jeu)
+		{}
+
+		virtual ~EcritureMPSJob()
+		{
+			free(pJeu->Bloc);
+			delete pJeu;
+		}
+
+	protected:
+		virtual void onExecute() override
+		{
+			EcrireLeJeuDeDonnees(*pJeu);
+			fclose(pJeu->Flot);
+
+			{
+				MutexLocker locker(gMutex);
+				gOctetsEnAttente -= pJeu->Taille;
+			}
+			gEcritureTerminee.notify();
+		}
+
+	private:
+		JeuDeDonneesMPS* pJeu;
+	};
+
+
+	template<class T>
+	static inline T* Decouper(char*& bloc, int nombre)
+	{
+		T* tableau = (T*) bloc;
+		bloc += (size_t) nombre * sizeof(T);
+		return tableau;
+	}
+
+
+	/*!
+	** \brief Reserve la place d'un jeu de donnees dans le volume en attente d'ecriture
+	**
+	** Un jeu plus gros que le volume maximal est accepte lorsqu'aucune ecriture n'est en cours.
+	*/
+	static void AttendreLaPlaceDisponible(size_t Taille)
+	{
+		for (;;)
+		{
+			{
+				MutexLocker locker(gMutex);
+				if (gOctetsEnAttente == 0 or gOctetsEnAttente + Taille <= (size_t) OctetsEnAttenteMaximum)
+				{
+					gOctetsEnAttente += Taille;
+					return;
+				}
+			}
+			gEcritureTerminee.waitAndReset();
+		}
+	}
+
+} // anonymous namespace
+
+
+
+
+/*
+** La copie du probleme est faite par le thread de resolution, le fichier y est cree (son nom
+** depend de l'annee et de la semaine courantes) et le formatage et l'ecriture sont laisses a l'ecrivain.
+*/
+void OPT_EcrireJeuDeDonneesLineaireAuFormatMPS( void * Prob, uint numSpace, char Type )
+{
+	int Cnt; int il; int Terme; int NombreDeTermes; FILE * Flot;
+	PROBLEME_SIMPLEXE * Probleme; PROBLEME_A_RESOUDRE * ProblemePourPne;
+	JeuDeDonneesMPS * Jeu;
+
+	int NombreDeVariables; int * TypeDeBorneDeLaVariable;
+	double * Xmax; double * Xmin; double * CoutLineaire; int NombreDeContraintes;
+	double * SecondMembre; char * Sens; int * IndicesDebutDeLigne;
+	int * NombreDeTermesDesLignes;	double * CoefficientsDeLaMatriceDesContraintes;
+	int * IndicesColonnes;
+
+	if ( Type == ANTARES_SIMPLEXE ) {
+		Probleme = (PROBLEME_SIMPLEXE *) Prob;
+
+		NombreDeVariables       = Probleme->NombreDeVariables;
+		TypeDeBorneDeLaVariable = Probleme->TypeDeVariable;
+		Xmax                    = Probleme->Xmax;
+		Xmin                    = Probleme->Xmin;
+		CoutLineaire            = Probleme->CoutLineaire;
+		NombreDeContraintes                   = Probleme->NombreDeContraintes;
+		SecondMembre                          = Probleme->SecondMembre;
+		Sens                                  = Probleme->Sens;
+		IndicesDebutDeLigne                   = Probleme->IndicesDebutDeLigne;
+		NombreDeTermesDesLignes               = Probleme->NombreDeTermesDesLignes;
+		CoefficientsDeLaMatriceDesContraintes = Probleme->CoefficientsDeLaMatriceDesContraintes;
+		IndicesColonnes                       = Probleme->IndicesColonnes;
+	}
+	else {
+		ProblemePourPne = (PROBLEME_A_RESOUDRE *) Prob;
+
+		NombreDeVariables       = ProblemePourPne->NombreDeVariables;
+		TypeDeBorneDeLaVariable = ProblemePourPne->TypeDeBorneDeLaVariable;
+		Xmax                    = ProblemePourPne->Xmax;
+		Xmin                    = ProblemePourPne->Xmin;
+		CoutLineaire            = ProblemePourPne->CoutLineaire;
+		NombreDeContraintes                   = ProblemePourPne->NombreDeContraintes;
+		SecondMembre                          = ProblemePourPne->SecondMembre;
+		Sens                                  = ProblemePourPne->Sens;
+		IndicesDebutDeLigne                   = ProblemePourPne->IndicesDebutDeLigne;
+		NombreDeTermesDesLignes               = ProblemePourPne->NombreDeTermesDesLignes;
+		CoefficientsDeLaMatriceDesContraintes = ProblemePourPne->CoefficientsDeLaMatriceDesContraintes;
+		IndicesColonnes                       = ProblemePourPne->IndicesColonnes;
+	}
+
+	for ( NombreDeTermes = 0 , Cnt = 0 ; Cnt < NombreDeContraintes ; Cnt++ ) {
+		if ( Sens[Cnt] != '=' && Sens[Cnt] != '<' && Sens[Cnt] != '>' ) {
+			logs.fatal() << "MPS export: the sense '" << Sens[Cnt] << "' of the constraint " << Cnt << " is not supported";
+			AntaresSolverEmergencyShutdown();
+			exit(0);
+		}
+		NombreDeTermes += NombreDeTermesDesLignes[Cnt];
+	}
+
+	Jeu = new JeuDeDonneesMPS;
+	Jeu->NombreDeVariables   = NombreDeVariables;
+	Jeu->NombreDeContraintes = NombreDeContraintes;
+	Jeu->NombreDeTermes      = NombreDeTermes;
+	Jeu->Taille = (size_t) (3 * NombreDeVariables + NombreDeContraintes + NombreDeTermes) * sizeof(double)
+		+ (size_t) (2 * NombreDeVariables + NombreDeContraintes + 2 * NombreDeTermes + 2) * sizeof(int)
+		+ (size_t) NombreDeContraintes;
+
+	AttendreLaPlaceDisponible( Jeu->Taille );
+
+	Jeu->Bloc = (char *) malloc( Jeu->Taille );
+	if ( Jeu->Bloc == NULL ) {
+		logs.fatal() << "Not enough memory";
+		AntaresSolverEmergencyShutdown();
+	}
+
+	/* Les reels en tete du bloc, pour leur alignement */
+	char * Bloc = Jeu->Bloc;
+	Jeu->Xmin                    = Decouper<double>( Bloc, NombreDeVariables );
+	Jeu->Xmax                    = Decouper<double>( Bloc, NombreDeVariables );
+	Jeu->CoutLineaire            = Decouper<double>( Bloc, NombreDeVariables );
+	Jeu->SecondMembre            = Decouper<double>( Bloc, NombreDeContraintes );
+	Jeu->Coefficients            = Decouper<double>( Bloc, NombreDeTermes );
+	Jeu->TypeDeBorneDeLaVariable = Decouper<int>( Bloc, NombreDeVariables );
+	Jeu->IndicesDebutDeLigne     = Decouper<int>( Bloc, NombreDeContraintes + 1 );
+	Jeu->IndicesColonnes         = Decouper<int>( Bloc, NombreDeTermes );
+	Jeu->DebutDeColonne          = Decouper<int>( Bloc, NombreDeVariables + 1 );
+	Jeu->TermeDeLaColonne        = Decouper<int>( Bloc, NombreDeTermes );
+	Jeu->Sens                    = Decouper<char>( Bloc, NombreDeContraintes );
+
+	memcpy( Jeu->Xmin, Xmin, NombreDeVariables * sizeof(double) );
+	memcpy( Jeu->Xmax, Xmax, NombreDeVariables * sizeof(double) );
+	memcpy( Jeu->CoutLineaire, CoutLineaire, NombreDeVariables * sizeof(double) );
+	memcpy( Jeu->SecondMembre, SecondMembre, NombreDeContraintes * sizeof(double) );
+	memcpy( Jeu->TypeDeBorneDeLaVariable, TypeDeBorneDeLaVariable, NombreDeVariables * sizeof(int) );
+	memcpy( Jeu->Sens, Sens, NombreDeContraintes * sizeof(char) );
+
+	for ( Terme = 0 , Cnt = 0 ; Cnt < NombreDeContraintes ; Cnt++ ) {
+		il = IndicesDebutDeLigne[Cnt];
+		Jeu->IndicesDebutDeLigne[Cnt] = Terme;
+		memcpy( Jeu->Coefficients + Terme, CoefficientsDeLaMatriceDesContraintes + il, NombreDeTermesDesLignes[Cnt] * sizeof(double) );
+		memcpy( Jeu->IndicesColonnes + Terme, IndicesColonnes + il, NombreDeTermesDesLignes[Cnt] * sizeof(int) );
+		Terme += NombreDeTermesDesLignes[Cnt];
+	}
+	Jeu->IndicesDebutDeLigne[NombreDeContraintes] = Terme;
+
+	auto& study = *Data::Study::Current::Get();
+	Flot = study.createMPSFileIntoOutput(numSpace);
+	if (!Flot)
+		exit(2);
+	Jeu->Flot = Flot;
+
+	MutexLocker locker(gMutex);
+	if (!gEcrivain)
+	{
+		gEcrivain = new Yuni::Job::QueueService();
+		gEcrivain->maximumThreadCount(1);
+		gEcrivain->start();
+	}
+	gEcrivain->add(new EcritureMPSJob(Jeu));
+}
+
+
+
+void OPT_AttendreLaFinDesEcrituresMPS()
+{
+	Yuni::Job::QueueService * Ecrivain;
+	{
+		MutexLocker locker(gMutex);
+		Ecrivain  = gEcrivain;
+		gEcrivain = nullptr;
+	}
+	if (Ecrivain)
+	{
+		Ecrivain->wait(Yuni::qseIdle);
+		Ecrivain->stop();
+		delete Ecrivain;
+	}
+}
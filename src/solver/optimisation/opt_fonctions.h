@@ -38,6 +38,7 @@ void OPT_NumeroDIntervalleOptimiseDuPasDeTemps( PROBLEME_HEBDO * );
 void OPT_ConstruireLaListeDesVariablesOptimiseesDuProblemeLineaire( PROBLEME_HEBDO * );
 void OPT_ConstruireLaListeDesVariablesOptimiseesDuProblemeQuadratique( PROBLEME_HEBDO * );
 void OPT_ConstruireLaMatriceDesContraintesDuProblemeLineaire( PROBLEME_HEBDO *, uint);
+void OPT_ObtenirLaMatriceDesContraintesDuProblemeLineaire( PROBLEME_HEBDO *, uint );
 void OPT_ConstruireLaMatriceDesContraintesDuProblemeQuadratique( PROBLEME_HEBDO * );
 void OPT_InitialiserLesPminHebdo( PROBLEME_HEBDO * );
 void OPT_InitialiserLesContrainteDEnergieHydrauliqueParIntervalleOptimise( PROBLEME_HEBDO * );
@@ -61,7 +62,7 @@ bool OPT_PilotageOptimisationQuadratique( PROBLEME_HEBDO * );
 **
 ** \return True si l'operation s'est bien deroulee, false si le probleme n'a pas de solution
 */
-bool OPT_AppelDuSolveurLineaire( PROBLEME_HEBDO *, uint, const int );
+bool OPT_AppelDuSolveurLineaire( PROBLEME_HEBDO *, PROBLEME_ANTARES_A_RESOUDRE *, uint, const int );
 void OPT_LiberationProblemesSimplexe( PROBLEME_HEBDO * );
 bool OPT_OptimisationLineaire( PROBLEME_HEBDO *, uint, CLASSE_DE_MANOEUVRABILITE, char, char, char );
 void OPT_SauvegarderLesPmaxThermiques( PROBLEME_HEBDO * );
@@ -88,8 +89,52 @@ void OPT_DecompteDesVariablesEtDesContraintesDuProblemeAOptimiser( PROBLEME_HEBD
 void OPT_AugmenterLaTailleDeLaMatriceDesContraintes(  PROBLEME_ANTARES_A_RESOUDRE * );
 void OPT_LiberationMemoireDuProblemeAOptimiser( PROBLEME_HEBDO * );
 
+/*!
+** \brief Resolution en parallele des intervalles optimises d'une semaine (optimisation au pas journalier)
+**
+** Chaque intervalle est prepare (bornes, second membre, couts) dans son propre probleme puis
+** les intervalles sont resolus simultanement, chacun dans son propre PROBLEME_SPX.
+** \return True si tous les intervalles ont une solution
+*/
+bool OPT_ResoudreLesIntervallesEnParallele( PROBLEME_HEBDO *, uint, int );
+void OPT_AllocDesProblemesDesIntervalles( PROBLEME_HEBDO *, int );
+void OPT_LiberationDesProblemesDesIntervalles( PROBLEME_ANTARES_A_RESOUDRE * );
+/*!
+** \brief Threads du probleme, laisses libres par les annees resolues en parallele
+**
+** Les threads sont demarres une fois pour toutes et attendent les taches de chaque semaine.
+** Aucun thread n'est cree pour un seul thread : les taches sont executees par le thread appelant.
+*/
+void OPT_AllocDesThreadsDuProbleme( PROBLEME_ANTARES_A_RESOUDRE *, int );
+void OPT_LiberationDesThreadsDuProbleme( PROBLEME_ANTARES_A_RESOUDRE * );
+
 void OPT_EcrireResultatFonctionObjectiveAuFormatTXT( void *, uint, int );
+/*!
+** \brief Horloge des mesures de l'optimisation (matrice des contraintes, telemetrie du solveur)
+*/
+double OPT_TempsEnMillisecondes();
+/*!
+** \brief Exportation des problemes au format MPS (option 'mps-export')
+**
+** Le probleme est copie par le thread de resolution puis ecrit par un ecrivain en arriere-plan ;
+** OPT_AttendreLaFinDesEcrituresMPS() attend que tous les fichiers soient complets : a la fin de la
+** simulation, et avant l'arret du programme lorsqu'une annee n'a pas de solution (le probleme sans
+** solution est exporte meme sans l'option).
+*/
 void OPT_EcrireJeuDeDonneesLineaireAuFormatMPS( void * , uint, char );
+void OPT_AttendreLaFinDesEcrituresMPS();
+
+/*!
+** \brief Telemetrie du solveur (option 'simplex-telemetry')
+**
+** Chaque resolution d'un intervalle (duree de preparation et de resolution, iterations, refactorisations,
+** scaling et mode secours) est mesuree dans ProblemeHebdo->TelemetrieDuSolveur, puis les mesures de
+** l'annee sont ajoutees au fichier 'simplex-telemetry.txt' du dossier de sortie.
+*/
+void OPT_InitialiserLaMesureDeLIntervalle( PROBLEME_HEBDO *, int, double );
+void OPT_EnregistrerLaMesureDeLIntervalle( PROBLEME_HEBDO *, uint, int, bool );
+bool OPT_CreerLeFichierDeTelemetrieDuSolveur();
+bool OPT_EcrireLaTelemetrieDuSolveur( PROBLEME_HEBDO * );
 
 /*------------------------------*/
 
@@ -49,6 +49,10 @@ extern "C"
 #include <antares/logs.h>
 #include <antares/study.h>
 #include <antares/emergency.h>
+#include <yuni/job/job.h>
+#include <yuni/job/queue/service.h>
+#include <atomic>
+#include <vector>
 
 using namespace Antares;
 using namespace Antares::Data;
@@ -66,21 +70,125 @@ void OPT_PbLineairePourAjusterLeNombreMinDeGroupesDemarresCoutsDeDemarrage( PROB
 
 
 
+namespace // anonymous
+{
+
+	/*!
+	** \brief Ajustement du nombre min de groupes demarres d'un palier (hors expansion)
+	**
+	** Seules les donnees du palier sont modifiees : bornes du nombre de groupes en marche, puissance
+	** disponible et nombres de groupes qui demarrent, s'arretent ou tombent en panne.
+	*/
+	void AjusterLeNombreMinDeGroupesDemarresDuPalier( PROBLEME_HEBDO * ProblemeHebdo, int Pays, int Index )
+	{
+		int PdtHebdo; int NombreDePasDeTempsProblemeHebdo; double X; double P; double Eps;
+
+		int * NombreMinDeGroupesEnMarcheDuPalierThermique;
+		int * NombreMaxDeGroupesEnMarcheDuPalierThermique;
+		double * PuissanceDisponibleDuPalierThermique;
+		double PminDUnGroupeDuPalierThermique;
+		double PmaxDUnGroupeDuPalierThermique;
+
+		PRODUCTION_THERMIQUE_OPTIMALE **      ProductionThermique; 
+		PDISP_ET_COUTS_HORAIRES_PAR_PALIER ** PuissanceDisponibleEtCout;
+		PALIERS_THERMIQUES *                  PaliersThermiquesDuPays;
+
+		NombreDePasDeTempsProblemeHebdo = ProblemeHebdo->NombreDePasDeTemps;
+		Eps = 1.e-3;
+
+		ProductionThermique = ProblemeHebdo->ResultatsHoraires[Pays]->ProductionThermique;
+		PaliersThermiquesDuPays = ProblemeHebdo->PaliersThermiquesDuPays[Pays];
+		PuissanceDisponibleEtCout = PaliersThermiquesDuPays->PuissanceDisponibleEtCout;
+
+		NombreMinDeGroupesEnMarcheDuPalierThermique = PuissanceDisponibleEtCout[Index]->NombreMinDeGroupesEnMarcheDuPalierThermique;
+		NombreMaxDeGroupesEnMarcheDuPalierThermique = PuissanceDisponibleEtCout[Index]->NombreMaxDeGroupesEnMarcheDuPalierThermique;
+		PuissanceDisponibleDuPalierThermique = PuissanceDisponibleEtCout[Index]->PuissanceDisponibleDuPalierThermique;
+		PminDUnGroupeDuPalierThermique = PaliersThermiquesDuPays->PminDUnGroupeDuPalierThermique[Index];
+		PmaxDUnGroupeDuPalierThermique = PaliersThermiquesDuPays->PmaxDUnGroupeDuPalierThermique[Index];
+
+		for (PdtHebdo = 0; PdtHebdo < NombreDePasDeTempsProblemeHebdo; PdtHebdo++) 
+		{
+			X = ProductionThermique[PdtHebdo]->NombreDeGroupesEnMarcheDuPalier[Index];
+			if (X > NombreMaxDeGroupesEnMarcheDuPalierThermique[PdtHebdo] + Eps) {
+				logs.warning().appendFormat("Attention, AjusterLeNombreMinDeGroupesDemarresCoutsDeDemarrage: Pays %d palier dans le pays %d NombreDeGroupesEnMarche %e max %d", Pays, Index, X, NombreMaxDeGroupesEnMarcheDuPalierThermique[PdtHebdo]);
+			}
+			if (X < NombreMinDeGroupesEnMarcheDuPalierThermique[PdtHebdo] - Eps) {
+				logs.warning().appendFormat("Attention, AjusterLeNombreMinDeGroupesDemarresCoutsDeDemarrage: Pays %d palier dans le pays %d NombreDeGroupesEnMarche %e min %d", Pays, Index, X, NombreMinDeGroupesEnMarcheDuPalierThermique[PdtHebdo]);
+			}
+			P = ProductionThermique[PdtHebdo]->ProductionThermiqueDuPalier[Index];
+			if (P < X * PminDUnGroupeDuPalierThermique - Eps) {
+				logs.warning().appendFormat("Attention, AjusterLeNombreMinDeGroupesDemarresCoutsDeDemarrage: Pays %d palier dans le pays %d P %e < NbGroupe (%e) * PminGroupe (%e)", Pays, Index, P, X, PminDUnGroupeDuPalierThermique);
+			}
+			if (P > X * PmaxDUnGroupeDuPalierThermique + Eps) {
+				logs.warning().appendFormat("Attention, AjusterLeNombreMinDeGroupesDemarresCoutsDeDemarrage: Pays %d palier dans le pays %d P %e > NbGroupe (%e) * PmaxGroupe (%e)", Pays, Index, P, X, PmaxDUnGroupeDuPalierThermique);
+			}
+
+			NombreMinDeGroupesEnMarcheDuPalierThermique[PdtHebdo] = (int)ceil(X);
+
+		}
+
+		OPT_PbLineairePourAjusterLeNombreMinDeGroupesDemarresCoutsDeDemarrage(ProblemeHebdo, NombreMinDeGroupesEnMarcheDuPalierThermique,
+			Pays, Index);
+
+		for (PdtHebdo = 0; PdtHebdo < NombreDePasDeTempsProblemeHebdo; PdtHebdo++)
+		{
+			if (NombreMaxDeGroupesEnMarcheDuPalierThermique[PdtHebdo] < NombreMinDeGroupesEnMarcheDuPalierThermique[PdtHebdo]) 
+				NombreMaxDeGroupesEnMarcheDuPalierThermique[PdtHebdo] = NombreMinDeGroupesEnMarcheDuPalierThermique[PdtHebdo];
+
+			if (PminDUnGroupeDuPalierThermique * NombreMaxDeGroupesEnMarcheDuPalierThermique[PdtHebdo] > PuissanceDisponibleDuPalierThermique[PdtHebdo]) 
+				PuissanceDisponibleDuPalierThermique[PdtHebdo] = PminDUnGroupeDuPalierThermique * NombreMaxDeGroupesEnMarcheDuPalierThermique[PdtHebdo];
+		}
+	}
+
+
+	/*!
+	** \brief Ajustement des paliers en parallele, chaque job prend le palier suivant de la liste
+	*/
+	class PaliersJob final : public Yuni::Job::IJob
+	{
+	public:
+		PaliersJob(PROBLEME_HEBDO* problemeHebdo, const std::vector<std::pair<int, int> >& paliers,
+			std::atomic<uint>& suivant) :
+			pProblemeHebdo(problemeHebdo),
+			pPaliers(paliers),
+			pSuivant(suivant)
+		{}
+
+	protected:
+		virtual void onExecute() override
+		{
+			for (;;)
+			{
+				uint i = pSuivant++;
+				if (i >= (uint) pPaliers.size())
+					break;
+				AjusterLeNombreMinDeGroupesDemarresDuPalier(pProblemeHebdo, pPaliers[i].first, pPaliers[i].second);
+			}
+		}
+
+	private:
+		PROBLEME_HEBDO* pProblemeHebdo;
+		const std::vector<std::pair<int, int> >& pPaliers;
+		std::atomic<uint>& pSuivant;
+	};
+
+} // anonymous namespace
+
+
+
+
 void OPT_AjusterLeNombreMinDeGroupesDemarresCoutsDeDemarrage( PROBLEME_HEBDO * ProblemeHebdo )
 {
-	int Pays; int Index; int PdtHebdo; int NombreDePasDeTempsProblemeHebdo; double X;
+	int Pays; int Index; int PdtHebdo; int NombreDePasDeTempsProblemeHebdo; uint NombreDeThreads; uint i;
+	Yuni::Job::QueueService * Threads;
 
 	int * NombreMinDeGroupesEnMarcheDuPalierThermique;
-	int * NombreMaxDeGroupesEnMarcheDuPalierThermique;
 	double NombreDeGroupesEnMarcheDuPalier;
 
 	double * PuissanceDisponibleDuPalierThermique;
 	double * PuissanceMinDuPalierThermique;
 	double ProductionThermiqueDuPalier;
-	double PminDUnGroupeDuPalierThermique;
-	double PmaxDUnGroupeDuPalierThermique;
 	
-	double P; double Eps;
 	double eps_prodTherm = 1.0;
 	double eps_nbGroupes = 1.0;
 
@@ -88,12 +196,12 @@ void OPT_AjusterLeNombreMinDeGroupesDemarresCoutsDeDemarrage( PROBLEME_HEBDO * P
 	PRODUCTION_THERMIQUE_OPTIMALE **      ProductionThermique; 
 	PDISP_ET_COUTS_HORAIRES_PAR_PALIER ** PuissanceDisponibleEtCout;
 	PALIERS_THERMIQUES *                  PaliersThermiquesDuPays;
+	std::vector<std::pair<int, int> >     Paliers;
 
 	
 	if ( ProblemeHebdo->OptimisationAvecCoutsDeDemarrage == NON_ANTARES ) return;
 	
 	NombreDePasDeTempsProblemeHebdo = ProblemeHebdo->NombreDePasDeTemps;
-	Eps = 1.e-3;
 
 	for ( Pays = 0 ; Pays < ProblemeHebdo->NombreDePays; ++Pays)
 	{
@@ -108,7 +216,6 @@ void OPT_AjusterLeNombreMinDeGroupesDemarresCoutsDeDemarrage( PROBLEME_HEBDO * P
 			if (ProblemeHebdo->Expansion)
 			{
 				NombreMinDeGroupesEnMarcheDuPalierThermique = PuissanceDisponibleEtCout[Index]->NombreMinDeGroupesEnMarcheDuPalierThermique;
-				NombreMaxDeGroupesEnMarcheDuPalierThermique = PuissanceDisponibleEtCout[Index]->NombreMaxDeGroupesEnMarcheDuPalierThermique;
 
 				PuissanceDisponibleDuPalierThermique = PuissanceDisponibleEtCout[Index]->PuissanceDisponibleDuPalierThermique;
 				PuissanceMinDuPalierThermique = PuissanceDisponibleEtCout[Index]->PuissanceMinDuPalierThermique;
@@ -143,51 +250,34 @@ void OPT_AjusterLeNombreMinDeGroupesDemarresCoutsDeDemarrage( PROBLEME_HEBDO * P
 			}
 			else
 			{
-				NombreMinDeGroupesEnMarcheDuPalierThermique = PuissanceDisponibleEtCout[Index]->NombreMinDeGroupesEnMarcheDuPalierThermique;
-				NombreMaxDeGroupesEnMarcheDuPalierThermique = PuissanceDisponibleEtCout[Index]->NombreMaxDeGroupesEnMarcheDuPalierThermique;
-				PuissanceDisponibleDuPalierThermique = PuissanceDisponibleEtCout[Index]->PuissanceDisponibleDuPalierThermique;
-				PminDUnGroupeDuPalierThermique = PaliersThermiquesDuPays->PminDUnGroupeDuPalierThermique[Index];
-				PmaxDUnGroupeDuPalierThermique = PaliersThermiquesDuPays->PmaxDUnGroupeDuPalierThermique[Index];
-
-				for (PdtHebdo = 0; PdtHebdo < NombreDePasDeTempsProblemeHebdo; PdtHebdo++) 
-				{
-					X = ProductionThermique[PdtHebdo]->NombreDeGroupesEnMarcheDuPalier[Index];
-					if (X > NombreMaxDeGroupesEnMarcheDuPalierThermique[PdtHebdo] + Eps) {
-						printf("Attention, AjusterLeNombreMinDeGroupesDemarresCoutsDeDemarrage: \n");
-						printf("Pays %d palier dans le pays %d NombreDeGroupesEnMarche %e max %d\n", Pays, Index, X, NombreMaxDeGroupesEnMarcheDuPalierThermique[PdtHebdo]);
-					}
-					if (X < NombreMinDeGroupesEnMarcheDuPalierThermique[PdtHebdo] - Eps) {
-						printf("Attention, AjusterLeNombreMinDeGroupesDemarresCoutsDeDemarrage: \n");
-						printf("Pays %d palier dans le pays %d NombreDeGroupesEnMarche %e min %d\n", Pays, Index, X, NombreMinDeGroupesEnMarcheDuPalierThermique[PdtHebdo]);
-					}
-					P = ProductionThermique[PdtHebdo]->ProductionThermiqueDuPalier[Index];
-					if (P < X * PminDUnGroupeDuPalierThermique - Eps) {
-						printf("Attention, AjusterLeNombreMinDeGroupesDemarresCoutsDeDemarrage: \n");
-						printf("Pays %d palier dans le pays %d P %e < NbGroupe (%e) * PminGroupe (%e)\n", Pays, Index, P, X, PminDUnGroupeDuPalierThermique);
-					}
-					if (P > X * PmaxDUnGroupeDuPalierThermique + Eps) {
-						printf("Attention, AjusterLeNombreMinDeGroupesDemarresCoutsDeDemarrage: \n");
-						printf("Pays %d palier dans le pays %d P %e > NbGroupe (%e) * PmaxGroupe (%e)\n", Pays, Index, P, X, PmaxDUnGroupeDuPalierThermique);
-					}
-
-					NombreMinDeGroupesEnMarcheDuPalierThermique[PdtHebdo] = (int)ceil(X);
+				/* Les paliers sont independants, ils sont ajustes ensuite */
+				Paliers.push_back( std::make_pair( Pays, Index ) );
+			}
+																																					 
+		}
+	}
 
-				}
+	
+	/* Chaque palier ne modifie que ses propres donnees et resout son propre probleme simplexe :
+	   le resultat ne depend ni de l'ordre des paliers ni du nombre de threads */
+	Threads = (Yuni::Job::QueueService *) ProblemeHebdo->ProblemeAResoudre->ThreadsDuProbleme;
+	NombreDeThreads = (uint) ProblemeHebdo->NombreDeThreadsDesPaliers;
+	if ( NombreDeThreads > (uint) Paliers.size() ) NombreDeThreads = (uint) Paliers.size();
+
+	if ( NombreDeThreads <= 1 || !Threads ) {
+		for ( i = 0 ; i < (uint) Paliers.size() ; i++ )
+			AjusterLeNombreMinDeGroupesDemarresDuPalier( ProblemeHebdo, Paliers[i].first, Paliers[i].second );
+		return;
+	}
 
-				OPT_PbLineairePourAjusterLeNombreMinDeGroupesDemarresCoutsDeDemarrage(ProblemeHebdo, NombreMinDeGroupesEnMarcheDuPalierThermique,
-					Pays, Index);
+	/* Les threads du probleme sont deja demarres : seuls NombreDeThreads d'entre eux sont occupes */
+	{
+		std::atomic<uint> PalierSuivant(0);
 
-				for (PdtHebdo = 0; PdtHebdo < NombreDePasDeTempsProblemeHebdo; PdtHebdo++)
-				{
-					if (NombreMaxDeGroupesEnMarcheDuPalierThermique[PdtHebdo] < NombreMinDeGroupesEnMarcheDuPalierThermique[PdtHebdo]) 
-						NombreMaxDeGroupesEnMarcheDuPalierThermique[PdtHebdo] = NombreMinDeGroupesEnMarcheDuPalierThermique[PdtHebdo];
+		for ( i = 0 ; i < NombreDeThreads ; i++ )
+			Threads->add(new PaliersJob(ProblemeHebdo, Paliers, PalierSuivant));
 
-					if (PminDUnGroupeDuPalierThermique * NombreMaxDeGroupesEnMarcheDuPalierThermique[PdtHebdo] > PuissanceDisponibleDuPalierThermique[PdtHebdo]) 
-						PuissanceDisponibleDuPalierThermique[PdtHebdo] = PminDUnGroupeDuPalierThermique * NombreMaxDeGroupesEnMarcheDuPalierThermique[PdtHebdo];
-				}
-			}
-																																					 
-		}
+		Threads->wait(Yuni::qseIdle);
 	}
 
 	return;
@@ -58,6 +58,7 @@ bool OPT_OptimisationLineaire(  PROBLEME_HEBDO * ProblemeHebdo,
 {
 int PdtHebdo; int PremierPdtDeLIntervalle; int DernierPdtDeLIntervalle;
 int NumeroDeLIntervalle; int LongueurDuPasDeTemps  ; int NombreDePasDeTempsPourUneOptimisation;
+double DebutDeLInitialisation; bool Succes;
 
 LongueurDuPasDeTemps = (int) ClasseDeManoeuvrabilite;
 
@@ -89,17 +90,28 @@ OPT_ConstruireLaListeDesVariablesOptimiseesDuProblemeLineaire( ProblemeHebdo );
 
 
 
-OPT_ConstruireLaMatriceDesContraintesDuProblemeLineaire( ProblemeHebdo, numSpace );
+OPT_ObtenirLaMatriceDesContraintesDuProblemeLineaire( ProblemeHebdo, numSpace );
 
 OptimisationHebdo:
 
-
+if ( (ProblemeHebdo->ProblemeAResoudre)->ProblemesDesIntervalles != NULL ) {
+	/* Optimisation au pas journalier : les intervalles sont independants, on les resout simultanement */
+	if ( !OPT_ResoudreLesIntervallesEnParallele( ProblemeHebdo, numSpace, NombreDePasDeTempsPourUneOptimisation ) ) {
+	  logs.debug().appendFormat("Flexibility level: %ld",
+	                            ProblemeHebdo->ClasseDeManoeuvrabiliteActive[
+															(ProblemeHebdo->ProblemeAResoudre)->NumeroDeClasseDeManoeuvrabiliteActiveEnCours
+															]);
+	  return false;
+	}
+}
+else
 for ( PdtHebdo = 0 , NumeroDeLIntervalle = 0 ; PdtHebdo < ProblemeHebdo->NombreDePasDeTemps;
       PdtHebdo = DernierPdtDeLIntervalle , NumeroDeLIntervalle++ ) {
 
 	PremierPdtDeLIntervalle = PdtHebdo;
 	DernierPdtDeLIntervalle = PdtHebdo + NombreDePasDeTempsPourUneOptimisation;
 
+	DebutDeLInitialisation = OPT_TempsEnMillisecondes();
 		
 	OPT_InitialiserLesBornesDesVariablesDuProblemeLineaire( ProblemeHebdo, PremierPdtDeLIntervalle, DernierPdtDeLIntervalle, NumeroDeLIntervalle );
 	
@@ -119,11 +131,15 @@ for ( PdtHebdo = 0 , NumeroDeLIntervalle = 0 ; PdtHebdo < ProblemeHebdo->NombreD
 
 	OPT_InitialiserLesCoutsLineaire( ProblemeHebdo, PremierPdtDeLIntervalle, DernierPdtDeLIntervalle, numSpace );
 
+	OPT_InitialiserLaMesureDeLIntervalle( ProblemeHebdo, NumeroDeLIntervalle, OPT_TempsEnMillisecondes() - DebutDeLInitialisation );
 	
 	ProblemeHebdo->numeroOptimisation[NumeroDeLIntervalle]++;
 	
 	
-	if (!OPT_AppelDuSolveurLineaire( ProblemeHebdo, numSpace, NumeroDeLIntervalle )) {
+	Succes = OPT_AppelDuSolveurLineaire( ProblemeHebdo, ProblemeHebdo->ProblemeAResoudre, numSpace, NumeroDeLIntervalle );
+	OPT_EnregistrerLaMesureDeLIntervalle( ProblemeHebdo, numSpace, NumeroDeLIntervalle, Succes );
+
+	if (!Succes) {
 	  logs.debug().appendFormat("Flexibility level: %ld",
 	                            ProblemeHebdo->ClasseDeManoeuvrabiliteActive[
 															(ProblemeHebdo->ProblemeAResoudre)->NumeroDeClasseDeManoeuvrabiliteActiveEnCours
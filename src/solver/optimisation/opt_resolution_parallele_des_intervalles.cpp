@@ -0,0 +1,299 @@
+/*
+** Copyright 2007-2018 RTE
+** Authors: Antares_Simulator Team
+**
+** This file is part of Antares_Simulator.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** There are special exceptions to the terms and conditions of the
+** license as they are applied to this software. View the full text of
+** the exceptions in file COPYING.txt in the directory of this software
+** distribution
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with Antares_Simulator. If not, see <http://www.gnu.org/licenses/>.
+**
+** SPDX-License-Identifier: licenceRef-GPL3_WITH_RTE-Exceptions
+*/
+
+# include "opt_structure_probleme_a_resoudre.h"
+
+# include "../simulation/simulation.h"
+# include "../simulation/sim_structure_donnees.h"
+# include "../simulation/sim_structure_probleme_economique.h"
+# include "../simulation/sim_extern_variables_globales.h"
+
+# include "opt_fonctions.h"
+
+#include <antares/logs.h>
+#include <yuni/job/job.h>
+#include <yuni/job/queue/service.h>
+#include <memory>
+
+using namespace Antares;
+using namespace Yuni;
+
+
+
+namespace // anonymous
+{
+
+	/*!
+	** \brief Resolution d'un intervalle optimise dans son propre probleme
+	*/
+	class IntervalleJob final : public Yuni::Job::IJob
+	{
+	public:
+		IntervalleJob(PROBLEME_HEBDO* problemeHebdo, PROBLEME_ANTARES_A_RESOUDRE* probleme,
+			uint numSpace, int numIntervalle, bool& succes) :
+			pProblemeHebdo(problemeHebdo),
+			pProbleme(probleme),
+			pNumSpace(numSpace),
+			pNumIntervalle(numIntervalle),
+			pSucces(succes)
+		{}
+
+	protected:
+		virtual void onExecute() override
+		{
+			pSucces = OPT_AppelDuSolveurLineaire(pProblemeHebdo, pProbleme, pNumSpace, pNumIntervalle);
+		}
+
+	private:
+		PROBLEME_HEBDO* pProblemeHebdo;
+		PROBLEME_ANTARES_A_RESOUDRE* pProbleme;
+		uint pNumSpace;
+		int pNumIntervalle;
+		bool& pSucces;
+	};
+
+
+	/*
+	** Le probleme d'un intervalle reprend toutes les donnees du probleme principal (matrice des contraintes,
+	** problemes simplexe, numero d'optimisation, ...) a l'exception de ses propres vecteurs.
+	** La matrice pouvant etre reallouee lors de sa construction, la synchronisation est faite a chaque resolution.
+	*/
+	void SynchroniserLeProblemeDeLIntervalle(const PROBLEME_ANTARES_A_RESOUDRE* ProblemeAResoudre,
+		PROBLEME_ANTARES_A_RESOUDRE* Intervalle)
+	{
+		PROBLEME_ANTARES_A_RESOUDRE Vecteurs = *Intervalle;
+
+		*Intervalle = *ProblemeAResoudre;
+
+		Intervalle->CoutLineaire   = Vecteurs.CoutLineaire;
+		Intervalle->TypeDeVariable = Vecteurs.TypeDeVariable;
+		Intervalle->Xmin           = Vecteurs.Xmin;
+		Intervalle->Xmax           = Vecteurs.Xmax;
+		Intervalle->X              = Vecteurs.X;
+		Intervalle->SecondMembre   = Vecteurs.SecondMembre;
+
+		Intervalle->AdresseOuPlacerLaValeurDesVariablesOptimisees = Vecteurs.AdresseOuPlacerLaValeurDesVariablesOptimisees;
+		Intervalle->AdresseOuPlacerLaValeurDesCoutsMarginaux      = Vecteurs.AdresseOuPlacerLaValeurDesCoutsMarginaux;
+		Intervalle->AdresseOuPlacerLaValeurDesCoutsReduits        = Vecteurs.AdresseOuPlacerLaValeurDesCoutsReduits;
+		Intervalle->CoutsMarginauxDesContraintes                  = Vecteurs.CoutsMarginauxDesContraintes;
+		Intervalle->CoutsReduits                                  = Vecteurs.CoutsReduits;
+
+		Intervalle->PositionDeLaVariable = Vecteurs.PositionDeLaVariable;
+		Intervalle->ComplementDeLaBase   = Vecteurs.ComplementDeLaBase;
+
+		Intervalle->NombreDeProblemesDesIntervalles = 0;
+		Intervalle->ProblemesDesIntervalles         = NULL;
+		Intervalle->ThreadsDuProbleme               = NULL;
+	}
+
+} // anonymous namespace
+
+
+
+
+void OPT_AllocDesProblemesDesIntervalles( PROBLEME_HEBDO * ProblemeHebdo, int NbIntervalles )
+{
+	int i; size_t szNbVarsDouble; size_t szNbVarsint; size_t szNbContDouble; size_t szNbContPtr;
+	PROBLEME_ANTARES_A_RESOUDRE * ProblemeAResoudre; PROBLEME_ANTARES_A_RESOUDRE * Intervalle;
+
+	ProblemeAResoudre = ProblemeHebdo->ProblemeAResoudre;
+
+	szNbVarsDouble = ProblemeAResoudre->NombreDeVariables   * sizeof(double);
+	szNbVarsint    = ProblemeAResoudre->NombreDeVariables   * sizeof(int);
+	szNbContDouble = ProblemeAResoudre->NombreDeContraintes * sizeof(double);
+	szNbContPtr    = ProblemeAResoudre->NombreDeContraintes * sizeof(void *);
+
+	ProblemeAResoudre->NombreDeProblemesDesIntervalles = NbIntervalles;
+	ProblemeAResoudre->ProblemesDesIntervalles = (void **) MemAlloc(NbIntervalles * sizeof(void *));
+
+	for (i = 0; i < NbIntervalles; ++i)
+	{
+		Intervalle = (PROBLEME_ANTARES_A_RESOUDRE *) MemAllocMemset(sizeof(PROBLEME_ANTARES_A_RESOUDRE));
+
+		Intervalle->CoutLineaire   = (double *) MemAlloc(szNbVarsDouble);
+		Intervalle->TypeDeVariable = (int *)    MemAlloc(szNbVarsint);
+		Intervalle->Xmin           = (double *) MemAlloc(szNbVarsDouble);
+		Intervalle->Xmax           = (double *) MemAlloc(szNbVarsDouble);
+		Intervalle->X              = (double *) MemAlloc(szNbVarsDouble);
+		Intervalle->SecondMembre   = (double *) MemAlloc(szNbContDouble);
+
+		Intervalle->AdresseOuPlacerLaValeurDesVariablesOptimisees = (double **) MemAlloc(ProblemeAResoudre->NombreDeVariables * sizeof(void *));
+		Intervalle->AdresseOuPlacerLaValeurDesCoutsReduits        = (double **) MemAlloc(ProblemeAResoudre->NombreDeVariables * sizeof(void *));
+		Intervalle->AdresseOuPlacerLaValeurDesCoutsMarginaux      = (double **) MemAlloc(szNbContPtr);
+		Intervalle->CoutsMarginauxDesContraintes                  = (double *)  MemAlloc(szNbContDouble);
+		Intervalle->CoutsReduits                                  = (double *)  MemAlloc(szNbVarsDouble);
+
+		Intervalle->PositionDeLaVariable = (int *) MemAlloc(ProblemeAResoudre->NombreDeVariables   * sizeof(int));
+		Intervalle->ComplementDeLaBase   = (int *) MemAlloc(ProblemeAResoudre->NombreDeContraintes * sizeof(int));
+
+		ProblemeAResoudre->ProblemesDesIntervalles[i] = (void *) Intervalle;
+	}
+}
+
+
+
+void OPT_LiberationDesProblemesDesIntervalles( PROBLEME_ANTARES_A_RESOUDRE * ProblemeAResoudre )
+{
+	int i; PROBLEME_ANTARES_A_RESOUDRE * Intervalle;
+
+	if (!ProblemeAResoudre->ProblemesDesIntervalles)
+		return;
+
+	for (i = 0; i < ProblemeAResoudre->NombreDeProblemesDesIntervalles; ++i)
+	{
+		Intervalle = (PROBLEME_ANTARES_A_RESOUDRE *) ProblemeAResoudre->ProblemesDesIntervalles[i];
+
+		MemFree(Intervalle->CoutLineaire);
+		MemFree(Intervalle->TypeDeVariable);
+		MemFree(Intervalle->Xmin);
+		MemFree(Intervalle->Xmax);
+		MemFree(Intervalle->X);
+		MemFree(Intervalle->SecondMembre);
+		MemFree(Intervalle->AdresseOuPlacerLaValeurDesVariablesOptimisees);
+		MemFree(Intervalle->AdresseOuPlacerLaValeurDesCoutsReduits);
+		MemFree(Intervalle->AdresseOuPlacerLaValeurDesCoutsMarginaux);
+		MemFree(Intervalle->CoutsMarginauxDesContraintes);
+		MemFree(Intervalle->CoutsReduits);
+		MemFree(Intervalle->PositionDeLaVariable);
+		MemFree(Intervalle->ComplementDeLaBase);
+		MemFree(Intervalle);
+	}
+	MemFree(ProblemeAResoudre->ProblemesDesIntervalles);
+
+	ProblemeAResoudre->NombreDeProblemesDesIntervalles = 0;
+	ProblemeAResoudre->ProblemesDesIntervalles = NULL;
+}
+
+
+
+void OPT_AllocDesThreadsDuProbleme( PROBLEME_ANTARES_A_RESOUDRE * ProblemeAResoudre, int NombreDeThreads )
+{
+	Yuni::Job::QueueService * Threads;
+
+	if (ProblemeAResoudre->ThreadsDuProbleme || NombreDeThreads < 2)
+		return;
+
+	Threads = new Yuni::Job::QueueService();
+	Threads->maximumThreadCount((uint) NombreDeThreads);
+	Threads->start();
+	ProblemeAResoudre->ThreadsDuProbleme = (void *) Threads;
+}
+
+
+
+void OPT_LiberationDesThreadsDuProbleme( PROBLEME_ANTARES_A_RESOUDRE * ProblemeAResoudre )
+{
+	Yuni::Job::QueueService * Threads;
+
+	Threads = (Yuni::Job::QueueService *) ProblemeAResoudre->ThreadsDuProbleme;
+	if (!Threads)
+		return;
+
+	Threads->stop();
+	delete Threads;
+	ProblemeAResoudre->ThreadsDuProbleme = NULL;
+}
+
+
+
+bool OPT_ResoudreLesIntervallesEnParallele( PROBLEME_HEBDO * ProblemeHebdo, uint numSpace,
+                                            int NombreDePasDeTempsPourUneOptimisation )
+{
+	int PdtHebdo; int PremierPdtDeLIntervalle; int DernierPdtDeLIntervalle; int NumeroDeLIntervalle;
+	int NbIntervalles; bool Succes; double DebutDeLInitialisation;
+	PROBLEME_ANTARES_A_RESOUDRE * ProblemeAResoudre; PROBLEME_ANTARES_A_RESOUDRE * Intervalle;
+	Yuni::Job::QueueService * Threads;
+
+	ProblemeAResoudre = ProblemeHebdo->ProblemeAResoudre;
+	NbIntervalles     = ProblemeAResoudre->NombreDeProblemesDesIntervalles;
+
+	// The status of each interval (std::vector<bool> can't be shared between threads)
+	std::unique_ptr<bool[]> succes(new bool[NbIntervalles]);
+
+	
+	// The initialization routines work on ProblemeHebdo->ProblemeAResoudre : each interval is
+	// prepared in turn into its own problem
+	for ( PdtHebdo = 0 , NumeroDeLIntervalle = 0 ; PdtHebdo < ProblemeHebdo->NombreDePasDeTemps;
+	      PdtHebdo = DernierPdtDeLIntervalle , NumeroDeLIntervalle++ ) {
+
+		PremierPdtDeLIntervalle = PdtHebdo;
+		DernierPdtDeLIntervalle = PdtHebdo + NombreDePasDeTempsPourUneOptimisation;
+
+		Intervalle = (PROBLEME_ANTARES_A_RESOUDRE *) ProblemeAResoudre->ProblemesDesIntervalles[NumeroDeLIntervalle];
+		SynchroniserLeProblemeDeLIntervalle( ProblemeAResoudre, Intervalle );
+
+		ProblemeHebdo->ProblemeAResoudre = Intervalle;
+
+		DebutDeLInitialisation = OPT_TempsEnMillisecondes();
+		OPT_InitialiserLesBornesDesVariablesDuProblemeLineaire( ProblemeHebdo, PremierPdtDeLIntervalle, DernierPdtDeLIntervalle, NumeroDeLIntervalle );
+		OPT_InitialiserLeSecondMembreDuProblemeLineaire( ProblemeHebdo, PremierPdtDeLIntervalle, DernierPdtDeLIntervalle, NumeroDeLIntervalle );
+		OPT_InitialiserLesCoutsLineaire( ProblemeHebdo, PremierPdtDeLIntervalle, DernierPdtDeLIntervalle, numSpace );
+		OPT_InitialiserLaMesureDeLIntervalle( ProblemeHebdo, NumeroDeLIntervalle, OPT_TempsEnMillisecondes() - DebutDeLInitialisation );
+
+		ProblemeHebdo->ProblemeAResoudre = ProblemeAResoudre;
+
+		ProblemeHebdo->numeroOptimisation[NumeroDeLIntervalle]++;
+	}
+
+	
+	// Each interval owns its slot ProblemeSpx[NumeroDeLIntervalle] and its results are
+	// written into distinct time steps : the resolutions are independent.
+	// Without any free core, the intervals are solved in turn by the calling thread
+	Threads = (Yuni::Job::QueueService *) ProblemeAResoudre->ThreadsDuProbleme;
+	for ( NumeroDeLIntervalle = 0 ; NumeroDeLIntervalle < NbIntervalles ; NumeroDeLIntervalle++ ) {
+		Intervalle = (PROBLEME_ANTARES_A_RESOUDRE *) ProblemeAResoudre->ProblemesDesIntervalles[NumeroDeLIntervalle];
+		if (Threads) {
+			succes[NumeroDeLIntervalle] = false;
+			Threads->add(new IntervalleJob(ProblemeHebdo, Intervalle, numSpace, NumeroDeLIntervalle, succes[NumeroDeLIntervalle]));
+		}
+		else
+			succes[NumeroDeLIntervalle] = OPT_AppelDuSolveurLineaire( ProblemeHebdo, Intervalle, numSpace, NumeroDeLIntervalle );
+	}
+	if (Threads)
+		Threads->wait(Yuni::qseIdle);
+
+	
+	// The measures are recorded in the order of the intervals, as in the sequential resolution
+	for ( NumeroDeLIntervalle = 0 ; NumeroDeLIntervalle < NbIntervalles ; NumeroDeLIntervalle++ )
+		OPT_EnregistrerLaMesureDeLIntervalle( ProblemeHebdo, numSpace, NumeroDeLIntervalle, succes[NumeroDeLIntervalle] );
+
+	Succes = true;
+	for ( NumeroDeLIntervalle = 0 ; NumeroDeLIntervalle < NbIntervalles ; NumeroDeLIntervalle++ ) {
+		Intervalle = (PROBLEME_ANTARES_A_RESOUDRE *) ProblemeAResoudre->ProblemesDesIntervalles[NumeroDeLIntervalle];
+		ProblemeAResoudre->ExistenceDUneSolution = Intervalle->ExistenceDUneSolution;
+		if (!succes[NumeroDeLIntervalle])
+		{
+			Succes = false;
+			break;
+		}
+
+		if (ProblemeHebdo->numeroOptimisation[NumeroDeLIntervalle] == DEUXIEME_OPTIMISATION)
+			ProblemeHebdo->numeroOptimisation[NumeroDeLIntervalle] = 0;
+	}
+
+	return Succes;
+}
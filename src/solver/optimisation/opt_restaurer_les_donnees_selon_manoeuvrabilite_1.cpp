@@ -61,6 +61,7 @@ void OPT_RestaurerLesDonneesSelonManoeuvrabilite_1( PROBLEME_HEBDO * ProblemeHeb
 	CONTRAINTES_COUPLANTES              * MatriceDesContraintesCouplantes;
 	COUTS_DE_TRANSPORT                  * CoutDeTransport;
 	int * NumeroDeJourDuPasDeTemps;
+	size_t TailleDesNTC;
 
 	
   DernierPasDeTemps = ProblemeHebdo->NombreDePasDeTemps;
@@ -68,15 +69,13 @@ void OPT_RestaurerLesDonneesSelonManoeuvrabilite_1( PROBLEME_HEBDO * ProblemeHeb
 	
 	
 	
-	for ( Pdt = 0 ; Pdt < DernierPasDeTemps ; Pdt++ ) {
-		ValeursDeNTCRef = ProblemeHebdo->ValeursDeNTCRef[Pdt];
-		ValeursDeNTC    = ProblemeHebdo->ValeursDeNTC[Pdt];		
-		for ( Interco = 0 ; Interco < ProblemeHebdo->NombreDInterconnexions ; Interco++ ) {
-			ValeursDeNTC->ValeurDeNTCOrigineVersExtremite[Interco] = ValeursDeNTCRef->ValeurDeNTCOrigineVersExtremite[Interco];
-			ValeursDeNTC->ValeurDeNTCExtremiteVersOrigine[Interco] = ValeursDeNTCRef->ValeurDeNTCExtremiteVersOrigine[Interco];
-			ValeursDeNTC->ValeurDeLoopFlowOrigineVersExtremite[Interco] = ValeursDeNTCRef->ValeurDeLoopFlowOrigineVersExtremite[Interco];
-		}
-	}
+	/* Les valeurs de tous les pas de temps sont contigues (cf. SIM_AllocationProblemeHebdo) */
+	TailleDesNTC    = DernierPasDeTemps * ProblemeHebdo->NombreDInterconnexions * sizeof( double );
+	ValeursDeNTCRef = ProblemeHebdo->ValeursDeNTCRef[0];
+	ValeursDeNTC    = ProblemeHebdo->ValeursDeNTC[0];
+	memcpy( (char *) ValeursDeNTC->ValeurDeNTCOrigineVersExtremite, (char *) ValeursDeNTCRef->ValeurDeNTCOrigineVersExtremite, TailleDesNTC );
+	memcpy( (char *) ValeursDeNTC->ValeurDeNTCExtremiteVersOrigine, (char *) ValeursDeNTCRef->ValeurDeNTCExtremiteVersOrigine, TailleDesNTC );
+	memcpy( (char *) ValeursDeNTC->ValeurDeLoopFlowOrigineVersExtremite, (char *) ValeursDeNTCRef->ValeurDeLoopFlowOrigineVersExtremite, TailleDesNTC );
 
 	if ( COUT_TRANSPORT == OUI_ANTARES ) {
 		
@@ -92,13 +91,10 @@ void OPT_RestaurerLesDonneesSelonManoeuvrabilite_1( PROBLEME_HEBDO * ProblemeHeb
 	}
 
 	
-	for ( Pdt = 0 ; Pdt < DernierPasDeTemps ; Pdt++ ) {
-		ConsommationsAbattuesRef = ProblemeHebdo->ConsommationsAbattuesRef[Pdt];
-		ConsommationsAbattues    = ProblemeHebdo->ConsommationsAbattues[Pdt];
-		for ( Pays = 0 ; Pays < ProblemeHebdo->NombreDePays ; Pays++ ) {
-			ConsommationsAbattues->ConsommationAbattueDuPays[Pays] = ConsommationsAbattuesRef->ConsommationAbattueDuPays[Pays];
-		}
-	}
+	ConsommationsAbattuesRef = ProblemeHebdo->ConsommationsAbattuesRef[0];
+	ConsommationsAbattues    = ProblemeHebdo->ConsommationsAbattues[0];
+	memcpy( (char *) ConsommationsAbattues->ConsommationAbattueDuPays, (char *) ConsommationsAbattuesRef->ConsommationAbattueDuPays,
+	        DernierPasDeTemps * ProblemeHebdo->NombreDePays * sizeof( double ) );
 	
   
 
@@ -64,6 +64,11 @@
 /* Les problemes Simplexe */
 typedef struct {
   void ** ProblemeSpx; /* Pour chaque classe de manoeuvrabilite, plusieurs problemes simplexe: 1 par jour */
+  /* Demarrage a chaud : base optimale de la premiere semaine de l'annee precedemment resolue sur le meme
+     numSpace, pour chaque intervalle (NULL tant qu'aucune base n'a ete sauvegardee) */
+  int ** PositionDeLaVariable;
+  int ** ComplementDeLaBase;
+  int *  NbVarDeBaseComplementaires;
 } PROBLEMES_SIMPLEXE;
 
 /* Le probleme a resoudre */
@@ -139,6 +144,24 @@ typedef struct {
 	/* Vecteurs de travail pour contruire la matrice des contraintes lineaires */
 	double * Pi;
 	int   * Colonne;
+
+	/* La matrice des contraintes ne depend que de la topologie de l'etude : elle n'est construite qu'une fois
+	   pour un nombre de pas de temps donne puis reutilisee d'une semaine (et d'une annee) a l'autre */
+	int     NombreDePasDeTempsDeLaMatriceConstruite; /* 0 si la matrice n'a pas encore ete construite */
+	int     NombreDeConstructionsDeLaMatrice;
+	int     NombreDeReutilisationsDeLaMatrice;
+	double  TempsDeConstructionDeLaMatrice;  /* en ms */
+	double  TempsDeReutilisationDeLaMatrice; /* en ms */
+
+	/* Resolution en parallele des intervalles optimises (optimisation au pas journalier) :
+	   1 probleme par intervalle, qui partage la matrice des contraintes du probleme principal
+	   mais possede ses propres bornes, couts, second membre et resultats */
+	int     NombreDeProblemesDesIntervalles;
+	void ** ProblemesDesIntervalles;
+
+	/* Threads du probleme (Yuni::Job::QueueService), crees avec le probleme et conserves jusqu'a sa
+	   liberation. NULL si le probleme n'a qu'un thread : les taches sont executees par le thread appelant */
+	void *  ThreadsDuProbleme;
 	
 } PROBLEME_ANTARES_A_RESOUDRE;
 
@@ -0,0 +1,176 @@
+/*
+** Copyright 2007-2018 RTE
+** Authors: Antares_Simulator Team
+**
+** This file is part of Antares_Simulator.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** There are special exceptions to the terms and conditions of the
+** license as they are applied to this software. View the full text of
+** the exceptions in file COPYING.txt in the directory of this software
+** distribution
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with Antares_Simulator. If not, see <http://www.gnu.org/licenses/>.
+**
+** SPDX-License-Identifier: licenceRef-GPL3_WITH_RTE-Exceptions
+*/
+
+#include <yuni/yuni.h>
+#include <yuni/core/string.h>
+#include <yuni/core/system/gettimeofday.h>
+#include "opt_structure_probleme_a_resoudre.h"
+
+#include "../simulation/simulation.h"
+#include "../simulation/sim_structure_donnees.h"
+#include "../simulation/sim_structure_probleme_economique.h"
+#include "../simulation/sim_extern_variables_globales.h"
+
+#include "opt_fonctions.h"
+
+#include <antares/logs.h>
+#include <antares/study.h>
+#include <antares/files/files.h>
+
+using namespace Antares;
+using namespace Yuni;
+
+#define SEP IO::Separator
+
+
+
+namespace // anonymous
+{
+
+	//! Les annees etant resolues en parallele, le fichier de sortie est partage
+	static Yuni::Mutex gMutex;
+
+	static const char* const NomDuFichierDeTelemetrie = "simplex-telemetry.txt";
+
+
+	static inline void FichierDeTelemetrie(String& out)
+	{
+		auto& study = *Data::Study::Current::Get();
+		out.clear() << study.folderOutput << SEP << NomDuFichierDeTelemetrie;
+	}
+
+} // anonymous namespace
+
+
+
+
+double OPT_TempsEnMillisecondes()
+{
+	Yuni::timeval tv;
+	YUNI_SYSTEM_GETTIMEOFDAY(&tv, NULL);
+	return tv.tv_sec * 1000. + tv.tv_usec / 1000.;
+}
+
+
+
+void OPT_InitialiserLaMesureDeLIntervalle( PROBLEME_HEBDO * ProblemeHebdo, int NumeroDeLIntervalle, double TempsDInitialisation )
+{
+	MESURE_DU_SOLVEUR * Mesure;
+
+	if ( ProblemeHebdo->TelemetrieDuSolveur == NULL ) return;
+
+	Mesure = &(ProblemeHebdo->TelemetrieDuSolveur->MesureDeLIntervalle[NumeroDeLIntervalle]);
+	memset( (char *) Mesure, 0, sizeof( MESURE_DU_SOLVEUR ) );
+	Mesure->TempsDInitialisation = TempsDInitialisation;
+	Mesure->Scaling              = NON_ANTARES;
+	Mesure->ModeSecours          = NON_ANTARES;
+	Mesure->Succes               = NON_ANTARES;
+}
+
+
+
+void OPT_EnregistrerLaMesureDeLIntervalle( PROBLEME_HEBDO * ProblemeHebdo, uint numSpace, int NumeroDeLIntervalle, bool Succes )
+{
+	TELEMETRIE_DU_SOLVEUR * Telemetrie; MESURE_DU_SOLVEUR * Mesure;
+
+	Telemetrie = ProblemeHebdo->TelemetrieDuSolveur;
+	if ( Telemetrie == NULL ) return;
+
+	if ( Telemetrie->NombreDeMesures == Telemetrie->NombreDeMesuresAllouees ) {
+		/* Une annee compte au moins 52 semaines de 2 optimisations */
+		Telemetrie->NombreDeMesuresAllouees = (Telemetrie->NombreDeMesuresAllouees == 0) ? 128 : 2 * Telemetrie->NombreDeMesuresAllouees;
+		Telemetrie->Mesures = (MESURE_DU_SOLVEUR *) MemRealloc( Telemetrie->Mesures,
+			Telemetrie->NombreDeMesuresAllouees * sizeof( MESURE_DU_SOLVEUR ) );
+	}
+
+	auto& study = *Data::Study::Current::Get();
+
+	Mesure = &(Telemetrie->Mesures[Telemetrie->NombreDeMesures]);
+	*Mesure = Telemetrie->MesureDeLIntervalle[NumeroDeLIntervalle];
+	Mesure->Annee                          = (int) study.runtime->currentYear[numSpace];
+	Mesure->Semaine                        = (int) study.runtime->weekInTheYear[numSpace];
+	Mesure->NumeroDeLIntervalle            = NumeroDeLIntervalle;
+	Mesure->NumeroDOptimisation            = ProblemeHebdo->numeroOptimisation[NumeroDeLIntervalle];
+	Mesure->TempsDeConstructionDeLaMatrice = Telemetrie->TempsDeConstructionDeLaMatrice;
+	Mesure->Succes                         = (Succes) ? OUI_ANTARES : NON_ANTARES;
+
+	Telemetrie->NombreDeMesures++;
+}
+
+
+
+bool OPT_CreerLeFichierDeTelemetrieDuSolveur()
+{
+	FILE * Flot; String Fichier;
+
+	FichierDeTelemetrie( Fichier );
+
+	MutexLocker locker(gMutex);
+	Flot = FileOpen( Fichier.c_str(), "wb" );
+	if ( Flot == NULL ) {
+		logs.error() << "I/O Error: Impossible to write `" << Fichier << "'";
+		return false;
+	}
+	/* Durees en ms ; la construction de la matrice est commune a tous les intervalles de la semaine */
+	fprintf( Flot, "year\tweek\tinterval\tpass\tmatrix\tsetup\tsolve\titerations\tphase1\trefactorizations\tscaling\tsafe\tsolved\n" );
+	fclose( Flot );
+	return true;
+}
+
+
+
+bool OPT_EcrireLaTelemetrieDuSolveur( PROBLEME_HEBDO * ProblemeHebdo )
+{
+	TELEMETRIE_DU_SOLVEUR * Telemetrie; MESURE_DU_SOLVEUR * Mesure; FILE * Flot; String Fichier; int i;
+
+	Telemetrie = ProblemeHebdo->TelemetrieDuSolveur;
+	if ( Telemetrie == NULL || Telemetrie->NombreDeMesures == 0 ) return true;
+
+	FichierDeTelemetrie( Fichier );
+
+	MutexLocker locker(gMutex);
+	Flot = FileOpen( Fichier.c_str(), "ab" );
+	if ( Flot == NULL ) {
+		logs.error() << "I/O Error: Impossible to write `" << Fichier << "'";
+		Telemetrie->NombreDeMesures = 0;
+		return false;
+	}
+
+	for ( i = 0 ; i < Telemetrie->NombreDeMesures ; i++ ) {
+		Mesure = &(Telemetrie->Mesures[i]);
+		fprintf( Flot, "%d\t%d\t%d\t%d\t%.3f\t%.3f\t%.3f\t%d\t%d\t%d\t%d\t%d\t%d\n",
+			Mesure->Annee + 1, Mesure->Semaine + 1, Mesure->NumeroDeLIntervalle + 1, Mesure->NumeroDOptimisation,
+			Mesure->TempsDeConstructionDeLaMatrice, Mesure->TempsDInitialisation, Mesure->TempsDeResolution,
+			Mesure->NombreDIterations, Mesure->NombreDIterationsDePhase1, Mesure->NombreDeFactorisations,
+			(Mesure->Scaling == OUI_ANTARES) ? 1 : 0, (Mesure->ModeSecours == OUI_ANTARES) ? 1 : 0,
+			(Mesure->Succes == OUI_ANTARES) ? 1 : 0 );
+	}
+	fclose( Flot );
+
+	Telemetrie->NombreDeMesures = 0;
+	return true;
+}
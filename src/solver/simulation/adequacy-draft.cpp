@@ -85,10 +85,11 @@ namespace Simulation
 		{pNbMaxPerformedYearsInParallel = nbMaxPerformedYearsInParallel;}
 
 
-	void AdequacyDraft::initializeState(Variable::State& state, uint )
+	void AdequacyDraft::initializeState(Variable::State& state, uint numSpace)
 	{
 		
 		state.simplexHasBeenRan = false;
+		state.problemeHoraireAdequation = &ProblemeHoraireAdequation[numSpace];
 	}
 
 
@@ -126,8 +127,8 @@ namespace Simulation
 			state.eensSystemIS = 0.;
 			state.eensSystemCN = 0.;
 
-			SIM_RenseignementProblemeHoraireAdequation(hour);
-			SIM_CalculFlotHoraireAdequation();
+			SIM_RenseignementProblemeHoraireAdequation(hour, numSpace);
+			SIM_CalculFlotHoraireAdequation(numSpace);
 
 			
 			variables.hourBegin(state.hourInTheYear);
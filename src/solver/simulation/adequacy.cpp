@@ -118,6 +118,9 @@ namespace Simulation
 			}
 
 			SIM_InitialisationResultats();
+
+			if (study.parameters.simplexTelemetry)
+				OPT_CreerLeFichierDeTelemetrieDuSolveur();
 		}
 
 		if (pProblemesHebdo)
@@ -176,6 +179,8 @@ namespace Simulation
 		state.startANewYear();
 		
 		int hourInTheYear = pStartTime;
+		
+		uint64 simplexIterations = 0;
 
 		for (uint w = 0; w != pNbWeeks; ++w)
 		{
@@ -228,6 +233,7 @@ namespace Simulation
 					
 					
 					failedWeek = w;
+					OPT_EcrireLaTelemetrieDuSolveur(pProblemesHebdo[numSpace]);
 					return false;
 				}
 
@@ -339,6 +345,9 @@ namespace Simulation
 			variables.weekForEachArea(state, numSpace);
 			variables.weekEnd(state);
 
+			for (int opt = 0; opt < 7; opt++)
+				simplexIterations += pProblemesHebdo[numSpace]->nombreDIterationsDuSimplexe[opt];
+
 			
 			hourInTheYear += nbHoursInAWeek;
 
@@ -348,6 +357,10 @@ namespace Simulation
 		
 		updatingAnnualFinalHydroLevel(study, *pProblemesHebdo[numSpace]);
 
+		OPT_EcrireLaTelemetrieDuSolveur(pProblemesHebdo[numSpace]);
+
+		logs.info() << "  Year " << (state.year + 1) << ": " << simplexIterations << " simplex iterations";
+
 		return true;
 	}
 
@@ -370,8 +383,11 @@ namespace Simulation
 		{
 			CallbackBalanceRetrieval callback;
 			callback.bind(this, &Adequacy::callbackRetrieveBalanceData);
-			PerformQuadraticOptimisation(study, *pProblemesHebdo[0], callback, pNbWeeks);
+			PerformQuadraticOptimisation(study, pProblemesHebdo, pNbMaxPerformedYearsInParallel, callback, pNbWeeks);
 		}
+
+		// The MPS files are written in the background
+		OPT_AttendreLaFinDesEcrituresMPS();
 	}
 
 
@@ -35,6 +35,10 @@
 #include <cassert>
 #include "simulation.h"
 #include "../aleatoire/alea_fonctions.h"
+#include <yuni/job/job.h>
+#include <yuni/job/queue/service.h>
+#include <antares/memory/memory.h>
+#include <vector>
 
 
 using namespace Yuni;
@@ -108,6 +112,67 @@ namespace Simulation
 
 
 
+	namespace // anonymous
+	{
+
+		//! Weekly problems available for the quadratic optimisation, one per thread
+		class QuadraticProblemPool final
+		{
+		public:
+			void push(PROBLEME_HEBDO* problem)
+			{
+				MutexLocker locker(pMutex);
+				pProblems.push_back(problem);
+			}
+
+			PROBLEME_HEBDO* pop()
+			{
+				MutexLocker locker(pMutex);
+				assert(not pProblems.empty() && "more jobs than weekly problems running");
+				auto* problem = pProblems.back();
+				pProblems.pop_back();
+				return problem;
+			}
+
+		private:
+			Mutex pMutex;
+			std::vector<PROBLEME_HEBDO*> pProblems;
+		};
+
+
+		class QuadraticOptimisationJob final : public Yuni::Job::IJob
+		{
+		public:
+			QuadraticOptimisationJob(Data::Study& study, QuadraticProblemPool& pool,
+				CallbackBalanceRetrieval& callback, int PasDeTempsDebut) :
+				study(study),
+				pool(pool),
+				callback(callback),
+				PasDeTempsDebut(PasDeTempsDebut)
+			{}
+
+		protected:
+			virtual void onExecute() override
+			{
+				// The weeks are independent : any weekly problem not in use can be reused
+				auto* problem = pool.pop();
+				RecalculDesEchangesMoyens(study, *problem, callback, PasDeTempsDebut);
+				pool.push(problem);
+			}
+
+		private:
+			Data::Study& study;
+			QuadraticProblemPool& pool;
+			CallbackBalanceRetrieval& callback;
+			int PasDeTempsDebut;
+		};
+
+	} // anonymous namespace
+
+
+
+
+
 	void PrepareDataFromClustersInMustrunMode(Data::Study& study, uint numSpace)
 	{
 		bool inAdequacy = (study.parameters.mode == Data::stdmAdequacy);
@@ -219,20 +284,54 @@ namespace Simulation
 	}
 
 
-	void PerformQuadraticOptimisation(Data::Study& study, PROBLEME_HEBDO& problem, CallbackBalanceRetrieval& callback, uint nbWeeks)
+	void PerformQuadraticOptimisation(Data::Study& study, PROBLEME_HEBDO** problems, uint nbSpaces,
+		CallbackBalanceRetrieval& callback, uint nbWeeks)
 	{
 		uint startTime = study.calendar.days[study.parameters.simulationDays.first].hours.first;
+		auto& problem = *problems[0];
 
 		if (ShouldUseQuadraticOptimisation(study))
 		{
 			logs.info() << "Post-processing... (quadratic optimisation)";
 
-			problem.TypeDOptimisation           = OPTIMISATION_QUADRATIQUE;
-			problem.LeProblemeADejaEteInstancie = NON_ANTARES;
-			for (uint w = 0; w != nbWeeks; ++w)
+			// The quadratic problem reuses the memory of the linear one : only the weekly
+			// problems of the spaces where MC years were performed can be used.
+			// The links data are flushed while reading, which is not thread-safe with the swap files.
+			QuadraticProblemPool pool;
+			uint nbProblems = 0;
+			for (uint numSpace = 0; numSpace != nbSpaces; ++numSpace)
+			{
+				if (not problems[numSpace]->ProblemeAResoudre)
+					continue;
+				problems[numSpace]->TypeDOptimisation           = OPTIMISATION_QUADRATIQUE;
+				problems[numSpace]->LeProblemeADejaEteInstancie = NON_ANTARES;
+				pool.push(problems[numSpace]);
+				if (++nbProblems == 1 && Antares::Memory::swapSupport)
+					break;
+			}
+
+			if (nbProblems <= 1)
+			{
+				for (uint w = 0; w != nbWeeks; ++w)
+				{
+					int PasDeTempsDebut = startTime + (w * problem.NombreDePasDeTemps);
+					RecalculDesEchangesMoyens(study, problem, callback, PasDeTempsDebut);
+				}
+			}
+			else
 			{
-				int PasDeTempsDebut = startTime + (w * problem.NombreDePasDeTemps);
-				RecalculDesEchangesMoyens(study, problem, callback, PasDeTempsDebut);
+				Yuni::Job::QueueService qs;
+				qs.maximumThreadCount(nbProblems);
+
+				for (uint w = 0; w != nbWeeks; ++w)
+				{
+					int PasDeTempsDebut = startTime + (w * problem.NombreDePasDeTemps);
+					qs.add(new QuadraticOptimisationJob(study, pool, callback, PasDeTempsDebut));
+				}
+
+				qs.start();
+				qs.wait(Yuni::qseIdle);
+				qs.stop();
 			}
 		}
 		else
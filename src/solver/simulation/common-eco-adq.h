@@ -86,8 +86,10 @@ namespace Simulation
 
 	/*!
 	** \brief Perform the quadratic optimization (links) (eco+adq)
+	**
+	** The weeks are optimized in parallel, each one on the weekly problem of a free space.
 	*/
-	void PerformQuadraticOptimisation(Data::Study& study, PROBLEME_HEBDO& problem,
+	void PerformQuadraticOptimisation(Data::Study& study, PROBLEME_HEBDO** problems, unsigned int nbSpaces,
 		CallbackBalanceRetrieval& callback, unsigned int nbWeeks);
 
 
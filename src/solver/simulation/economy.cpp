@@ -105,6 +105,9 @@ namespace Simulation
 			}
 
 			SIM_InitialisationResultats();
+
+			if (study.parameters.simplexTelemetry)
+				OPT_CreerLeFichierDeTelemetrieDuSolveur();
 		}
 
 		if (pProblemesHebdo)
@@ -135,6 +138,8 @@ namespace Simulation
 		state.startANewYear();
 		
 		int hourInTheYear = pStartTime;
+		
+		uint64 simplexIterations = 0;
 
 		for (uint w = 0; w != pNbWeeks; ++w)
 		{
@@ -151,6 +156,7 @@ namespace Simulation
 				
 				
 				failedWeek = w;
+				OPT_EcrireLaTelemetrieDuSolveur(pProblemesHebdo[numSpace]);
 				return false;
 			}
 
@@ -210,6 +216,7 @@ namespace Simulation
 			{
 				state.optimalSolutionCost1 += pProblemesHebdo[numSpace]->coutOptimalSolution1[opt];
 				state.optimalSolutionCost2 += pProblemesHebdo[numSpace]->coutOptimalSolution2[opt];
+				simplexIterations += pProblemesHebdo[numSpace]->nombreDIterationsDuSimplexe[opt];
 			}
 
 			
@@ -221,6 +228,10 @@ namespace Simulation
 		
 		updatingAnnualFinalHydroLevel(study, *pProblemesHebdo[numSpace]);
 
+		OPT_EcrireLaTelemetrieDuSolveur(pProblemesHebdo[numSpace]);
+
+		logs.info() << "  Year " << (state.year + 1) << ": " << simplexIterations << " simplex iterations";
+
 		return true;
 	}
 
@@ -243,8 +254,11 @@ namespace Simulation
 		{
 			CallbackBalanceRetrieval callback;
 			callback.bind(this, &Economy::callbackRetrieveBalanceData);
-			PerformQuadraticOptimisation(study, *pProblemesHebdo[0], callback, pNbWeeks);
+			PerformQuadraticOptimisation(study, pProblemesHebdo, pNbMaxPerformedYearsInParallel, callback, pNbWeeks);
 		}
+
+		// The MPS files are written in the background
+		OPT_AttendreLaFinDesEcrituresMPS();
 	}
 
 
@@ -61,7 +61,7 @@
 
 
 
-void SIM_AlgorithmeDeFlot()
+void SIM_AlgorithmeDeFlot(uint numSpace)
 {
 	double AugmentationDuFlot ; long   TestDeConvergence  ;
 	long   NoeudDestination   ; long   NoeudOrigine       ;
@@ -72,7 +72,7 @@ void SIM_AlgorithmeDeFlot()
 	auto& study = *Antares::Data::Study::Current::Get();
 	const unsigned int areaCount = study.areas.size();
 
-	pt             = &ProblemeHoraireAdequation;
+	pt             = &ProblemeHoraireAdequation[numSpace];
 
 	memset(pt->FluxDeSecours, 0 ,pt->NombreDElementsChainage * sizeof(double));
 	memset(pt->NTCDeReference,0 ,pt->NombreDElementsChainage * sizeof(double));
@@ -191,24 +191,18 @@ LOOP3:;
 			if (pt->ResultatsParPays[i]->Offre > 0)
 			{
 				
-				for(j = pt->PointeurSurIndices[i+1] ; j < pt->PointeurSurIndices[i+2]; j++)
-				{
-					if(pt->IndicesDesVoisins[j] == (long)areaCount + 1)
-						pt->ResultatsParPays[i]->MargeAvecReseau = pt->ResultatsParPays[i]->MargeHorsReseau - pt->FluxDeSecours[j];
-				}
+				j = pt->ArcVersLePuits[i];
+				if (j >= 0)
+					pt->ResultatsParPays[i]->MargeAvecReseau = pt->ResultatsParPays[i]->MargeHorsReseau - pt->FluxDeSecours[j];
 			}
 			if (pt->ResultatsParPays[i]->Offre < 0)
 			{
 				
-				for(j = pt->PointeurSurIndices[0] ; j < pt->PointeurSurIndices[1] ; j++)
-				{
-					if(pt->IndicesDesVoisins[j] == (i+1)) pt->ResultatsParPays[i]->MargeAvecReseau = pt->ResultatsParPays[i]->MargeHorsReseau + pt->FluxDeSecours[j];
-				}
+				j = pt->ArcDepuisLaSource[i];
+				pt->ResultatsParPays[i]->MargeAvecReseau = pt->ResultatsParPays[i]->MargeHorsReseau + pt->FluxDeSecours[j];
 			}
 		}
-		
-		ProblemeHoraireAdequation = *pt;
-		
+
 
 }
 
@@ -38,9 +38,32 @@
 using namespace Antares;
 
 
+
+/* 'nombre' structures contigues, et le tableau de pointeurs qui y mene */
+template<class S>
+static S** AllouerDesStructures(PROBLEME_HEBDO::Arene& arene, int nombre)
+{
+	S** pointeurs  = arene.allouer<S*>(nombre);
+	S*  structures = arene.allouer<S>(nombre);
+	for (int i = 0; i < nombre; ++i)
+		pointeurs[i] = structures + i;
+	return pointeurs;
+}
+
+
+/* Le champ de toutes les structures dans un seul bloc [structure][element] */
+template<class S, class T>
+static void RepartirLeChamp(PROBLEME_HEBDO::Arene& arene, S** structures, int nombre, T* S::* champ, uint nbElements)
+{
+	T* bloc = arene.allouer<T>((size_t) nombre * nbElements);
+	for (int i = 0; i < nombre; ++i)
+		structures[i]->*champ = bloc + (size_t) i * nbElements;
+}
+
+
 void SIM_AllocationProblemeHebdo(PROBLEME_HEBDO& problem, int NombreDePasDeTemps)
 {
-	int k; int  j;
+	int k;
 
 	
 	auto& study = *Data::Study::Current::Get();
@@ -100,15 +123,6 @@ void SIM_AllocationProblemeHebdo(PROBLEME_HEBDO& problem, int NombreDePasDeTemps
 	for (uint p = 0; p < nbPays; ++p)																			 
 		problem.NumeroDeVariableDeTrancheDeStock[p] = (int *)				  MemAlloc( 100    * sizeof(int) );  
 
-	problem.ValeursDeNTC                            = (VALEURS_DE_NTC_ET_RESISTANCES **)           MemAlloc( NombreDePasDeTemps * sizeof(void *) );
-	problem.ValeursDeNTCRef                         = (VALEURS_DE_NTC_ET_RESISTANCES **)           MemAlloc( NombreDePasDeTemps * sizeof(void *) );
-	problem.ConsommationsAbattues                   = (CONSOMMATIONS_ABATTUES **)                  MemAlloc( NombreDePasDeTemps * sizeof(void *) );
-	problem.ConsommationsAbattuesRef                = (CONSOMMATIONS_ABATTUES **)                  MemAlloc( NombreDePasDeTemps * sizeof(void *) );
-	problem.AllMustRunGeneration					= (ALL_MUST_RUN_GENERATION **)				   MemAlloc( NombreDePasDeTemps * sizeof(void *) );
-	problem.SoldeMoyenHoraire                       = (SOLDE_MOYEN_DES_ECHANGES **)                MemAlloc( NombreDePasDeTemps * sizeof(void *) );
-	problem.CorrespondanceVarNativesVarOptim        = (CORRESPONDANCES_DES_VARIABLES **)           MemAlloc( NombreDePasDeTemps * sizeof(void *) );
-	problem.CorrespondanceCntNativesCntOptim        = (CORRESPONDANCES_DES_CONTRAINTES **)         MemAlloc( NombreDePasDeTemps * sizeof(void *) );
-	problem.VariablesDualesDesContraintesDeNTC      = (VARIABLES_DUALES_INTERCONNEXIONS **)        MemAlloc( NombreDePasDeTemps * sizeof(void *) );
 	problem.MatriceDesContraintesCouplantes         = (CONTRAINTES_COUPLANTES **)                  MemAlloc( study.runtime->bindingConstraintCount * sizeof(void *) );
 	problem.PaliersThermiquesDuPays                 = (PALIERS_THERMIQUES **)                      MemAlloc( nbPays * sizeof(void *) );
 	problem.CaracteristiquesHydrauliques            = (ENERGIES_ET_PUISSANCES_HYDRAULIQUES **)     MemAlloc( nbPays * sizeof(void *) );
@@ -148,94 +162,92 @@ void SIM_AllocationProblemeHebdo(PROBLEME_HEBDO& problem, int NombreDePasDeTemps
 		problem.IndexDebutIntercoExtremite[p] = -1;
 	}
 
-	for (k = 0; k < NombreDePasDeTemps; k++)
+	/* Donnees par pas de temps : un bloc contigu [pas de temps][element] par champ, pris dans l'arene */
 	{
-		problem.ValeursDeNTC[k]                            = (VALEURS_DE_NTC_ET_RESISTANCES *)           MemAlloc( sizeof(VALEURS_DE_NTC_ET_RESISTANCES) );
-		problem.ValeursDeNTCRef[k]                         = (VALEURS_DE_NTC_ET_RESISTANCES *)           MemAlloc( sizeof(VALEURS_DE_NTC_ET_RESISTANCES) );
-		problem.ConsommationsAbattues[k]                   = (CONSOMMATIONS_ABATTUES *)                  MemAlloc( sizeof(CONSOMMATIONS_ABATTUES) );
-		problem.ConsommationsAbattuesRef[k]                = (CONSOMMATIONS_ABATTUES *)                  MemAlloc( sizeof(CONSOMMATIONS_ABATTUES) );
-		problem.AllMustRunGeneration[k]					   = (ALL_MUST_RUN_GENERATION *)				 MemAlloc( sizeof(ALL_MUST_RUN_GENERATION) );
-		problem.SoldeMoyenHoraire[k]                       = (SOLDE_MOYEN_DES_ECHANGES *)                MemAlloc( sizeof(SOLDE_MOYEN_DES_ECHANGES) );
-		problem.CorrespondanceVarNativesVarOptim[k]        = (CORRESPONDANCES_DES_VARIABLES *)           MemAlloc( sizeof(CORRESPONDANCES_DES_VARIABLES) );
-		problem.CorrespondanceCntNativesCntOptim[k]        = (CORRESPONDANCES_DES_CONTRAINTES *)         MemAlloc( sizeof(CORRESPONDANCES_DES_CONTRAINTES) );
-		problem.VariablesDualesDesContraintesDeNTC[k]      = (VARIABLES_DUALES_INTERCONNEXIONS *)        MemAlloc( sizeof(VARIABLES_DUALES_INTERCONNEXIONS) );
-		problem.ValeursDeNTC[k]->ResistanceApparente                      = (double *) MemAlloc( linkCount *  sizeof(double) );
-		problem.ValeursDeNTC[k]->ValeurDeNTCExtremiteVersOrigine          = (double *) MemAlloc( linkCount *  sizeof(double) );
-		problem.ValeursDeNTC[k]->ValeurDeNTCOrigineVersExtremite          = (double *) MemAlloc( linkCount *  sizeof(double) );
-		problem.ValeursDeNTC[k]->ValeurDeLoopFlowOrigineVersExtremite     = (double *) MemAlloc( linkCount *  sizeof(double) );
-		problem.ValeursDeNTC[k]->ValeurDuFlux                             = (double *) MemAlloc( linkCount *  sizeof(double) );
-		problem.ValeursDeNTC[k]->ValeurDuFluxUp							  = (double *) MemAlloc( linkCount *  sizeof(double) );
-		problem.ValeursDeNTC[k]->ValeurDuFluxDown						  = (double *) MemAlloc( linkCount *  sizeof(double) );
-		problem.ValeursDeNTCRef[k]->ResistanceApparente                   = (double *) MemAlloc( linkCount *  sizeof(double) );
-		problem.ValeursDeNTCRef[k]->ValeurDeNTCExtremiteVersOrigine       = (double *) MemAlloc( linkCount *  sizeof(double) );
-		problem.ValeursDeNTCRef[k]->ValeurDeLoopFlowOrigineVersExtremite  = (double *) MemAlloc( linkCount *  sizeof(double) );
-		problem.ValeursDeNTCRef[k]->ValeurDeNTCOrigineVersExtremite       = (double *) MemAlloc( linkCount *  sizeof(double) );
-		problem.ValeursDeNTCRef[k]->ValeurDuFlux                          = (double *) MemAlloc( linkCount *  sizeof(double) );
-		problem.ValeursDeNTCRef[k]->ValeurDuFluxUp						  = (double *) MemAlloc( linkCount *  sizeof(double) );
-		problem.ValeursDeNTCRef[k]->ValeurDuFluxDown					  = (double *) MemAlloc( linkCount *  sizeof(double) );
-		problem.ConsommationsAbattues[k]->ConsommationAbattueDuPays       = (double *) MemAlloc( nbPays *  sizeof(double) );
-		problem.ConsommationsAbattuesRef[k]->ConsommationAbattueDuPays    = (double *) MemAlloc( nbPays *  sizeof(double) );
-		problem.AllMustRunGeneration[k]->AllMustRunGenerationOfArea		  = (double *) MemAlloc( nbPays *  sizeof(double) );
-		problem.SoldeMoyenHoraire[k]->SoldeMoyenDuPays                    = (double *) MemAllocMemset( nbPays *                  sizeof(double) );
-
-		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDeLInterconnexion                         = (int *) MemAlloc( linkCount * sizeof(int) );
-		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableCoutOrigineVersExtremiteDeLInterconnexion = (int *) MemAlloc( linkCount * sizeof(int) );
-		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableCoutExtremiteVersOrigineDeLInterconnexion = (int *) MemAlloc( linkCount * sizeof(int) );
-
-		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDuPalierThermique                              = (int *)   MemAlloc( study.runtime->thermalPlantTotalCount * sizeof(int) );
-		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDuPalierThermiqueUp							= (int *)	MemAlloc( study.runtime->thermalPlantTotalCount * sizeof(int) );
-		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDuPalierThermiqueDown							= (int *)	MemAlloc( study.runtime->thermalPlantTotalCount * sizeof(int) );
-		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariablesDeLaProdHyd                                   = (int *)   MemAlloc( nbPays * sizeof(int) );
-		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariablesDeLaProdHydUp									= (int *)	MemAlloc( nbPays * sizeof(int) );
-		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariablesDeLaProdHydDown								= (int *)	MemAlloc( nbPays * sizeof(int) );
-		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariablesDePompage										= (int *)	MemAlloc( nbPays * sizeof(int) );
-		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariablesDeNiveau										= (int *)	MemAlloc( nbPays * sizeof(int) );
-		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariablesDeDebordement									= (int *)	MemAlloc( nbPays * sizeof(int) );
-		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDefaillancePositive                            = (int *)   MemAlloc( nbPays * sizeof(int) );
-		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDefaillancePositiveUp							= (int *)	MemAlloc( nbPays * sizeof(int) );
-		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDefaillancePositiveDown						= (int *)	MemAlloc( nbPays * sizeof(int) );
-		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDefaillancePositiveAny							= (int *)	MemAlloc( nbPays * sizeof(int) );
-		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDefaillanceNegative                            = (int *)   MemAlloc( nbPays * sizeof(int) );
-		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDefaillanceNegativeUp							= (int *)	MemAlloc( nbPays * sizeof(int) );
-		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDefaillanceNegativeDown						= (int *)	MemAlloc( nbPays * sizeof(int) );
-		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDefaillanceNegativeAny							= (int *)	MemAlloc( nbPays * sizeof(int) );
-		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeGrosseVariableDefaillancePositive                      = (int *)   MemAlloc( nbPays * sizeof(int) );
-		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeGrosseVariableDefaillanceNegative                      = (int *)   MemAlloc( nbPays * sizeof(int) );
-
-		
-		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDefaillanceEnReserve                           = (int *)   MemAlloc( nbPays * sizeof(int) );
-		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeGrosseVariableDefaillanceEnReserve                     = (int *)   MemAlloc( nbPays * sizeof(int) );
-		
-		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariablesVariationHydALaBaisse                         = (int *)   MemAlloc( nbPays * sizeof(int) );
-		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariablesVariationHydALaBaisseUp						= (int *)	MemAlloc( nbPays * sizeof(int) );
-		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariablesVariationHydALaBaisseDown						= (int *)	MemAlloc( nbPays * sizeof(int) );
-
-		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariablesVariationHydALaHausse                         = (int *)   MemAlloc( nbPays * sizeof(int) );
-		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariablesVariationHydALaHausseUp						= (int *)	MemAlloc( nbPays * sizeof(int) );
-		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariablesVariationHydALaHausseDown						= (int *)	MemAlloc( nbPays * sizeof(int) );
-		
-		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDuNombreDeGroupesEnMarcheDuPalierThermique     = (int *)   MemAlloc( study.runtime->thermalPlantTotalCount * sizeof(int) );
-		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDuNombreDeGroupesQuiDemarrentDuPalierThermique = (int *)   MemAlloc( study.runtime->thermalPlantTotalCount * sizeof(int) );
-		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDuNombreDeGroupesQuiSArretentDuPalierThermique = (int *)   MemAlloc( study.runtime->thermalPlantTotalCount * sizeof(int) );
-		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDuNombreDeGroupesQuiTombentEnPanneDuPalierThermique = (int *)   MemAlloc( study.runtime->thermalPlantTotalCount * sizeof(int) );
-
-		problem.CorrespondanceCntNativesCntOptim[k]->NumeroDeContrainteDesBilansPays                = (int *)   MemAlloc( nbPays * sizeof(int) );
-		problem.CorrespondanceCntNativesCntOptim[k]->NumeroDeContraintePourEviterLesChargesFictives = (int *)   MemAlloc( nbPays * sizeof(int) );
-		problem.CorrespondanceCntNativesCntOptim[k]->NumeroDeContrainteDesNiveauxPays				= (int *)	MemAlloc( nbPays * sizeof(int) );
-		
-
-
-		problem.CorrespondanceCntNativesCntOptim[k]->NumeroPremiereContrainteDeReserveParZone			= (int *)   MemAlloc( nbPays * sizeof(int) );
-		problem.CorrespondanceCntNativesCntOptim[k]->NumeroDeuxiemeContrainteDeReserveParZone			= (int *)   MemAlloc( nbPays * sizeof(int) );
-		problem.CorrespondanceCntNativesCntOptim[k]->NumeroDeContrainteDeDissociationDeFlux				= (int *)   MemAlloc( linkCount * sizeof(int) );
-		problem.CorrespondanceCntNativesCntOptim[k]->NumeroDeContrainteDesContraintesCouplantes			= (int *)   MemAlloc( study.runtime->bindingConstraintCount * sizeof(int) );
-
-		problem.CorrespondanceCntNativesCntOptim[k]->NumeroDeContrainteDesContraintesDeDureeMinDeMarche = (int *)   MemAlloc( study.runtime->thermalPlantTotalCount * sizeof(int) );
-		problem.CorrespondanceCntNativesCntOptim[k]->NumeroDeContrainteDesContraintesDeDureeMinDArret   = (int *)   MemAlloc( study.runtime->thermalPlantTotalCount * sizeof(int) );
-
-		problem.CorrespondanceCntNativesCntOptim[k]->NumeroDeLaDeuxiemeContrainteDesContraintesDesGroupesQuiTombentEnPanne = (int *) MemAlloc( study.runtime->thermalPlantTotalCount * sizeof(int) );
-		
-		problem.VariablesDualesDesContraintesDeNTC[k]->VariableDualeParInterconnexion                 = (double *) MemAlloc( linkCount *        sizeof(double) );
+		const uint nbPaliersTotal          = study.runtime->thermalPlantTotalCount;
+		const uint nbContraintesCouplantes = study.runtime->bindingConstraintCount;
+
+		problem.ValeursDeNTC = AllouerDesStructures<VALEURS_DE_NTC_ET_RESISTANCES>(problem.arene, NombreDePasDeTemps);
+		problem.ValeursDeNTCRef = AllouerDesStructures<VALEURS_DE_NTC_ET_RESISTANCES>(problem.arene, NombreDePasDeTemps);
+		problem.ConsommationsAbattues = AllouerDesStructures<CONSOMMATIONS_ABATTUES>(problem.arene, NombreDePasDeTemps);
+		problem.ConsommationsAbattuesRef = AllouerDesStructures<CONSOMMATIONS_ABATTUES>(problem.arene, NombreDePasDeTemps);
+		problem.AllMustRunGeneration = AllouerDesStructures<ALL_MUST_RUN_GENERATION>(problem.arene, NombreDePasDeTemps);
+		problem.SoldeMoyenHoraire = AllouerDesStructures<SOLDE_MOYEN_DES_ECHANGES>(problem.arene, NombreDePasDeTemps);
+		problem.CorrespondanceVarNativesVarOptim = AllouerDesStructures<CORRESPONDANCES_DES_VARIABLES>(problem.arene, NombreDePasDeTemps);
+		problem.CorrespondanceCntNativesCntOptim = AllouerDesStructures<CORRESPONDANCES_DES_CONTRAINTES>(problem.arene, NombreDePasDeTemps);
+		problem.VariablesDualesDesContraintesDeNTC = AllouerDesStructures<VARIABLES_DUALES_INTERCONNEXIONS>(problem.arene, NombreDePasDeTemps);
+
+		RepartirLeChamp(problem.arene, problem.ValeursDeNTC, NombreDePasDeTemps, &VALEURS_DE_NTC_ET_RESISTANCES::ResistanceApparente, linkCount);
+		RepartirLeChamp(problem.arene, problem.ValeursDeNTC, NombreDePasDeTemps, &VALEURS_DE_NTC_ET_RESISTANCES::ValeurDeNTCExtremiteVersOrigine, linkCount);
+		RepartirLeChamp(problem.arene, problem.ValeursDeNTC, NombreDePasDeTemps, &VALEURS_DE_NTC_ET_RESISTANCES::ValeurDeNTCOrigineVersExtremite, linkCount);
+		RepartirLeChamp(problem.arene, problem.ValeursDeNTC, NombreDePasDeTemps, &VALEURS_DE_NTC_ET_RESISTANCES::ValeurDeLoopFlowOrigineVersExtremite, linkCount);
+		RepartirLeChamp(problem.arene, problem.ValeursDeNTC, NombreDePasDeTemps, &VALEURS_DE_NTC_ET_RESISTANCES::ValeurDuFlux, linkCount);
+		RepartirLeChamp(problem.arene, problem.ValeursDeNTC, NombreDePasDeTemps, &VALEURS_DE_NTC_ET_RESISTANCES::ValeurDuFluxUp, linkCount);
+		RepartirLeChamp(problem.arene, problem.ValeursDeNTC, NombreDePasDeTemps, &VALEURS_DE_NTC_ET_RESISTANCES::ValeurDuFluxDown, linkCount);
+
+		RepartirLeChamp(problem.arene, problem.ValeursDeNTCRef, NombreDePasDeTemps, &VALEURS_DE_NTC_ET_RESISTANCES::ResistanceApparente, linkCount);
+		RepartirLeChamp(problem.arene, problem.ValeursDeNTCRef, NombreDePasDeTemps, &VALEURS_DE_NTC_ET_RESISTANCES::ValeurDeNTCExtremiteVersOrigine, linkCount);
+		RepartirLeChamp(problem.arene, problem.ValeursDeNTCRef, NombreDePasDeTemps, &VALEURS_DE_NTC_ET_RESISTANCES::ValeurDeLoopFlowOrigineVersExtremite, linkCount);
+		RepartirLeChamp(problem.arene, problem.ValeursDeNTCRef, NombreDePasDeTemps, &VALEURS_DE_NTC_ET_RESISTANCES::ValeurDeNTCOrigineVersExtremite, linkCount);
+		RepartirLeChamp(problem.arene, problem.ValeursDeNTCRef, NombreDePasDeTemps, &VALEURS_DE_NTC_ET_RESISTANCES::ValeurDuFlux, linkCount);
+		RepartirLeChamp(problem.arene, problem.ValeursDeNTCRef, NombreDePasDeTemps, &VALEURS_DE_NTC_ET_RESISTANCES::ValeurDuFluxUp, linkCount);
+		RepartirLeChamp(problem.arene, problem.ValeursDeNTCRef, NombreDePasDeTemps, &VALEURS_DE_NTC_ET_RESISTANCES::ValeurDuFluxDown, linkCount);
+
+		RepartirLeChamp(problem.arene, problem.ConsommationsAbattues, NombreDePasDeTemps, &CONSOMMATIONS_ABATTUES::ConsommationAbattueDuPays, nbPays);
+
+		RepartirLeChamp(problem.arene, problem.ConsommationsAbattuesRef, NombreDePasDeTemps, &CONSOMMATIONS_ABATTUES::ConsommationAbattueDuPays, nbPays);
+
+		RepartirLeChamp(problem.arene, problem.AllMustRunGeneration, NombreDePasDeTemps, &ALL_MUST_RUN_GENERATION::AllMustRunGenerationOfArea, nbPays);
+
+		RepartirLeChamp(problem.arene, problem.SoldeMoyenHoraire, NombreDePasDeTemps, &SOLDE_MOYEN_DES_ECHANGES::SoldeMoyenDuPays, nbPays);
+
+		RepartirLeChamp(problem.arene, problem.CorrespondanceVarNativesVarOptim, NombreDePasDeTemps, &CORRESPONDANCES_DES_VARIABLES::NumeroDeVariableDeLInterconnexion, linkCount);
+		RepartirLeChamp(problem.arene, problem.CorrespondanceVarNativesVarOptim, NombreDePasDeTemps, &CORRESPONDANCES_DES_VARIABLES::NumeroDeVariableCoutOrigineVersExtremiteDeLInterconnexion, linkCount);
+		RepartirLeChamp(problem.arene, problem.CorrespondanceVarNativesVarOptim, NombreDePasDeTemps, &CORRESPONDANCES_DES_VARIABLES::NumeroDeVariableCoutExtremiteVersOrigineDeLInterconnexion, linkCount);
+		RepartirLeChamp(problem.arene, problem.CorrespondanceVarNativesVarOptim, NombreDePasDeTemps, &CORRESPONDANCES_DES_VARIABLES::NumeroDeVariableDuPalierThermique, nbPaliersTotal);
+		RepartirLeChamp(problem.arene, problem.CorrespondanceVarNativesVarOptim, NombreDePasDeTemps, &CORRESPONDANCES_DES_VARIABLES::NumeroDeVariableDuPalierThermiqueUp, nbPaliersTotal);
+		RepartirLeChamp(problem.arene, problem.CorrespondanceVarNativesVarOptim, NombreDePasDeTemps, &CORRESPONDANCES_DES_VARIABLES::NumeroDeVariableDuPalierThermiqueDown, nbPaliersTotal);
+		RepartirLeChamp(problem.arene, problem.CorrespondanceVarNativesVarOptim, NombreDePasDeTemps, &CORRESPONDANCES_DES_VARIABLES::NumeroDeVariablesDeLaProdHyd, nbPays);
+		RepartirLeChamp(problem.arene, problem.CorrespondanceVarNativesVarOptim, NombreDePasDeTemps, &CORRESPONDANCES_DES_VARIABLES::NumeroDeVariablesDeLaProdHydUp, nbPays);
+		RepartirLeChamp(problem.arene, problem.CorrespondanceVarNativesVarOptim, NombreDePasDeTemps, &CORRESPONDANCES_DES_VARIABLES::NumeroDeVariablesDeLaProdHydDown, nbPays);
+		RepartirLeChamp(problem.arene, problem.CorrespondanceVarNativesVarOptim, NombreDePasDeTemps, &CORRESPONDANCES_DES_VARIABLES::NumeroDeVariablesDePompage, nbPays);
+		RepartirLeChamp(problem.arene, problem.CorrespondanceVarNativesVarOptim, NombreDePasDeTemps, &CORRESPONDANCES_DES_VARIABLES::NumeroDeVariablesDeNiveau, nbPays);
+		RepartirLeChamp(problem.arene, problem.CorrespondanceVarNativesVarOptim, NombreDePasDeTemps, &CORRESPONDANCES_DES_VARIABLES::NumeroDeVariablesDeDebordement, nbPays);
+		RepartirLeChamp(problem.arene, problem.CorrespondanceVarNativesVarOptim, NombreDePasDeTemps, &CORRESPONDANCES_DES_VARIABLES::NumeroDeVariableDefaillancePositive, nbPays);
+		RepartirLeChamp(problem.arene, problem.CorrespondanceVarNativesVarOptim, NombreDePasDeTemps, &CORRESPONDANCES_DES_VARIABLES::NumeroDeVariableDefaillancePositiveUp, nbPays);
+		RepartirLeChamp(problem.arene, problem.CorrespondanceVarNativesVarOptim, NombreDePasDeTemps, &CORRESPONDANCES_DES_VARIABLES::NumeroDeVariableDefaillancePositiveDown, nbPays);
+		RepartirLeChamp(problem.arene, problem.CorrespondanceVarNativesVarOptim, NombreDePasDeTemps, &CORRESPONDANCES_DES_VARIABLES::NumeroDeVariableDefaillancePositiveAny, nbPays);
+		RepartirLeChamp(problem.arene, problem.CorrespondanceVarNativesVarOptim, NombreDePasDeTemps, &CORRESPONDANCES_DES_VARIABLES::NumeroDeVariableDefaillanceNegative, nbPays);
+		RepartirLeChamp(problem.arene, problem.CorrespondanceVarNativesVarOptim, NombreDePasDeTemps, &CORRESPONDANCES_DES_VARIABLES::NumeroDeVariableDefaillanceNegativeUp, nbPays);
+		RepartirLeChamp(problem.arene, problem.CorrespondanceVarNativesVarOptim, NombreDePasDeTemps, &CORRESPONDANCES_DES_VARIABLES::NumeroDeVariableDefaillanceNegativeDown, nbPays);
+		RepartirLeChamp(problem.arene, problem.CorrespondanceVarNativesVarOptim, NombreDePasDeTemps, &CORRESPONDANCES_DES_VARIABLES::NumeroDeVariableDefaillanceNegativeAny, nbPays);
+		RepartirLeChamp(problem.arene, problem.CorrespondanceVarNativesVarOptim, NombreDePasDeTemps, &CORRESPONDANCES_DES_VARIABLES::NumeroDeGrosseVariableDefaillancePositive, nbPays);
+		RepartirLeChamp(problem.arene, problem.CorrespondanceVarNativesVarOptim, NombreDePasDeTemps, &CORRESPONDANCES_DES_VARIABLES::NumeroDeGrosseVariableDefaillanceNegative, nbPays);
+		RepartirLeChamp(problem.arene, problem.CorrespondanceVarNativesVarOptim, NombreDePasDeTemps, &CORRESPONDANCES_DES_VARIABLES::NumeroDeVariableDefaillanceEnReserve, nbPays);
+		RepartirLeChamp(problem.arene, problem.CorrespondanceVarNativesVarOptim, NombreDePasDeTemps, &CORRESPONDANCES_DES_VARIABLES::NumeroDeGrosseVariableDefaillanceEnReserve, nbPays);
+		RepartirLeChamp(problem.arene, problem.CorrespondanceVarNativesVarOptim, NombreDePasDeTemps, &CORRESPONDANCES_DES_VARIABLES::NumeroDeVariablesVariationHydALaBaisse, nbPays);
+		RepartirLeChamp(problem.arene, problem.CorrespondanceVarNativesVarOptim, NombreDePasDeTemps, &CORRESPONDANCES_DES_VARIABLES::NumeroDeVariablesVariationHydALaBaisseUp, nbPays);
+		RepartirLeChamp(problem.arene, problem.CorrespondanceVarNativesVarOptim, NombreDePasDeTemps, &CORRESPONDANCES_DES_VARIABLES::NumeroDeVariablesVariationHydALaBaisseDown, nbPays);
+		RepartirLeChamp(problem.arene, problem.CorrespondanceVarNativesVarOptim, NombreDePasDeTemps, &CORRESPONDANCES_DES_VARIABLES::NumeroDeVariablesVariationHydALaHausse, nbPays);
+		RepartirLeChamp(problem.arene, problem.CorrespondanceVarNativesVarOptim, NombreDePasDeTemps, &CORRESPONDANCES_DES_VARIABLES::NumeroDeVariablesVariationHydALaHausseUp, nbPays);
+		RepartirLeChamp(problem.arene, problem.CorrespondanceVarNativesVarOptim, NombreDePasDeTemps, &CORRESPONDANCES_DES_VARIABLES::NumeroDeVariablesVariationHydALaHausseDown, nbPays);
+		RepartirLeChamp(problem.arene, problem.CorrespondanceVarNativesVarOptim, NombreDePasDeTemps, &CORRESPONDANCES_DES_VARIABLES::NumeroDeVariableDuNombreDeGroupesEnMarcheDuPalierThermique, nbPaliersTotal);
+		RepartirLeChamp(problem.arene, problem.CorrespondanceVarNativesVarOptim, NombreDePasDeTemps, &CORRESPONDANCES_DES_VARIABLES::NumeroDeVariableDuNombreDeGroupesQuiDemarrentDuPalierThermique, nbPaliersTotal);
+		RepartirLeChamp(problem.arene, problem.CorrespondanceVarNativesVarOptim, NombreDePasDeTemps, &CORRESPONDANCES_DES_VARIABLES::NumeroDeVariableDuNombreDeGroupesQuiSArretentDuPalierThermique, nbPaliersTotal);
+		RepartirLeChamp(problem.arene, problem.CorrespondanceVarNativesVarOptim, NombreDePasDeTemps, &CORRESPONDANCES_DES_VARIABLES::NumeroDeVariableDuNombreDeGroupesQuiTombentEnPanneDuPalierThermique, nbPaliersTotal);
+
+		RepartirLeChamp(problem.arene, problem.CorrespondanceCntNativesCntOptim, NombreDePasDeTemps, &CORRESPONDANCES_DES_CONTRAINTES::NumeroDeContrainteDesBilansPays, nbPays);
+		RepartirLeChamp(problem.arene, problem.CorrespondanceCntNativesCntOptim, NombreDePasDeTemps, &CORRESPONDANCES_DES_CONTRAINTES::NumeroDeContraintePourEviterLesChargesFictives, nbPays);
+		RepartirLeChamp(problem.arene, problem.CorrespondanceCntNativesCntOptim, NombreDePasDeTemps, &CORRESPONDANCES_DES_CONTRAINTES::NumeroDeContrainteDesNiveauxPays, nbPays);
+		RepartirLeChamp(problem.arene, problem.CorrespondanceCntNativesCntOptim, NombreDePasDeTemps, &CORRESPONDANCES_DES_CONTRAINTES::NumeroPremiereContrainteDeReserveParZone, nbPays);
+		RepartirLeChamp(problem.arene, problem.CorrespondanceCntNativesCntOptim, NombreDePasDeTemps, &CORRESPONDANCES_DES_CONTRAINTES::NumeroDeuxiemeContrainteDeReserveParZone, nbPays);
+		RepartirLeChamp(problem.arene, problem.CorrespondanceCntNativesCntOptim, NombreDePasDeTemps, &CORRESPONDANCES_DES_CONTRAINTES::NumeroDeContrainteDeDissociationDeFlux, linkCount);
+		RepartirLeChamp(problem.arene, problem.CorrespondanceCntNativesCntOptim, NombreDePasDeTemps, &CORRESPONDANCES_DES_CONTRAINTES::NumeroDeContrainteDesContraintesCouplantes, nbContraintesCouplantes);
+		RepartirLeChamp(problem.arene, problem.CorrespondanceCntNativesCntOptim, NombreDePasDeTemps, &CORRESPONDANCES_DES_CONTRAINTES::NumeroDeContrainteDesContraintesDeDureeMinDeMarche, nbPaliersTotal);
+		RepartirLeChamp(problem.arene, problem.CorrespondanceCntNativesCntOptim, NombreDePasDeTemps, &CORRESPONDANCES_DES_CONTRAINTES::NumeroDeContrainteDesContraintesDeDureeMinDArret, nbPaliersTotal);
+		RepartirLeChamp(problem.arene, problem.CorrespondanceCntNativesCntOptim, NombreDePasDeTemps, &CORRESPONDANCES_DES_CONTRAINTES::NumeroDeLaDeuxiemeContrainteDesContraintesDesGroupesQuiTombentEnPanne, nbPaliersTotal);
+
+		RepartirLeChamp(problem.arene, problem.VariablesDualesDesContraintesDeNTC, NombreDePasDeTemps, &VARIABLES_DUALES_INTERCONNEXIONS::VariableDualeParInterconnexion, linkCount);
 	}
 
 	for (k = 0 ; k < (int) linkCount ; ++k) {
@@ -363,42 +375,42 @@ void SIM_AllocationProblemeHebdo(PROBLEME_HEBDO& problem, int NombreDePasDeTemps
 		problem.ResultatsHoraires[k]->niveauxHoraires						= (double *) MemAlloc( NombreDePasDeTemps * sizeof(double) );
 		problem.ResultatsHoraires[k]->valeurH2oHoraire						= (double *) MemAlloc( NombreDePasDeTemps * sizeof(double) );
 		problem.ResultatsHoraires[k]->debordementsHoraires					= (double *) MemAlloc( NombreDePasDeTemps * sizeof(double) );
-		problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout       = (PDISP_ET_COUTS_HORAIRES_PAR_PALIER **) MemAlloc( nbPaliers *  sizeof(void *) );
-		problem.ResultatsHoraires[k]->ProductionThermique                   = (PRODUCTION_THERMIQUE_OPTIMALE **)      MemAlloc( NombreDePasDeTemps * sizeof(void *) );
-
-		for (j = 0; j < (int)nbPaliers; ++j)
-		{
-			problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout[j] = (PDISP_ET_COUTS_HORAIRES_PAR_PALIER *) MemAlloc( sizeof(PDISP_ET_COUTS_HORAIRES_PAR_PALIER) );
-
-			problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout[j]->CoutHoraireDeProductionDuPalierThermique    = (double *) MemAlloc( NombreDePasDeTemps * sizeof(double) );
-			problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout[j]->CoutHoraireDeProductionDuPalierThermiqueRef = (double *) MemAlloc( NombreDePasDeTemps * sizeof(double) );
-			problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout[j]->PuissanceDisponibleDuPalierThermique        = (double *) MemAlloc( NombreDePasDeTemps * sizeof(double) );
-			problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout[j]->PuissanceDisponibleDuPalierThermiqueRef     = (double *) MemAlloc( NombreDePasDeTemps * sizeof(double) );
-			problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout[j]->PuissanceDisponibleDuPalierThermiqueRef_SV  = (double *) MemAlloc( NombreDePasDeTemps * sizeof(double) );
-			problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout[j]->PuissanceMinDuPalierThermique               = (double *) MemAlloc( NombreDePasDeTemps * sizeof(double) );
-			problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout[j]->PuissanceMinDuPalierThermique_SV            = (double *) MemAlloc( NombreDePasDeTemps * sizeof(double) );
-			problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout[j]->NombreMaxDeGroupesEnMarcheDuPalierThermique = (int *) MemAlloc( NombreDePasDeTemps * sizeof(int) );
-			problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout[j]->NombreMinDeGroupesEnMarcheDuPalierThermique = (int *) MemAlloc( NombreDePasDeTemps * sizeof(int) );
-
-			problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout[j]->CoutHoraireDuPalierThermiqueUp			  = (double *) MemAlloc( NombreDePasDeTemps * sizeof(double) );
-			problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout[j]->CoutHoraireDuPalierThermiqueDown			  = (double *) MemAlloc( NombreDePasDeTemps * sizeof(double) );
-		}
-		for (j = 0; j < NombreDePasDeTemps; j++)
-		{
-			problem.ResultatsHoraires[k]->ProductionThermique[j] = (PRODUCTION_THERMIQUE_OPTIMALE *) MemAlloc(sizeof(PRODUCTION_THERMIQUE_OPTIMALE));
-			problem.ResultatsHoraires[k]->ProductionThermique[j]->ProductionThermiqueDuPalier		= (double *) MemAlloc( nbPaliers * sizeof(double));
-			problem.ResultatsHoraires[k]->ProductionThermique[j]->ProductionThermiqueDuPalierUp		= (double *) MemAlloc( nbPaliers * sizeof(double));
-			problem.ResultatsHoraires[k]->ProductionThermique[j]->ProductionThermiqueDuPalierDown	= (double *) MemAlloc( nbPaliers * sizeof(double));
-			problem.ResultatsHoraires[k]->ProductionThermique[j]->NombreDeGroupesEnMarcheDuPalier = (double *) MemAlloc( nbPaliers * sizeof(double));
-			problem.ResultatsHoraires[k]->ProductionThermique[j]->NombreDeGroupesQuiDemarrentDuPalier = (double *) MemAlloc( nbPaliers * sizeof(double));
-			problem.ResultatsHoraires[k]->ProductionThermique[j]->NombreDeGroupesQuiSArretentDuPalier = (double *) MemAlloc( nbPaliers * sizeof(double));			
-			problem.ResultatsHoraires[k]->ProductionThermique[j]->NombreDeGroupesQuiTombentEnPanneDuPalier = (double *) MemAlloc( nbPaliers * sizeof(double));			
-		}
+		/* [champ][palier][pas de temps] */
+		problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout = AllouerDesStructures<PDISP_ET_COUTS_HORAIRES_PAR_PALIER>(problem.arene, nbPaliers);
+		RepartirLeChamp(problem.arene, problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout, nbPaliers, &PDISP_ET_COUTS_HORAIRES_PAR_PALIER::CoutHoraireDeProductionDuPalierThermique, NombreDePasDeTemps);
+		RepartirLeChamp(problem.arene, problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout, nbPaliers, &PDISP_ET_COUTS_HORAIRES_PAR_PALIER::CoutHoraireDeProductionDuPalierThermiqueRef, NombreDePasDeTemps);
+		RepartirLeChamp(problem.arene, problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout, nbPaliers, &PDISP_ET_COUTS_HORAIRES_PAR_PALIER::PuissanceDisponibleDuPalierThermique, NombreDePasDeTemps);
+		RepartirLeChamp(problem.arene, problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout, nbPaliers, &PDISP_ET_COUTS_HORAIRES_PAR_PALIER::PuissanceDisponibleDuPalierThermiqueRef, NombreDePasDeTemps);
+		RepartirLeChamp(problem.arene, problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout, nbPaliers, &PDISP_ET_COUTS_HORAIRES_PAR_PALIER::PuissanceDisponibleDuPalierThermiqueRef_SV, NombreDePasDeTemps);
+		RepartirLeChamp(problem.arene, problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout, nbPaliers, &PDISP_ET_COUTS_HORAIRES_PAR_PALIER::PuissanceMinDuPalierThermique, NombreDePasDeTemps);
+		RepartirLeChamp(problem.arene, problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout, nbPaliers, &PDISP_ET_COUTS_HORAIRES_PAR_PALIER::PuissanceMinDuPalierThermique_SV, NombreDePasDeTemps);
+		RepartirLeChamp(problem.arene, problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout, nbPaliers, &PDISP_ET_COUTS_HORAIRES_PAR_PALIER::NombreMaxDeGroupesEnMarcheDuPalierThermique, NombreDePasDeTemps);
+		RepartirLeChamp(problem.arene, problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout, nbPaliers, &PDISP_ET_COUTS_HORAIRES_PAR_PALIER::NombreMinDeGroupesEnMarcheDuPalierThermique, NombreDePasDeTemps);
+		RepartirLeChamp(problem.arene, problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout, nbPaliers, &PDISP_ET_COUTS_HORAIRES_PAR_PALIER::CoutHoraireDuPalierThermiqueUp, NombreDePasDeTemps);
+		RepartirLeChamp(problem.arene, problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout, nbPaliers, &PDISP_ET_COUTS_HORAIRES_PAR_PALIER::CoutHoraireDuPalierThermiqueDown, NombreDePasDeTemps);
+
+		/* [champ][pas de temps][palier] */
+		problem.ResultatsHoraires[k]->ProductionThermique = AllouerDesStructures<PRODUCTION_THERMIQUE_OPTIMALE>(problem.arene, NombreDePasDeTemps);
+		RepartirLeChamp(problem.arene, problem.ResultatsHoraires[k]->ProductionThermique, NombreDePasDeTemps, &PRODUCTION_THERMIQUE_OPTIMALE::ProductionThermiqueDuPalier, nbPaliers);
+		RepartirLeChamp(problem.arene, problem.ResultatsHoraires[k]->ProductionThermique, NombreDePasDeTemps, &PRODUCTION_THERMIQUE_OPTIMALE::ProductionThermiqueDuPalierUp, nbPaliers);
+		RepartirLeChamp(problem.arene, problem.ResultatsHoraires[k]->ProductionThermique, NombreDePasDeTemps, &PRODUCTION_THERMIQUE_OPTIMALE::ProductionThermiqueDuPalierDown, nbPaliers);
+		RepartirLeChamp(problem.arene, problem.ResultatsHoraires[k]->ProductionThermique, NombreDePasDeTemps, &PRODUCTION_THERMIQUE_OPTIMALE::NombreDeGroupesEnMarcheDuPalier, nbPaliers);
+		RepartirLeChamp(problem.arene, problem.ResultatsHoraires[k]->ProductionThermique, NombreDePasDeTemps, &PRODUCTION_THERMIQUE_OPTIMALE::NombreDeGroupesQuiDemarrentDuPalier, nbPaliers);
+		RepartirLeChamp(problem.arene, problem.ResultatsHoraires[k]->ProductionThermique, NombreDePasDeTemps, &PRODUCTION_THERMIQUE_OPTIMALE::NombreDeGroupesQuiSArretentDuPalier, nbPaliers);
+		RepartirLeChamp(problem.arene, problem.ResultatsHoraires[k]->ProductionThermique, NombreDePasDeTemps, &PRODUCTION_THERMIQUE_OPTIMALE::NombreDeGroupesQuiTombentEnPanneDuPalier, nbPaliers);
 	}
 
 	problem.numeroOptimisation		= (int *)    MemAlloc( 7 * sizeof(int) );
 	problem.coutOptimalSolution1	= (double *) MemAlloc( 7 * sizeof(double) );
 	problem.coutOptimalSolution2	= (double *) MemAlloc( 7 * sizeof(double) );
+	problem.nombreDIterationsDuSimplexe = (int *) MemAlloc( 7 * sizeof(int) );
+
+	problem.TelemetrieDuSolveur = NULL;
+	if (study.parameters.simplexTelemetry)
+	{
+		problem.TelemetrieDuSolveur = (TELEMETRIE_DU_SOLVEUR *) MemAllocMemset( sizeof(TELEMETRIE_DU_SOLVEUR) );
+		problem.TelemetrieDuSolveur->MesureDeLIntervalle = (MESURE_DU_SOLVEUR *) MemAllocMemset( 7 * sizeof(MESURE_DU_SOLVEUR) );
+	}
 }
 
 
@@ -430,93 +442,6 @@ void SIM_DesallocationProblemeHebdo( PROBLEME_HEBDO& problem )
 	MemFree( problem.NbGrpCourbeGuide );
 	MemFree( problem.NbGrpOpt );
 
-	for (int k = 0; k < problem.NombreDePasDeTemps; k++) {
-		MemFree( problem.ValeursDeNTC[k]->ResistanceApparente );
-		MemFree( problem.ValeursDeNTC[k]->ValeurDeNTCExtremiteVersOrigine );
-		MemFree( problem.ValeursDeNTC[k]->ValeurDeNTCOrigineVersExtremite );
-		MemFree( problem.ValeursDeNTC[k]->ValeurDeLoopFlowOrigineVersExtremite );
-		MemFree( problem.ValeursDeNTC[k]->ValeurDuFlux );
-		MemFree( problem.ValeursDeNTC[k]->ValeurDuFluxUp );
-		MemFree( problem.ValeursDeNTC[k]->ValeurDuFluxDown );
-		MemFree( problem.ValeursDeNTC[k] );
-		MemFree( problem.ConsommationsAbattues[k]->ConsommationAbattueDuPays );
-		MemFree( problem.ConsommationsAbattues[k] );
-		MemFree( problem.ValeursDeNTCRef[k]->ResistanceApparente );
-		MemFree( problem.ValeursDeNTCRef[k]->ValeurDeNTCExtremiteVersOrigine );
-		MemFree( problem.ValeursDeNTCRef[k]->ValeurDeNTCOrigineVersExtremite );
-		MemFree(problem.ValeursDeNTCRef[k]->ValeurDeLoopFlowOrigineVersExtremite);
-		MemFree( problem.ValeursDeNTCRef[k]->ValeurDuFlux );
-		MemFree( problem.ValeursDeNTCRef[k]->ValeurDuFluxUp );
-		MemFree( problem.ValeursDeNTCRef[k]->ValeurDuFluxDown );
-		MemFree( problem.ValeursDeNTCRef[k] );
-		MemFree( problem.ConsommationsAbattuesRef[k]->ConsommationAbattueDuPays );
-		MemFree( problem.ConsommationsAbattuesRef[k] );
-		MemFree(problem.AllMustRunGeneration[k]->AllMustRunGenerationOfArea);
-		MemFree(problem.AllMustRunGeneration[k]);
-		MemFree( problem.SoldeMoyenHoraire[k]->SoldeMoyenDuPays );
-		MemFree( problem.SoldeMoyenHoraire[k] );
-		MemFree( problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDeLInterconnexion );
-		MemFree( problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableCoutOrigineVersExtremiteDeLInterconnexion );
-		MemFree( problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableCoutExtremiteVersOrigineDeLInterconnexion );
-		MemFree( problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDuPalierThermique );
-		MemFree( problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDuPalierThermiqueUp );
-		MemFree( problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDuPalierThermiqueDown );
-		MemFree( problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariablesDeLaProdHyd );
-		MemFree( problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariablesDeLaProdHydUp );
-		MemFree( problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariablesDeLaProdHydDown );
-		MemFree( problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariablesDePompage );
-		MemFree( problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariablesDeNiveau );
-		MemFree( problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariablesDeDebordement );
-		MemFree( problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDefaillancePositive );
-		MemFree( problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDefaillancePositiveUp );
-		MemFree( problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDefaillancePositiveDown );
-		MemFree( problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDefaillancePositiveAny );
-		MemFree( problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDefaillanceNegative );
-		MemFree( problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDefaillanceNegativeUp );
-		MemFree( problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDefaillanceNegativeDown );
-		MemFree( problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDefaillanceNegativeAny );
-		MemFree( problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeGrosseVariableDefaillancePositive );
-		MemFree( problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeGrosseVariableDefaillanceNegative );
-		MemFree( problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDefaillanceEnReserve );
-		MemFree( problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeGrosseVariableDefaillanceEnReserve );
-		MemFree( problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariablesVariationHydALaBaisse );
-		MemFree( problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariablesVariationHydALaBaisseUp );
-		MemFree( problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariablesVariationHydALaBaisseDown );
-		MemFree( problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariablesVariationHydALaHausse );
-		MemFree( problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariablesVariationHydALaHausseUp );
-		MemFree( problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariablesVariationHydALaHausseDown );
-		MemFree( problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDuNombreDeGroupesEnMarcheDuPalierThermique );
-		MemFree( problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDuNombreDeGroupesQuiDemarrentDuPalierThermique );
-		MemFree( problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDuNombreDeGroupesQuiSArretentDuPalierThermique );
-		MemFree( problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDuNombreDeGroupesQuiTombentEnPanneDuPalierThermique );
-		
-		MemFree( problem.CorrespondanceVarNativesVarOptim[k] );
-		MemFree( problem.CorrespondanceCntNativesCntOptim[k]->NumeroDeContrainteDesBilansPays );
-		MemFree( problem.CorrespondanceCntNativesCntOptim[k]->NumeroDeContrainteDesNiveauxPays );
-		MemFree( problem.CorrespondanceCntNativesCntOptim[k]->NumeroDeContraintePourEviterLesChargesFictives );
-		
-
-
-		MemFree( problem.CorrespondanceCntNativesCntOptim[k]->NumeroPremiereContrainteDeReserveParZone );
-		MemFree( problem.CorrespondanceCntNativesCntOptim[k]->NumeroDeuxiemeContrainteDeReserveParZone );
-		MemFree( problem.CorrespondanceCntNativesCntOptim[k]->NumeroDeContrainteDeDissociationDeFlux );
-		MemFree( problem.CorrespondanceCntNativesCntOptim[k]->NumeroDeContrainteDesContraintesCouplantes );
-		MemFree( problem.CorrespondanceCntNativesCntOptim[k]->NumeroDeContrainteDesContraintesDeDureeMinDeMarche );		
-		MemFree( problem.CorrespondanceCntNativesCntOptim[k]->NumeroDeContrainteDesContraintesDeDureeMinDArret );
-		MemFree( problem.CorrespondanceCntNativesCntOptim[k]->NumeroDeLaDeuxiemeContrainteDesContraintesDesGroupesQuiTombentEnPanne );		
-		MemFree( problem.CorrespondanceCntNativesCntOptim[k] );
-		MemFree( problem.VariablesDualesDesContraintesDeNTC[k]->VariableDualeParInterconnexion );
-		MemFree( problem.VariablesDualesDesContraintesDeNTC[k] );
-	}
-	MemFree( problem.ValeursDeNTC );
-	MemFree( problem.ConsommationsAbattues );
-	MemFree( problem.ValeursDeNTCRef );
-	MemFree( problem.ConsommationsAbattuesRef );
-	MemFree( problem.AllMustRunGeneration );
-	MemFree( problem.SoldeMoyenHoraire );
-	MemFree( problem.CorrespondanceVarNativesVarOptim );
-	MemFree( problem.CorrespondanceCntNativesCntOptim );
-	MemFree( problem.VariablesDualesDesContraintesDeNTC );
 
 	for ( int k = 0 ; k < (int) study.runtime->interconnectionsCount ; k++ ) {
 		MemFree( problem.CoutDeTransport[k]->CoutDeTransportOrigineVersExtremite );
@@ -608,22 +533,6 @@ void SIM_DesallocationProblemeHebdo( PROBLEME_HEBDO& problem )
 		MemFree( problem.ReserveJMoins1[k]->ReserveHoraireJMoins1Ref );
 		MemFree( problem.ReserveJMoins1[k] );
 
-		for (int j = 0; j < (int)nbPaliers; j++)
-		{
-			MemFree( problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout[j]->CoutHoraireDeProductionDuPalierThermique );
-			MemFree( problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout[j]->CoutHoraireDeProductionDuPalierThermiqueRef );
-			MemFree( problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout[j]->PuissanceDisponibleDuPalierThermique );
-			MemFree( problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout[j]->PuissanceDisponibleDuPalierThermiqueRef );
-			MemFree( problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout[j]->PuissanceDisponibleDuPalierThermiqueRef_SV );
-			MemFree( problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout[j]->PuissanceMinDuPalierThermique );
-			MemFree( problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout[j]->PuissanceMinDuPalierThermique_SV );
-			MemFree( problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout[j]->NombreMaxDeGroupesEnMarcheDuPalierThermique );
-			MemFree( problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout[j]->NombreMinDeGroupesEnMarcheDuPalierThermique );
-			MemFree( problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout[j]->CoutHoraireDuPalierThermiqueUp );
-			MemFree( problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout[j]->CoutHoraireDuPalierThermiqueDown );
-			MemFree( problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout[j] );
-		}
-		MemFree( problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout );
 		MemFree( problem.PaliersThermiquesDuPays[k] );
 		MemFree( problem.ResultatsHoraires[k]->ValeursHorairesDeDefaillancePositive );
 		MemFree( problem.ResultatsHoraires[k]->ValeursHorairesDeDefaillancePositiveUp );
@@ -642,18 +551,6 @@ void SIM_DesallocationProblemeHebdo( PROBLEME_HEBDO& problem )
 		MemFree( problem.ResultatsHoraires[k]->valeurH2oHoraire );
 		MemFree( problem.ResultatsHoraires[k]->debordementsHoraires );
 		MemFree( problem.ResultatsHoraires[k]->CoutsMarginauxHoraires );
-		for (int j = 0; j < problem.NombreDePasDeTemps; j++)
-		{
-			MemFree( problem.ResultatsHoraires[k]->ProductionThermique[j]->ProductionThermiqueDuPalier );
-			MemFree( problem.ResultatsHoraires[k]->ProductionThermique[j]->ProductionThermiqueDuPalierUp );
-			MemFree( problem.ResultatsHoraires[k]->ProductionThermique[j]->ProductionThermiqueDuPalierDown );
-			MemFree( problem.ResultatsHoraires[k]->ProductionThermique[j]->NombreDeGroupesEnMarcheDuPalier );
-			MemFree( problem.ResultatsHoraires[k]->ProductionThermique[j]->NombreDeGroupesQuiDemarrentDuPalier );
-			MemFree( problem.ResultatsHoraires[k]->ProductionThermique[j]->NombreDeGroupesQuiSArretentDuPalier );
-			MemFree( problem.ResultatsHoraires[k]->ProductionThermique[j]->NombreDeGroupesQuiTombentEnPanneDuPalier );
-			MemFree( problem.ResultatsHoraires[k]->ProductionThermique[j] );
-		}
-		MemFree( problem.ResultatsHoraires[k]->ProductionThermique );
 		MemFree( problem.ResultatsHoraires[k] );
 
 		MemFree( problem.BruitSurCoutHydraulique[k]);
@@ -699,6 +596,18 @@ void SIM_DesallocationProblemeHebdo( PROBLEME_HEBDO& problem )
 	MemFree( problem.numeroOptimisation );
 	MemFree( problem.coutOptimalSolution1 );
 	MemFree( problem.coutOptimalSolution2 );
+	MemFree( problem.nombreDIterationsDuSimplexe );
+
+	if (problem.TelemetrieDuSolveur)
+	{
+		MemFree( problem.TelemetrieDuSolveur->MesureDeLIntervalle );
+		MemFree( problem.TelemetrieDuSolveur->Mesures );
+		MemFree( problem.TelemetrieDuSolveur );
+		problem.TelemetrieDuSolveur = NULL;
+	}
+
+	/* Toutes les donnees par pas de temps */
+	problem.arene.liberer();
 }
 
 
@@ -750,3 +659,55 @@ void PROBLEME_HEBDO::Manoeuvrabilite::reserve(uint nbAreas, uint nbLinks)
 }
 
 
+PROBLEME_HEBDO::Arene::Arene() :
+	pSegment(NULL)
+{}
+
+PROBLEME_HEBDO::Arene::~Arene()
+{
+	liberer();
+}
+
+
+void* PROBLEME_HEBDO::Arene::allouerOctets(size_t taille)
+{
+	enum
+	{
+		/* Chaque bloc commence sur une ligne de cache */
+		alignement = 64,
+		tailleMinimaleDUnSegment = 4 * 1024 * 1024,
+		enTete = (sizeof(Segment) + alignement - 1) & ~(alignement - 1),
+	};
+
+	taille = (taille + alignement - 1) & ~((size_t) alignement - 1);
+	if (not taille)
+		taille = alignement;
+
+	if (not pSegment or pSegment->utilise + taille > pSegment->taille)
+	{
+		size_t tailleDuSegment = (taille > (size_t) tailleMinimaleDUnSegment) ? taille : (size_t) tailleMinimaleDUnSegment;
+		/* MemAlloc ne garantit que l'alignement d'un double */
+		auto* segment = (Segment*) MemAllocMemset(enTete + tailleDuSegment + alignement);
+		segment->suivant = pSegment;
+		segment->taille  = tailleDuSegment;
+		segment->utilise = 0;
+		pSegment = segment;
+	}
+
+	char* debut = (char*) pSegment + enTete;
+	debut += (alignement - ((size_t) debut & (alignement - 1))) & (alignement - 1);
+	void* bloc = debut + pSegment->utilise;
+	pSegment->utilise += taille;
+	return bloc;
+}
+
+
+void PROBLEME_HEBDO::Arene::liberer()
+{
+	while (pSegment)
+	{
+		Segment* suivant = pSegment->suivant;
+		MemFree(pSegment);
+		pSegment = suivant;
+	}
+}
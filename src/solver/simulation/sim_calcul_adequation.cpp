@@ -77,52 +77,67 @@ void SIM_AllocationProblemeHoraireAdequation()
 
 	
 	auto& study = *Data::Study::Current::Get();
+	uint nbSpaces = study.maxNbYearsInParallel;
 
 	
-	ValeursAnnuellesAdequation = (VALEURS_ANNUELLES **) MemAlloc( study.areas.size() * sizeof(VALEURS_ANNUELLES *));
+	ValeursAnnuellesAdequation = (VALEURS_ANNUELLES ***)         MemAlloc( nbSpaces * sizeof(VALEURS_ANNUELLES **) );
+	ProblemeHoraireAdequation  = (PROBLEME_HORAIRE_ADEQUATION *) MemAlloc( nbSpaces * sizeof(PROBLEME_HORAIRE_ADEQUATION) );
 
-	for (i = 0; i < (long) study.areas.size(); i++)
+	for (uint numSpace = 0; numSpace < nbSpaces; numSpace++)
 	{
-		ValeursAnnuellesAdequation[i] = (VALEURS_ANNUELLES *) MemAlloc( sizeof(VALEURS_ANNUELLES) );
+		ValeursAnnuellesAdequation[numSpace] = (VALEURS_ANNUELLES **) MemAlloc( study.areas.size() * sizeof(VALEURS_ANNUELLES *));
 
-		ValeursAnnuellesAdequation[i]->Consommation              = (double *) MemAlloc( study.runtime->nbHoursPerYear * sizeof(double) );
-		ValeursAnnuellesAdequation[i]->PuissanceThermiqueCumulee = (double *) MemAlloc( study.runtime->nbHoursPerYear * sizeof(double) );
-		ValeursAnnuellesAdequation[i]->Reserve                   = (double *) MemAlloc( study.runtime->nbHoursPerYear * sizeof(double) );
-	}
+		for (i = 0; i < (long) study.areas.size(); i++)
+		{
+			auto*& valeurs = ValeursAnnuellesAdequation[numSpace][i];
+			valeurs = (VALEURS_ANNUELLES *) MemAlloc( sizeof(VALEURS_ANNUELLES) );
 
-	
-	ProblemeHoraireAdequation.NombreDElementsChainage = 2 * study.runtime->interconnectionsCount + 4 *study.areas.size() ;
-	ProblemeHoraireAdequation.IndicesDesVoisins       = (long *)                           MemAlloc( ProblemeHoraireAdequation.NombreDElementsChainage * sizeof(long) );
-	ProblemeHoraireAdequation.PointeurSurIndices      = (long *)                           MemAlloc( (study.areas.size() + 3)                                * sizeof(long) );
-	ProblemeHoraireAdequation.RangDansVoisinage       = (long *)                           MemAlloc( ProblemeHoraireAdequation.NombreDElementsChainage * sizeof(long) );
-	ProblemeHoraireAdequation.QuellesNTCPrendre       = (double *)                         MemAlloc( ProblemeHoraireAdequation.NombreDElementsChainage * sizeof(double) );
-	ProblemeHoraireAdequation.ValeursEffectivesNTC    = (double *)                         MemAlloc( ProblemeHoraireAdequation.NombreDElementsChainage * sizeof(double) );
-	ProblemeHoraireAdequation.FluxDeSecours           = (double *)                         MemAlloc( ProblemeHoraireAdequation.NombreDElementsChainage * sizeof(double) );
-	ProblemeHoraireAdequation.NTCDeReference          = (double *)                         MemAlloc( ProblemeHoraireAdequation.NombreDElementsChainage * sizeof(double) );
-	ProblemeHoraireAdequation.S                       = (double *)                         MemAlloc( (study.areas.size() + 2)                                * sizeof(double) );
-	ProblemeHoraireAdequation.A                       = (long *)                           MemAlloc( (study.areas.size() + 2)                                * sizeof(long) );
-	ProblemeHoraireAdequation.B                       = (long *)                           MemAlloc( (study.areas.size() + 2)                                * sizeof(long) );
-	ProblemeHoraireAdequation.X                       = (long *)                           MemAlloc( (study.areas.size() + 2)                                * sizeof(long) );
-	ProblemeHoraireAdequation.DonneesParPays          = (DONNEES_ADEQUATION **)            MemAlloc( study.areas.size()                                      * sizeof(DONNEES_ADEQUATION *) );
-	ProblemeHoraireAdequation.ResultatsParPays       =  (RESULTATS_HORAIRES_ADEQUATION **) MemAlloc( study.areas.size()                                      * sizeof(RESULTATS_HORAIRES_ADEQUATION *) );
+			valeurs->Consommation              = (double *) MemAlloc( study.runtime->nbHoursPerYear * sizeof(double) );
+			valeurs->PuissanceThermiqueCumulee = (double *) MemAlloc( study.runtime->nbHoursPerYear * sizeof(double) );
+			valeurs->Reserve                   = (double *) MemAlloc( study.runtime->nbHoursPerYear * sizeof(double) );
+		}
 
-	for (i = 0; i < (long)study.areas.size(); i++)
-	{
-		ProblemeHoraireAdequation.DonneesParPays[i]   = (DONNEES_ADEQUATION *)             MemAlloc( sizeof(DONNEES_ADEQUATION) );
-		ProblemeHoraireAdequation.ResultatsParPays[i] = (RESULTATS_HORAIRES_ADEQUATION *)  MemAlloc( sizeof(RESULTATS_HORAIRES_ADEQUATION) );
-	}
+		
+		auto& problem = ProblemeHoraireAdequation[numSpace];
+		memset(&problem, 0, sizeof(PROBLEME_HORAIRE_ADEQUATION));
+
+		problem.NombreDElementsChainage = 2 * study.runtime->interconnectionsCount + 4 *study.areas.size() ;
+		problem.IndicesDesVoisins       = (long *)                           MemAlloc( problem.NombreDElementsChainage * sizeof(long) );
+		problem.PointeurSurIndices      = (long *)                           MemAlloc( (study.areas.size() + 3)        * sizeof(long) );
+		problem.RangDansVoisinage       = (long *)                           MemAlloc( problem.NombreDElementsChainage * sizeof(long) );
+		problem.QuellesNTCPrendre       = (double *)                         MemAlloc( problem.NombreDElementsChainage * sizeof(double) );
+		problem.ValeursEffectivesNTC    = (double *)                         MemAlloc( problem.NombreDElementsChainage * sizeof(double) );
+		problem.FluxDeSecours           = (double *)                         MemAlloc( problem.NombreDElementsChainage * sizeof(double) );
+		problem.NTCDeReference          = (double *)                         MemAlloc( problem.NombreDElementsChainage * sizeof(double) );
+		problem.S                       = (double *)                         MemAlloc( (study.areas.size() + 2)        * sizeof(double) );
+		problem.A                       = (long *)                           MemAlloc( (study.areas.size() + 2)        * sizeof(long) );
+		problem.B                       = (long *)                           MemAlloc( (study.areas.size() + 2)        * sizeof(long) );
+		problem.X                       = (long *)                           MemAlloc( (study.areas.size() + 2)        * sizeof(long) );
+		problem.ArcDepuisLaSource       = (long *)                           MemAlloc( study.areas.size()              * sizeof(long) );
+		problem.ArcVersLePuits          = (long *)                           MemAlloc( study.areas.size()              * sizeof(long) );
+		problem.DefaillanceHorsReseauParHeure = (char *)                     MemAlloc( study.runtime->nbHoursPerYear   * sizeof(char) );
+		problem.DonneesParPays          = (DONNEES_ADEQUATION **)            MemAlloc( study.areas.size()              * sizeof(DONNEES_ADEQUATION *) );
+		problem.ResultatsParPays        = (RESULTATS_HORAIRES_ADEQUATION **) MemAlloc( study.areas.size()              * sizeof(RESULTATS_HORAIRES_ADEQUATION *) );
+
+		for (i = 0; i < (long)study.areas.size(); i++)
+		{
+			problem.DonneesParPays[i]   = (DONNEES_ADEQUATION *)             MemAlloc( sizeof(DONNEES_ADEQUATION) );
+			problem.ResultatsParPays[i] = (RESULTATS_HORAIRES_ADEQUATION *)  MemAlloc( sizeof(RESULTATS_HORAIRES_ADEQUATION) );
+		}
 
-	memset(ProblemeHoraireAdequation.IndicesDesVoisins , 0, ProblemeHoraireAdequation.NombreDElementsChainage * sizeof(long));
-	memset(ProblemeHoraireAdequation.PointeurSurIndices, 0, (study.areas.size() + 3)                                * sizeof(long));
-	memset(ProblemeHoraireAdequation.RangDansVoisinage , 0, ProblemeHoraireAdequation.NombreDElementsChainage * sizeof(long));
-	memset(ProblemeHoraireAdequation.QuellesNTCPrendre , 0, ProblemeHoraireAdequation.NombreDElementsChainage * sizeof(double));
+		memset(problem.IndicesDesVoisins , 0, problem.NombreDElementsChainage * sizeof(long));
+		memset(problem.PointeurSurIndices, 0, (study.areas.size() + 3)        * sizeof(long));
+		memset(problem.RangDansVoisinage , 0, problem.NombreDElementsChainage * sizeof(long));
+		memset(problem.QuellesNTCPrendre , 0, problem.NombreDElementsChainage * sizeof(double));
+		memset(problem.DefaillanceHorsReseauParHeure, NON_ANTARES, study.runtime->nbHoursPerYear * sizeof(char));
+	}
 }
 
 
 
 
 
-void SIM_InitialisationChainagePourAdequation()
+static void InitialisationChainagePourAdequation(PROBLEME_HORAIRE_ADEQUATION& problem)
 {
 	
 	auto& study = *Data::Study::Current::Get();
@@ -152,7 +167,7 @@ void SIM_InitialisationChainagePourAdequation()
 	}
 
 	memset(NombreDeVoisins,0 ,(nbAreasPlus2)*sizeof(long));
-	memset(ProblemeHoraireAdequation.QuellesNTCPrendre,0 ,ProblemeHoraireAdequation.NombreDElementsChainage*sizeof(double));
+	memset(problem.QuellesNTCPrendre,0 ,problem.NombreDElementsChainage*sizeof(double));
 
 	
 
@@ -185,7 +200,7 @@ void SIM_InitialisationChainagePourAdequation()
 	}
 
 	
-	ProblemeHoraireAdequation.PointeurSurIndices[0] = 0;
+	problem.PointeurSurIndices[0] = 0;
 
 	for (i = 0 ; i < (long)nbAreasPlus2 ; i++)
 	{
@@ -195,27 +210,41 @@ void SIM_InitialisationChainagePourAdequation()
 			if (fabs(MatriceDuReseauAugmente[i]->ParLigne[j]) > 0.1)
 			{
 				NombreDeVoisins[i] += 1;
-				assert((uint)(ProblemeHoraireAdequation.PointeurSurIndices[i] + k) < (uint)ProblemeHoraireAdequation.NombreDElementsChainage);
-				ProblemeHoraireAdequation.IndicesDesVoisins[ProblemeHoraireAdequation.PointeurSurIndices[i] + k] = j;
+				assert((uint)(problem.PointeurSurIndices[i] + k) < (uint)problem.NombreDElementsChainage);
+				problem.IndicesDesVoisins[problem.PointeurSurIndices[i] + k] = j;
 				AdjacentTemporaire[j]->ParLigne[i] = (double) k;
 				k++;
 			}
 		}
-		ProblemeHoraireAdequation.PointeurSurIndices[i+1] = ProblemeHoraireAdequation.PointeurSurIndices[i] + NombreDeVoisins[i];
+		problem.PointeurSurIndices[i+1] = problem.PointeurSurIndices[i] + NombreDeVoisins[i];
 	}
 
 	for (i = 0; i < (long)nbAreasPlus2; i++)
 	{
-		for (j = ProblemeHoraireAdequation.PointeurSurIndices[i]; j < ProblemeHoraireAdequation.PointeurSurIndices[i+1]; j++)
+		for (j = problem.PointeurSurIndices[i]; j < problem.PointeurSurIndices[i+1]; j++)
 		{
-			assert((uint)j < (uint)ProblemeHoraireAdequation.NombreDElementsChainage);
-			assert((uint)ProblemeHoraireAdequation.IndicesDesVoisins[j] < nbAreasPlus2);
+			assert((uint)j < (uint)problem.NombreDElementsChainage);
+			assert((uint)problem.IndicesDesVoisins[j] < nbAreasPlus2);
 
-			ProblemeHoraireAdequation.RangDansVoisinage[j] = (long)(AdjacentTemporaire[i]->ParLigne[ProblemeHoraireAdequation.IndicesDesVoisins[j]]); 
-			ProblemeHoraireAdequation.QuellesNTCPrendre[j] = MatriceDuReseauAugmente[i]->ParLigne[ProblemeHoraireAdequation.IndicesDesVoisins[j]];
+			problem.RangDansVoisinage[j] = (long)(AdjacentTemporaire[i]->ParLigne[problem.IndicesDesVoisins[j]]); 
+			problem.QuellesNTCPrendre[j] = MatriceDuReseauAugmente[i]->ParLigne[problem.IndicesDesVoisins[j]];
 		}
 	}
-	
+
+
+	for (i = problem.PointeurSurIndices[0]; i < problem.PointeurSurIndices[1]; i++)
+		problem.ArcDepuisLaSource[problem.IndicesDesVoisins[i] - 1] = i;
+
+	for (i = 0; i < (long)study.areas.size(); i++)
+	{
+		problem.ArcVersLePuits[i] = -1;
+		for (j = problem.PointeurSurIndices[i + 1]; j < problem.PointeurSurIndices[i + 2]; j++)
+		{
+			if (problem.IndicesDesVoisins[j] == (long)study.areas.size() + 1)
+				problem.ArcVersLePuits[i] = j;
+		}
+	}
+
 	MemFree(NombreDeVoisins);
 
 	for (i = 0; i < (long)nbAreasPlus2; i++)
@@ -232,6 +261,16 @@ void SIM_InitialisationChainagePourAdequation()
 
 
 
+void SIM_InitialisationChainagePourAdequation()
+{
+	auto& study = *Data::Study::Current::Get();
+
+	for (uint numSpace = 0; numSpace < study.maxNbYearsInParallel; numSpace++)
+		InitialisationChainagePourAdequation(ProblemeHoraireAdequation[numSpace]);
+}
+
+
+
 void SIM_InitialisationProblemeHoraireAdequation()
 {
 	SIM_AllocationProblemeHoraireAdequation();
@@ -248,7 +287,7 @@ void SIM_RenseignementValeursPourTouteLAnnee(const Antares::Data::Study& study,
 
 	for (uint i = 0; i != study.areas.size(); ++i)
 	{
-		auto& Pt               = * ValeursAnnuellesAdequation[i];
+		auto& Pt               = * ValeursAnnuellesAdequation[numSpace][i];
 		auto& tsIndex          = * NumeroChroniquesTireesParPays[numSpace][i];
 		auto& area             = * study.areas[i];
 		auto& scratchpad       = *(area.scratchpad[numSpace]);
@@ -292,44 +331,59 @@ void SIM_RenseignementValeursPourTouteLAnnee(const Antares::Data::Study& study,
 				Pt.PuissanceThermiqueCumulee[h] +=  col[h];
 		}
 	}
+
+
+
+
+	char* defaillance = ProblemeHoraireAdequation[numSpace].DefaillanceHorsReseauParHeure;
+	memset(defaillance, NON_ANTARES, study.runtime->nbHoursPerYear * sizeof(char));
+
+	for (uint i = 0; i != study.areas.size(); ++i)
+	{
+		const VALEURS_ANNUELLES& Pt = * ValeursAnnuellesAdequation[numSpace][i];
+		for (uint h = startTime; h < finalHour; ++h)
+			defaillance[h] |= (Pt.PuissanceThermiqueCumulee[h] - Pt.Consommation[h] < 0.) ? OUI_ANTARES : NON_ANTARES;
+	}
 }
 
 
 
 
-void SIM_RenseignementProblemeHoraireAdequation(long Heure)
+void SIM_RenseignementProblemeHoraireAdequation(long Heure, uint numSpace)
 {
 	
 	auto& study = *Data::Study::Current::Get();
+	auto& problem = ProblemeHoraireAdequation[numSpace];
 
 	for (uint i = 0 ; i < study.areas.size(); i++)
 	{
-		DONNEES_ADEQUATION& PtHoraire      = *(ProblemeHoraireAdequation.DonneesParPays[i]);
-		const VALEURS_ANNUELLES& PtAnnuel  = *(ValeursAnnuellesAdequation[i]);
+		DONNEES_ADEQUATION& PtHoraire      = *(problem.DonneesParPays[i]);
+		const VALEURS_ANNUELLES& PtAnnuel  = *(ValeursAnnuellesAdequation[numSpace][i]);
 
 		PtHoraire.Consommation              = PtAnnuel.Consommation[Heure];
 		PtHoraire.PuissanceThermiqueCumulee = PtAnnuel.PuissanceThermiqueCumulee[Heure];
 		PtHoraire.Reserve                   = PtAnnuel.Reserve[Heure];
 	}
 
-	
-	
-	
-	memset(ProblemeHoraireAdequation.ValeursEffectivesNTC, 0 ,
-		ProblemeHoraireAdequation.NombreDElementsChainage * sizeof(double));
 
-	for (long i = 0; i < ProblemeHoraireAdequation.NombreDElementsChainage; ++i)
+	if (problem.DefaillanceHorsReseauParHeure[Heure] == NON_ANTARES)
+		return;
+
+	memset(problem.ValeursEffectivesNTC, 0 ,
+		problem.NombreDElementsChainage * sizeof(double));
+
+	for (long i = 0; i < problem.NombreDElementsChainage; ++i)
 	{
-		double NTCAPrendre = ProblemeHoraireAdequation.QuellesNTCPrendre[i];
+		double NTCAPrendre = problem.QuellesNTCPrendre[i];
 		if (fabs(NTCAPrendre) > 0.5) 
 		{
 			if (NTCAPrendre > 0.) 
 			{
-				ProblemeHoraireAdequation.ValeursEffectivesNTC[i] = study.runtime->areaLink[(long)(fabs(NTCAPrendre)-1)]->data.entry[fhlNTCIndirect][Heure];
+				problem.ValeursEffectivesNTC[i] = study.runtime->areaLink[(long)(fabs(NTCAPrendre)-1)]->data.entry[fhlNTCIndirect][Heure];
 			}
 			if (NTCAPrendre < 0.) 
 			{
-				ProblemeHoraireAdequation.ValeursEffectivesNTC[i] = study.runtime->areaLink[(long)(fabs(NTCAPrendre)-1)]->data.entry[fhlNTCDirect][Heure];
+				problem.ValeursEffectivesNTC[i] = study.runtime->areaLink[(long)(fabs(NTCAPrendre)-1)]->data.entry[fhlNTCDirect][Heure];
 			}
 		}
 	}
@@ -339,19 +393,20 @@ void SIM_RenseignementProblemeHoraireAdequation(long Heure)
 
 
 
-void SIM_CalculFlotHoraireAdequation()
+void SIM_CalculFlotHoraireAdequation(uint numSpace)
 {
 	
 	auto& study = *Data::Study::Current::Get();
+	auto& problem = ProblemeHoraireAdequation[numSpace];
 
-	ProblemeHoraireAdequation.DefaillanceEuropeenneHorsReseau  = NON_ANTARES;
-	ProblemeHoraireAdequation.DefaillanceEuropeenneAvecReseau  = NON_ANTARES;
+	problem.DefaillanceEuropeenneHorsReseau  = NON_ANTARES;
+	problem.DefaillanceEuropeenneAvecReseau  = NON_ANTARES;
 
 	for (uint i = 0; i < study.areas.size(); i++)
 	{
-		const DONNEES_ADEQUATION&  dataAdequacy = *(ProblemeHoraireAdequation.DonneesParPays[i]);
+		const DONNEES_ADEQUATION&  dataAdequacy = *(problem.DonneesParPays[i]);
 
-		auto& Pt                  = * ProblemeHoraireAdequation.ResultatsParPays[i];
+		auto& Pt                  = * problem.ResultatsParPays[i];
 		Pt.DefaillanceHorsReseau = NON_ANTARES;
 		Pt.DefaillanceAvecReseau = NON_ANTARES;
 		Pt.MargeHorsReseau       = dataAdequacy.PuissanceThermiqueCumulee - dataAdequacy.Consommation;
@@ -359,8 +414,8 @@ void SIM_CalculFlotHoraireAdequation()
 		if (Pt.MargeHorsReseau < 0.)
 		{
 			
-			Pt.Offre                                                 = ProblemeHoraireAdequation.ResultatsParPays[i]->MargeHorsReseau;
-			ProblemeHoraireAdequation.DefaillanceEuropeenneHorsReseau = OUI_ANTARES;
+			Pt.Offre                                                 = problem.ResultatsParPays[i]->MargeHorsReseau;
+			problem.DefaillanceEuropeenneHorsReseau = OUI_ANTARES;
 			Pt.DefaillanceHorsReseau                                 = OUI_ANTARES;
 		}
 		if (Pt.MargeHorsReseau > dataAdequacy.Reserve)
@@ -370,16 +425,16 @@ void SIM_CalculFlotHoraireAdequation()
 		}
 	}
 
-	if (ProblemeHoraireAdequation.DefaillanceEuropeenneHorsReseau > 0)
+	if (problem.DefaillanceEuropeenneHorsReseau > 0)
 	{
 		
-		SIM_AlgorithmeDeFlot();
+		SIM_AlgorithmeDeFlot(numSpace);
 		for (uint i = 0 ; i < study.areas.size() ; i++ )
 		{
-			auto& Pt = * ProblemeHoraireAdequation.ResultatsParPays[i];
+			auto& Pt = * problem.ResultatsParPays[i];
 			if (Pt.MargeAvecReseau < 0.)
 			{
-				ProblemeHoraireAdequation.DefaillanceEuropeenneAvecReseau = OUI_ANTARES;
+				problem.DefaillanceEuropeenneAvecReseau = OUI_ANTARES;
 				Pt.DefaillanceAvecReseau                                  = OUI_ANTARES;
 			}
 		}
@@ -387,7 +442,7 @@ void SIM_CalculFlotHoraireAdequation()
 	else 
 	{
 		for (uint i = 0 ; i < study.areas.size(); i++)
-			ProblemeHoraireAdequation.ResultatsParPays[i]->MargeAvecReseau = ProblemeHoraireAdequation.ResultatsParPays[i]->MargeHorsReseau;
+			problem.ResultatsParPays[i]->MargeAvecReseau = problem.ResultatsParPays[i]->MargeHorsReseau;
 	}
 }
 
@@ -398,49 +453,47 @@ void SIM_DesallocationProblemeHoraireAdequation()
 	
 	auto& study = *Data::Study::Current::Get();
 
-	
-	for (uint i = 0 ; i < study.areas.size(); i++)
+	if (not ProblemeHoraireAdequation)
+		return;
+
+	for (uint numSpace = 0; numSpace < study.maxNbYearsInParallel; numSpace++)
 	{
-		MemFree( ValeursAnnuellesAdequation[i]->Consommation);
-		MemFree( ValeursAnnuellesAdequation[i]->PuissanceThermiqueCumulee);
-		MemFree( ValeursAnnuellesAdequation[i]->Reserve);
-		MemFree( ValeursAnnuellesAdequation[i] );
+		
+		for (uint i = 0 ; i < study.areas.size(); i++)
+		{
+			MemFree( ValeursAnnuellesAdequation[numSpace][i]->Consommation);
+			MemFree( ValeursAnnuellesAdequation[numSpace][i]->PuissanceThermiqueCumulee);
+			MemFree( ValeursAnnuellesAdequation[numSpace][i]->Reserve);
+			MemFree( ValeursAnnuellesAdequation[numSpace][i] );
+		}
+		MemFree( ValeursAnnuellesAdequation[numSpace] );
+
+		auto& problem = ProblemeHoraireAdequation[numSpace];
+		MemFree( problem.IndicesDesVoisins );
+		MemFree( problem.PointeurSurIndices );
+		MemFree( problem.RangDansVoisinage );
+		MemFree( problem.QuellesNTCPrendre );
+		MemFree( problem.ValeursEffectivesNTC );
+		MemFree( problem.FluxDeSecours );
+		MemFree( problem.NTCDeReference );
+		MemFree( problem.S );
+		MemFree( problem.A );
+		MemFree( problem.B );
+		MemFree( problem.X );
+		MemFree( problem.ArcDepuisLaSource );
+		MemFree( problem.ArcVersLePuits );
+		MemFree( problem.DefaillanceHorsReseauParHeure );
+		for (uint i = 0 ; i < study.areas.size(); i++)
+		{
+			MemFree( problem.DonneesParPays[i] );
+			MemFree( problem.ResultatsParPays[i] );
+		}
+		MemFree( problem.DonneesParPays );
+		MemFree( problem.ResultatsParPays );
 	}
+
 	MemFree( ValeursAnnuellesAdequation );
-	ValeursAnnuellesAdequation      = NULL;
-	
-	MemFree( ProblemeHoraireAdequation.IndicesDesVoisins );
-	MemFree( ProblemeHoraireAdequation.PointeurSurIndices );
-	MemFree( ProblemeHoraireAdequation.RangDansVoisinage );
-	MemFree( ProblemeHoraireAdequation.QuellesNTCPrendre );
-	MemFree( ProblemeHoraireAdequation.ValeursEffectivesNTC );
-	MemFree( ProblemeHoraireAdequation.FluxDeSecours );
-	MemFree( ProblemeHoraireAdequation.NTCDeReference );
-	MemFree( ProblemeHoraireAdequation.S );
-	MemFree( ProblemeHoraireAdequation.A );
-	MemFree( ProblemeHoraireAdequation.B );
-	MemFree( ProblemeHoraireAdequation.X );
-	ProblemeHoraireAdequation.IndicesDesVoisins       = NULL;
-	ProblemeHoraireAdequation.PointeurSurIndices      = NULL;
-	ProblemeHoraireAdequation.RangDansVoisinage       = NULL;
-	ProblemeHoraireAdequation.QuellesNTCPrendre       = NULL;
-	ProblemeHoraireAdequation.ValeursEffectivesNTC    = NULL;
-	ProblemeHoraireAdequation.FluxDeSecours           = NULL;
-	ProblemeHoraireAdequation.NTCDeReference          = NULL;
-	ProblemeHoraireAdequation.S                       = NULL;
-	ProblemeHoraireAdequation.A                       = NULL;
-	ProblemeHoraireAdequation.B                       = NULL;
-	ProblemeHoraireAdequation.X                       = NULL;
-	for (uint i = 0 ; i < study.areas.size(); i++)
-	{
-		MemFree( ProblemeHoraireAdequation.DonneesParPays[i] );
-		MemFree( ProblemeHoraireAdequation.ResultatsParPays[i] );
-	}
-	MemFree( ProblemeHoraireAdequation.DonneesParPays );
-	MemFree( ProblemeHoraireAdequation.ResultatsParPays );
-	ProblemeHoraireAdequation.DonneesParPays   = NULL;
-	ProblemeHoraireAdequation.ResultatsParPays = NULL;
+	ValeursAnnuellesAdequation = NULL;
+	MemFree( ProblemeHoraireAdequation );
+	ProblemeHoraireAdequation  = NULL;
 }
-
-
-
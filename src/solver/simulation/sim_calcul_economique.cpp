@@ -27,6 +27,7 @@
 
 #include <yuni/yuni.h>
 #include <yuni/core/math.h>
+#include <yuni/core/system/cpu.h>
 #include <antares/study.h>
 #include <antares/study/area/constants.h>
 #include <antares/study/area/scratchpad.h>
@@ -106,6 +107,8 @@ void SIM_InitialisationProblemeHebdo(Data::Study& study, PROBLEME_HEBDO& problem
 
 	SIM_AllocationProblemeHebdo(problem, NombreDePasDeTemps);
 
+	problem.DonneesInvariantesRenseignees = NON_ANTARES;
+
 	
 	
 	problem.NombreDePasDeTemps            = NombreDePasDeTemps;
@@ -347,6 +350,27 @@ void SIM_InitialisationProblemeHebdo(Data::Study& study, PROBLEME_HEBDO& problem
 		(parameters.simplexOptimizationRange == Data::sorWeek) ? OUI_ANTARES : NON_ANTARES;
 
 	
+	
+	problem.ResolutionParalleleDesIntervalles =
+		(parameters.simplexParallelDays && problem.ExportMPS == NON_ANTARES && problem.Expansion == NON_ANTARES)
+		? OUI_ANTARES : NON_ANTARES;
+
+	
+	problem.DemarrageAChaudDuSimplexe = (parameters.simplexWarmStart) ? OUI_ANTARES : NON_ANTARES;
+
+	
+	/* Les coeurs laisses libres par les annees resolues en parallele */
+	{
+		uint nbCores = Yuni::System::CPU::Count();
+		uint nbYears = (study.maxNbYearsInParallel > 0) ? study.maxNbYearsInParallel : 1;
+		problem.NombreDeThreadsDuProbleme = (nbCores > nbYears) ? (int) (nbCores / nbYears) : 1;
+	}
+
+	problem.NombreDeThreadsDesPaliers = 1;
+	if (parameters.unitCommitment.parallelClusters && problem.OptimisationAvecCoutsDeDemarrage == OUI_ANTARES)
+		problem.NombreDeThreadsDesPaliers = problem.NombreDeThreadsDuProbleme;
+
+	
 	problem.OptimisationMUTetMDT = OUI_ANTARES;
 	
 }
@@ -387,6 +411,62 @@ void SIM_InitialisationResultats()
 
 
 
+# ifndef NDEBUG
+static void VerifierLesDonneesInvariantes(PROBLEME_HEBDO& problem, const int PasDeTempsDebut)
+{
+	// The values kept from the previous weeks must be those a full refill would give
+	auto& study = *Data::Study::Current::Get();
+	auto& studyruntime = *study.runtime;
+	const uint weekFirstDay = study.calendar.hours[PasDeTempsDebut].dayYear;
+
+	for (uint k = 0; k != studyruntime.interconnectionsCount; ++k)
+	{
+		auto& lnk = *(studyruntime.areaLink[k]);
+		for (int j = 0; j < problem.NombreDePasDeTemps; ++j)
+		{
+			if (studyruntime.linkWithConstantNTC[k])
+			{
+				const auto* ntc = problem.ValeursDeNTC[j];
+				assert(ntc->ValeurDeNTCOrigineVersExtremite[k] == lnk.data[fhlNTCDirect][PasDeTempsDebut + j]);
+				assert(ntc->ValeurDeNTCExtremiteVersOrigine[k] == lnk.data[fhlNTCIndirect][PasDeTempsDebut + j]);
+				assert(ntc->ValeurDeLoopFlowOrigineVersExtremite[k] == lnk.data[fhlLoopFlow][PasDeTempsDebut + j]);
+			}
+			if (lnk.useHurdlesCost and studyruntime.linkWithConstantHurdlesCosts[k])
+			{
+				const auto* couts = problem.CoutDeTransport[k];
+				assert(couts->CoutDeTransportOrigineVersExtremiteRef[j] == lnk.data[fhlHurdlesCostDirect][PasDeTempsDebut + j]);
+				assert(couts->CoutDeTransportExtremiteVersOrigineRef[j] == lnk.data[fhlHurdlesCostIndirect][PasDeTempsDebut + j]);
+			}
+		}
+		lnk.data.flush();
+	}
+
+	for (uint k = 0; k != studyruntime.bindingConstraintCount; ++k)
+	{
+		auto& bc = studyruntime.bindingConstraint[k];
+		if (not bc.constantBounds)
+			continue;
+		const double* sndMemberRef = problem.MatriceDesContraintesCouplantes[k]->SecondMembreDeLaContrainteCouplanteRef;
+		auto& column = bc.bounds[0];
+		switch (bc.type)
+		{
+			case BindingConstraint::typeHourly:
+				for (int j = 0; j < problem.NombreDePasDeTemps; ++j)
+					assert(sndMemberRef[j] == column[PasDeTempsDebut + j]);
+				break;
+			case BindingConstraint::typeDaily:
+				for (uint d = 0; d != 7; ++d)
+					assert(sndMemberRef[d] == column[weekFirstDay + d]);
+				break;
+			default:
+				break;
+		}
+		bc.bounds.flush();
+	}
+}
+# endif
+
+
 void SIM_RenseignementProblemeHebdo(PROBLEME_HEBDO& problem, Antares::Solver::Variable::State & state, uint numSpace, const int PasDeTempsDebut)
 {
 	auto& study = *Data::Study::Current::Get();
@@ -395,6 +475,10 @@ void SIM_RenseignementProblemeHebdo(PROBLEME_HEBDO& problem, Antares::Solver::Va
 	const size_t pasDeTempsSizeDouble = problem.NombreDePasDeTemps * sizeof(double);
 	const size_t sizeOfIntercoDouble = sizeof(double) * studyruntime.interconnectionsCount;
 
+	// The data which remain the same throughout the year (see StudyRuntimeInfos)
+	// have already been copied by the previous weeks
+	const bool invariantDataAlreadyCopied = (problem.DonneesInvariantesRenseignees == OUI_ANTARES);
+
 	
 	const uint weekFirstDay = study.calendar.hours[PasDeTempsDebut].dayYear;
 
@@ -407,6 +491,7 @@ void SIM_RenseignementProblemeHebdo(PROBLEME_HEBDO& problem, Antares::Solver::Va
 		problem.numeroOptimisation[opt] = 0;
 		problem.coutOptimalSolution1[opt] = 0.;
 		problem.coutOptimalSolution2[opt] = 0.;
+		problem.nombreDIterationsDuSimplexe[opt] = 0;
 	}
 
 
@@ -422,12 +507,15 @@ void SIM_RenseignementProblemeHebdo(PROBLEME_HEBDO& problem, Antares::Solver::Va
 		{
 			COUTS_DE_TRANSPORT* couts = problem.CoutDeTransport[k];
 			couts->IntercoGereeAvecDesCouts = OUI_ANTARES;
-			const double* direct   = ((const double*)((void*)lnk->data[fhlHurdlesCostDirect])) + PasDeTempsDebut;
-			const double* indirect = ((const double*)((void*)lnk->data[fhlHurdlesCostIndirect])) + PasDeTempsDebut;
-			memcpy(couts->CoutDeTransportOrigineVersExtremite,    direct,   pasDeTempsSizeDouble);
-			memcpy(couts->CoutDeTransportOrigineVersExtremiteRef, direct,   pasDeTempsSizeDouble);
-			memcpy(couts->CoutDeTransportExtremiteVersOrigine,    indirect, pasDeTempsSizeDouble);
-			memcpy(couts->CoutDeTransportExtremiteVersOrigineRef, indirect, pasDeTempsSizeDouble);
+			if (not invariantDataAlreadyCopied or not studyruntime.linkWithConstantHurdlesCosts[k])
+			{
+				const double* direct   = ((const double*)((void*)lnk->data[fhlHurdlesCostDirect])) + PasDeTempsDebut;
+				const double* indirect = ((const double*)((void*)lnk->data[fhlHurdlesCostIndirect])) + PasDeTempsDebut;
+				memcpy(couts->CoutDeTransportOrigineVersExtremite,    direct,   pasDeTempsSizeDouble);
+				memcpy(couts->CoutDeTransportOrigineVersExtremiteRef, direct,   pasDeTempsSizeDouble);
+				memcpy(couts->CoutDeTransportExtremiteVersOrigine,    indirect, pasDeTempsSizeDouble);
+				memcpy(couts->CoutDeTransportExtremiteVersOrigineRef, indirect, pasDeTempsSizeDouble);
+			}
 		}
 		else
 			problem.CoutDeTransport[k]->IntercoGereeAvecDesCouts = NON_ANTARES;
@@ -450,6 +538,8 @@ void SIM_RenseignementProblemeHebdo(PROBLEME_HEBDO& problem, Antares::Solver::Va
 		{
 			
 			auto& bc = studyruntime.bindingConstraint[k];
+			if (invariantDataAlreadyCopied and bc.constantBounds)
+				continue;
 			switch (bc.type)
 			{
 				case BindingConstraint::typeHourly:
@@ -618,6 +708,8 @@ void SIM_RenseignementProblemeHebdo(PROBLEME_HEBDO& problem, Antares::Solver::Va
 			uint linkCount = studyruntime.interconnectionsCount;
 			for (uint k = 0; k != linkCount; ++k)
 			{
+				if (invariantDataAlreadyCopied and studyruntime.linkWithConstantNTC[k])
+					continue;
 				auto& lnk = *(studyruntime.areaLink[k]);
 				assert((uint)indx < lnk.data.height);
 				assert((uint) fhlNTCDirect < lnk.data.width);
@@ -628,16 +720,6 @@ void SIM_RenseignementProblemeHebdo(PROBLEME_HEBDO& problem, Antares::Solver::Va
 			}
 		}
 
-		
-		memcpy( (char *) problem.ValeursDeNTCRef[j]->ValeurDeNTCOrigineVersExtremite,
-				(char *) ntc->ValeurDeNTCOrigineVersExtremite,
-				sizeOfIntercoDouble);
-		memcpy( (char *) problem.ValeursDeNTCRef[j]->ValeurDeNTCExtremiteVersOrigine,
-				(char *) ntc->ValeurDeNTCExtremiteVersOrigine,
-				sizeOfIntercoDouble);
-		memcpy((char *)problem.ValeursDeNTCRef[j]->ValeurDeLoopFlowOrigineVersExtremite,
-			(char *)ntc->ValeurDeLoopFlowOrigineVersExtremite,
-			sizeOfIntercoDouble);
 
 		
 		
@@ -648,7 +730,7 @@ void SIM_RenseignementProblemeHebdo(PROBLEME_HEBDO& problem, Antares::Solver::Va
 			{
 				auto& bc = studyruntime.bindingConstraint[k];
 				
-				if (bc.type == BindingConstraint::typeHourly)
+				if (bc.type == BindingConstraint::typeHourly and not (invariantDataAlreadyCopied and bc.constantBounds))
 				{
 					auto& column = bc.bounds[0];
 					problem.MatriceDesContraintesCouplantes[k]->SecondMembreDeLaContrainteCouplante[j] =
@@ -1133,12 +1215,26 @@ void SIM_RenseignementProblemeHebdo(PROBLEME_HEBDO& problem, Antares::Solver::Va
 				(char *) problem.ReserveJMoins1[k]->ReserveHoraireJMoins1,
 				pasDeTempsSizeDouble);
 	}
-	for (int j = 0; j < problem.NombreDePasDeTemps; ++j)
-	{
-		memcpy( (char *) problem.ConsommationsAbattuesRef[j]->ConsommationAbattueDuPays,
-				(char *) problem.ConsommationsAbattues[j]->ConsommationAbattueDuPays,
-				nbPays * sizeof( double ));
-	}
+	
+	// The values of all time steps are contiguous (see SIM_AllocationProblemeHebdo)
+	memcpy( (char *) problem.ConsommationsAbattuesRef[0]->ConsommationAbattueDuPays,
+			(char *) problem.ConsommationsAbattues[0]->ConsommationAbattueDuPays,
+			problem.NombreDePasDeTemps * nbPays * sizeof( double ));
+	memcpy( (char *) problem.ValeursDeNTCRef[0]->ValeurDeNTCOrigineVersExtremite,
+			(char *) problem.ValeursDeNTC[0]->ValeurDeNTCOrigineVersExtremite,
+			problem.NombreDePasDeTemps * sizeOfIntercoDouble);
+	memcpy( (char *) problem.ValeursDeNTCRef[0]->ValeurDeNTCExtremiteVersOrigine,
+			(char *) problem.ValeursDeNTC[0]->ValeurDeNTCExtremiteVersOrigine,
+			problem.NombreDePasDeTemps * sizeOfIntercoDouble);
+	memcpy( (char *) problem.ValeursDeNTCRef[0]->ValeurDeLoopFlowOrigineVersExtremite,
+			(char *) problem.ValeursDeNTC[0]->ValeurDeLoopFlowOrigineVersExtremite,
+			problem.NombreDePasDeTemps * sizeOfIntercoDouble);
+
+	# ifndef NDEBUG
+	if (invariantDataAlreadyCopied)
+		VerifierLesDonneesInvariantes(problem, PasDeTempsDebut);
+	# endif
+	problem.DonneesInvariantesRenseignees = OUI_ANTARES;
 
 
 	# ifdef ANTARES_SWAP_SUPPORT
@@ -46,8 +46,8 @@ extern NUMERO_CHRONIQUES_TIREES_PAR_PAYS ***  NumeroChroniquesTireesParPays;
 /*-Economique-*/
 //extern PROBLEME_HEBDO                        ProblemeHebdo;
 /*-Adequation-*/
-extern PROBLEME_HORAIRE_ADEQUATION           ProblemeHoraireAdequation;
-extern VALEURS_ANNUELLES **                  ValeursAnnuellesAdequation;
+extern PROBLEME_HORAIRE_ADEQUATION *         ProblemeHoraireAdequation;  /* Par numSpace */
+extern VALEURS_ANNUELLES ***                 ValeursAnnuellesAdequation; /* Par numSpace puis par pays */
 
 /* Resultats */
 /*-Economique-*/
@@ -69,6 +69,9 @@ typedef struct
 	double                  *        QuellesNTCPrendre;               /* Indice par NombreDElementsChainage : contient le numero de l'interconnexion correspondante */
 	double                  *        ValeursEffectivesNTC;            /* vraies valeurs recuperees en utilisant QuellesNTCPrendre                                   */
 	long                             NombreDElementsChainage;
+	long                    *        ArcDepuisLaSource;               /* Indice par pays : element du chainage de l'arc source -> pays */
+	long                    *        ArcVersLePuits;                  /* Indice par pays : element du chainage de l'arc pays -> puits  */
+	char                    *        DefaillanceHorsReseauParHeure;   /* Indice par heure de l'annee : vaut OUI_SIM si au moins un pays est en defaillance hors reseau */
 	/* Utilise par l'algorithme de flot */
 	double                  *        FluxDeSecours;
 	double                  *        NTCDeReference;
@@ -572,6 +572,33 @@ typedef struct {
 } COUTS_MARGINAUX_ZONES_DE_RESERVE;
 
 
+/* Telemetrie du solveur : une mesure par resolution d'un intervalle optimise */
+typedef struct {
+	int    Annee;
+	int    Semaine;
+	int    NumeroDeLIntervalle;
+	int    NumeroDOptimisation;            /* PREMIERE_OPTIMISATION ou DEUXIEME_OPTIMISATION */
+	double TempsDeConstructionDeLaMatrice; /* en ms, pour l'ensemble des intervalles de la semaine */
+	double TempsDInitialisation;           /* en ms : bornes, second membre et couts de l'intervalle */
+	double TempsDeResolution;              /* en ms, y compris la reprise en mode secours */
+	int    NombreDIterations;
+	int    NombreDIterationsDePhase1;
+	int    NombreDeFactorisations;
+	char   Scaling;                        /* OUI_ANTARES si la derniere resolution a ete faite avec scaling */
+	char   ModeSecours;                    /* OUI_ANTARES si la resolution standard a echoue */
+	char   Succes;
+} MESURE_DU_SOLVEUR;
+
+
+typedef struct {
+	MESURE_DU_SOLVEUR * MesureDeLIntervalle; /* 7 : mesure en cours, par intervalle optimise */
+	MESURE_DU_SOLVEUR * Mesures;             /* Mesures pas encore ecrites dans le fichier de sortie */
+	int                 NombreDeMesures;
+	int                 NombreDeMesuresAllouees;
+	double              TempsDeConstructionDeLaMatrice;
+} TELEMETRIE_DU_SOLVEUR;
+
+
 
 
 
@@ -586,12 +613,26 @@ struct PROBLEME_HEBDO {
 
 
 	char OptimisationAuPasHebdomadaire;
+	/* OUI_ANTARES : au pas journalier, les intervalles d'une semaine sont resolus simultanement */
+	char ResolutionParalleleDesIntervalles;
 
 	
 	
 	
 		
 	char ReinitOptimisation; 
+	/* OUI_ANTARES une fois les donnees constantes sur l'annee (NTC, couts de transport, seconds membres
+	   des contraintes couplantes) recopiees : les semaines suivantes ne les recopient plus */
+	char DonneesInvariantesRenseignees;
+	/* OUI_ANTARES : la premiere semaine d'une annee repart de la base optimale de la premiere semaine
+	   de l'annee precedemment resolue sur le meme numSpace */
+	char DemarrageAChaudDuSimplexe;
+	/* Nombre de coeurs laisses libres par les annees resolues en parallele (au moins 1) :
+	   nombre maximum de threads du probleme (voir ThreadsDuProbleme) */
+	int NombreDeThreadsDuProbleme;
+	/* Nombre de threads de l'ajustement du nombre de groupes demarres des paliers (couts de demarrage),
+	   1 pour un ajustement sequentiel */
+	int NombreDeThreadsDesPaliers;
 															
 	char SecondeOptimisationRelaxee;						
 															
@@ -916,6 +957,12 @@ struct PROBLEME_HEBDO {
 	
 	double * coutOptimalSolution2;
 
+	/* Nombre d'iterations du simplexe de la semaine, par intervalle optimise */
+	int * nombreDIterationsDuSimplexe;
+
+	/* NULL si la telemetrie du solveur n'est pas demandee */
+	TELEMETRIE_DU_SOLVEUR * TelemetrieDuSolveur;
+
 
 	
 	
@@ -969,6 +1016,39 @@ struct PROBLEME_HEBDO {
 
 	Manoeuvrabilite manoeuvrabilite;
 
+	/*
+	** Zone memoire des donnees par pas de temps du probleme (une par numSpace).
+	** Chaque champ y occupe un bloc contigu [pas de temps][element], les copies
+	** et remises a zero d'une semaine se font donc en une operation par champ.
+	*/
+	class Arene
+	{
+	public:
+		Arene();
+		~Arene();
+
+		/* Bloc contigu et initialise a zero de 'nombre' elements */
+		template<class T> T* allouer(size_t nombre)
+		{
+			return (T*) allouerOctets(nombre * sizeof(T));
+		}
+
+		void* allouerOctets(size_t taille);
+
+		void liberer();
+
+	private:
+		struct Segment
+		{
+			Segment* suivant;
+			size_t   taille;
+			size_t   utilise;
+		};
+		Segment* pSegment;
+	};
+
+	Arene arene;
+
 	
 	double maxPminThermiqueByDay[366];
 
@@ -75,8 +75,8 @@ NUMERO_CHRONIQUES_TIREES_PAR_PAYS	***	NumeroChroniquesTireesParPays;
 
 
 
-PROBLEME_HORAIRE_ADEQUATION           ProblemeHoraireAdequation;
-VALEURS_ANNUELLES **                  ValeursAnnuellesAdequation;
+PROBLEME_HORAIRE_ADEQUATION *         ProblemeHoraireAdequation;
+VALEURS_ANNUELLES ***                 ValeursAnnuellesAdequation;
 
 
 RESULTATS_PAR_INTERCONNEXION **       ResultatsParInterconnexion;
@@ -62,17 +62,17 @@ void SIM_PreallocationTableaux(void);
 
 void SIM_RenseignementProblemeHebdo(PROBLEME_HEBDO& problem, Antares::Solver::Variable::State & state, uint numSpace, const int);
 
-void SIM_RenseignementProblemeHoraireAdequation(long);
+void SIM_RenseignementProblemeHoraireAdequation(long, uint numSpace);
 
 void SIM_RenseignementValeursPourTouteLAnnee(const Antares::Data::Study& study, uint numSpace);
 
-void SIM_CalculFlotHoraireAdequation(void);
+void SIM_CalculFlotHoraireAdequation(uint numSpace);
 
 void SIM_InitialisationProblemeHoraireAdequation(void);
 
 void SIM_AllocationProblemeHoraireAdequation(void);
 
-void SIM_AlgorithmeDeFlot(void);
+void SIM_AlgorithmeDeFlot(uint numSpace);
 
 void SIM_InitialisationChainagePourAdequation(void);
 
@@ -32,10 +32,14 @@
 # include <antares/logs.h>
 # include <yuni/core/string.h>
 # include "../variable/state.h"
+# include "../variable/summary.h"
 # include "../misc/options.h"
 # include "solver.data.h"
 # include "solver.utils.h"
 # include "../hydro/management/management.h"
+# include <yuni/thread/mutex.h>
+# include <yuni/thread/signal.h>
+# include <yuni/job/queue/service.h>
 
 # include "../../libs/antares/study/fwd.h"	// Added for definition of type PowerFluctuations
 
@@ -43,15 +47,22 @@ namespace Antares
 {
 namespace Solver
 {
+namespace TSGenerator
+{
+	class BackBuffer;
+}
+
 namespace Simulation
 {
 
 	template<class Impl> class yearJob;
+	template<class Impl> class tsGenerationJob;
 	
 	template<class Impl>
 	class ISimulation : public Impl
 	{
 		friend class yearJob<Impl>;
+		friend class tsGenerationJob<Impl>;
 	public:
 		//! The real implementation for the simulation
 		typedef Impl ImplementationType;
@@ -98,8 +109,11 @@ namespace Simulation
 	private:
 		/*!
 		** \brief Regenerate time-series if required for a given year
+		**
+		** \param buffer Back buffer receiving the time-series (null to regenerate them in place)
 		*/
-		template<bool PreproOnly> void regenerateTimeSeries(uint year);
+		template<bool PreproOnly>
+		void regenerateTimeSeries(uint year, Solver::TSGenerator::BackBuffer* buffer = nullptr);
 
 		/*!
 		** \brief Builds sets of parallel years
@@ -127,7 +141,8 @@ namespace Simulation
 		*/
 		void computeRandomNumbers(	randomNumbers & randomForYears,
 									std::vector<uint> & years,
-									std::map<unsigned int, bool> & isYearPerformed	);
+									std::map<unsigned int, bool> & isYearPerformed,
+									uint firstIndex = 0	);
 
 		/*!
 		** \brief Computes statistics on annual (system and solution) costs, to be printed in output into separate files
@@ -138,7 +153,24 @@ namespace Simulation
 		** Storing these costs to compute std deviation later.
 		*/
 		void computeAnnualCostsStatistics(	std::vector<Variable::State> & state,
-											std::vector<setOfParallelYears>::iterator & set_it	);
+											std::map<unsigned int, unsigned int> & spaceToPerformedYear	);
+
+		/*!
+		** \brief Adds the contribution of some performed years to the MC synthesis
+		**
+		** The years are merged in the order of their spaces, which must be the order of the years.
+		** \param state                 States of all spaces
+		** \param spaceToPerformedYear  Performed years to merge, indexed by their space
+		** \param nbPerformedYears      Number of years to merge
+		*/
+		void computeSummary(	std::vector<Variable::State> & state,
+								std::map<unsigned int, unsigned int> & spaceToPerformedYear,
+								uint nbPerformedYears	);
+
+		/*!
+		** \brief Notify the simulation that a year job is over (called from the job's thread)
+		*/
+		void notifyYearCompleted(uint y);
 
 		/*!
 		** \brief Iterate through all MC years
@@ -149,6 +181,36 @@ namespace Simulation
 		template<bool PerformCalculationsT>
 		void loopThroughYears(uint firstYear, uint endYear, std::vector<Variable::State> & state);
 
+		/*!
+		** \brief Run the sets of parallel years one after another
+		**
+		** All the years of a set must be over before the next set starts (hydro hot start,
+		** swap support).
+		*/
+		void runSetsOfParallelYears(	std::vector<setOfParallelYears> & setsOfParallelYears,
+										randomNumbers & randomForParallelYears,
+										std::vector<Variable::State> & state,
+										Yuni::Job::QueueService & qs	);
+
+		/*!
+		** \brief Stream the years to the workers, as soon as a space is available
+		**
+		** A year is started as soon as a space is released, and its results are merged
+		** into the synthesis as soon as all the previous years are merged. Barriers only remain
+		** where the time-series are regenerated. The results are identical to those of
+		** the sets of parallel years.
+		**
+		** If the refresh in background is enabled, the time-series of a refresh window are
+		** generated while the years of the previous window are simulated.
+		** The years are merged by the threads of the summary pool whose workers are idle.
+		*/
+		void streamThroughYears(	std::vector<setOfParallelYears> & setsOfParallelYears,
+									uint nbSpaces,
+									randomNumbers & randomForParallelYears,
+									std::vector<Variable::State> & state,
+									Yuni::Job::QueueService & qs,
+									Variable::SummaryThreadPool & summaryThreads	);
+
 
 	private:
 		//! Some temporary to avoid performing useless complex checks
@@ -168,6 +230,13 @@ namespace Simulation
 
 		//! Statistics about annual (system and solution) costs
 		annualCostsStatistics pAnnualCostsStatistics;
+
+		//! Years whose job is over, not yet handled by the main thread
+		std::vector<uint> pCompletedYears;
+		//! Mutex for the list of completed years
+		Yuni::Mutex pCompletedYearsMutex;
+		//! Signal raised each time a year job is over
+		Yuni::Thread::Signal pYearCompleted;
 	}; // class ISimulation
 
 } // namespace Simulation
@@ -39,6 +39,7 @@
 # include "../ts-generator/generator.h"
 # include <antares/memory/memory.h>
 
+#include "../optimisation/opt_fonctions.h"
 #include "../hydro/management.h"	// Added for use of randomReservoirLevel(...)
 
 #include <yuni/core/system/suspend.h>
@@ -119,11 +120,8 @@ namespace Simulation
 				if (performCalculations)
 				{
 					
-					// Index of the current year in the list of structures
-					uint indexYear = randomForParallelYears.yearNumberToIndex[y];
-
-					// Getting random tables for this year
-					yearRandomNumbers & randomForCurrentYear = randomForParallelYears.pYears[indexYear];
+					// Getting random tables for this year (stored at the index of the year's space)
+					yearRandomNumbers & randomForCurrentYear = randomForParallelYears.pYears[numSpace];
 					double ** thermalNoisesByArea = randomForCurrentYear.pThermalNoisesByArea;
 					double * randomReservoirLevel = nullptr;
 					if (not study.parameters.adequacyDraft())
@@ -212,10 +210,40 @@ namespace Simulation
 				if (Antares::Memory::swapSupport)
 					Antares::memory.flushAll();
 
+				// 11 - Notifying the simulation that this year is over
+				simulationObj->notifyYearCompleted(y);
+
 			}	// End of onExecute() method
 	};
 	
 	
+	/*!
+	** \brief Generation of the time-series of the next refresh window, into a back buffer
+	*/
+	template<class Impl>
+	class tsGenerationJob final : public Yuni::Job::IJob
+	{
+		public:
+			tsGenerationJob(ISimulation<Impl> * pSimulationObj, uint pYear,
+				Solver::TSGenerator::BackBuffer & pBuffer) :
+				simulationObj(pSimulationObj),
+				year(pYear),
+				buffer(pBuffer)
+			{}
+
+		private:
+			ISimulation<Impl> * simulationObj;
+			uint year;
+			Solver::TSGenerator::BackBuffer & buffer;
+
+		protected:
+			virtual void onExecute() override
+			{
+				simulationObj->template regenerateTimeSeries<false>(year, &buffer);
+			}
+	};
+
+
 	template<class Impl>
 	inline ISimulation<Impl>::ISimulation(Data::Study& study, const ::Settings& settings) :
 		ImplementationType(study),
@@ -973,7 +1001,7 @@ namespace Simulation
 
 	template<class Impl>
 	template<bool PreproOnly>
-	void ISimulation<Impl>::regenerateTimeSeries(uint year)
+	void ISimulation<Impl>::regenerateTimeSeries(uint year, Solver::TSGenerator::BackBuffer* buffer)
 	{
 		// A preprocessor can be launched for several reasons:
 		// * The option "Preprocessor" is checked in the interface _and_ year == 0
@@ -983,19 +1011,19 @@ namespace Simulation
 		using namespace Solver::TSGenerator;
 		// Load
 		if (pData.haveToRefreshTSLoad && (PreproOnly || !year || ((year % pData.refreshIntervalLoad) == 0)))
-			GenerateTimeSeries<Data::timeSeriesLoad>(study, year);
+			GenerateTimeSeries<Data::timeSeriesLoad>(study, year, buffer);
 		// Solar
 		if (pData.haveToRefreshTSSolar && (PreproOnly || !year || ((year % pData.refreshIntervalSolar) == 0)))
-			GenerateTimeSeries<Data::timeSeriesSolar>(study, year);
+			GenerateTimeSeries<Data::timeSeriesSolar>(study, year, buffer);
 		// Wind
 		if (pData.haveToRefreshTSWind && (PreproOnly || !year || ((year % pData.refreshIntervalWind) == 0)))
-			GenerateTimeSeries<Data::timeSeriesWind>(study, year);
+			GenerateTimeSeries<Data::timeSeriesWind>(study, year, buffer);
 		// Hydro
 		if (pData.haveToRefreshTSHydro && (PreproOnly || !year || ((year % pData.refreshIntervalHydro) == 0)))
-			GenerateTimeSeries<Data::timeSeriesHydro>(study, year);
+			GenerateTimeSeries<Data::timeSeriesHydro>(study, year, buffer);
 		// Thermal
 		if (pData.haveToRefreshTSThermal && (PreproOnly || !year || ((year % pData.refreshIntervalThermal) == 0)))
-			GenerateTimeSeries<Data::timeSeriesThermal>(study, year);
+			GenerateTimeSeries<Data::timeSeriesThermal>(study, year, buffer);
 	}
 
 
@@ -1161,19 +1189,20 @@ namespace Simulation
 	template<class Impl>
 	void ISimulation<Impl>::computeRandomNumbers(	randomNumbers & randomForYears,
 													std::vector<uint> & years,
-													std::map<unsigned int, bool> & isYearPerformed
+													std::map<unsigned int, bool> & isYearPerformed,
+													uint firstIndex
 												)
 	{
 		auto& runtime = * study.runtime;
 		
-		uint indexYear = 0;
+		// Index of the structure receiving the random numbers of the next performed year.
+		// It is the index of the year's space.
+		uint indexYear = firstIndex;
 		std::vector<unsigned int>::iterator ity;
 		for(ity = years.begin(); ity != years.end(); ++ity)
 		{
 			uint y = *ity;
 			bool isPerformed = isYearPerformed[y];
-			if (isPerformed)
-				randomForYears.yearNumberToIndex[y] = indexYear;
 
 			// logs.info() << "Year : " << y << " ------------";
 
@@ -1363,25 +1392,51 @@ namespace Simulation
 
 	template<class Impl>
 	void ISimulation<Impl>::computeAnnualCostsStatistics(std::vector<Variable::State> & state,
-														 std::vector<setOfParallelYears>::iterator & set_it)
+														 std::map<unsigned int, unsigned int> & spaceToPerformedYear)
 	{
 		assert(not study.parameters.adequacyDraft());
 		
-		// Loop over years contained in the set
-		std::vector<unsigned int>::iterator year_it;
-		for (year_it = set_it->yearsIndices.begin(); year_it != set_it->yearsIndices.end(); ++year_it)
+		// Loop over the spaces of the performed years (in the order of the years)
+		std::map<unsigned int, unsigned int>::iterator space_it;
+		for (space_it = spaceToPerformedYear.begin(); space_it != spaceToPerformedYear.end(); ++space_it)
 		{
-			// Get the index of the year
-			unsigned int y = *year_it;
-			if (set_it->isYearPerformed[y])
-			{
-				// Get space number associated to the performed year
-				uint numSpace = set_it->performedYearToSpace[y];
-				pAnnualCostsStatistics.systemCost.addCost(state[numSpace].annualSystemCost);
-				pAnnualCostsStatistics.criterionCost1.addCost(state[numSpace].optimalSolutionCost1);
-				pAnnualCostsStatistics.criterionCost2.addCost(state[numSpace].optimalSolutionCost2);
-			}
+			// Get space number associated to the performed year
+			uint numSpace = space_it->first;
+			pAnnualCostsStatistics.systemCost.addCost(state[numSpace].annualSystemCost);
+			pAnnualCostsStatistics.criterionCost1.addCost(state[numSpace].optimalSolutionCost1);
+			pAnnualCostsStatistics.criterionCost2.addCost(state[numSpace].optimalSolutionCost2);
+		}
+	}
+
+
+	template<class Impl>
+	void ISimulation<Impl>::computeSummary(	std::vector<Variable::State> & state,
+											std::map<unsigned int, unsigned int> & spaceToPerformedYear,
+											uint nbPerformedYears	)
+	{
+		// Computing the summary : adding the contribution of MC years 
+		// previously computed in parallel
+		ImplementationType::variables.computeSummary(spaceToPerformedYear, nbPerformedYears);
+
+		// Computing summary of spatial aggregations
+		ImplementationType::variables.computeSpatialAggregatesSummary(	ImplementationType::variables, 
+																		spaceToPerformedYear,
+																		nbPerformedYears	);
+
+		// Computes statistics on annual (system and solution) costs, to be printed in output into separate files
+		if (not study.parameters.adequacyDraft())
+			computeAnnualCostsStatistics(state, spaceToPerformedYear);
+	}
+
+
+	template<class Impl>
+	void ISimulation<Impl>::notifyYearCompleted(uint y)
+	{
+		{
+			Yuni::MutexLocker locker(pCompletedYearsMutex);
+			pCompletedYears.push_back(y);
 		}
+		pYearCompleted.notify();
 	}
 
 
@@ -1420,7 +1475,34 @@ namespace Simulation
 		Yuni::Job::QueueService qs;
 		// Number of threads to perform the jobs waiting in the queue
 		qs.maximumThreadCount(pNbMaxPerformedYearsInParallel);
+		// The threads merging the years into the synthesis, kept until the last year is merged
+		Variable::SummaryThreadPool summaryThreads(maxNbYearsPerformedInAset);
+
+		// With the hydro hot start, the initial reservoir levels of a year are the final levels
+		// of the year previously run on the same space : the sets of parallel years must be kept.
+		// The swap files are flushed by the jobs, which would invalidate the results being merged
+		// by the main thread.
+		if (pHydroHotStart || Antares::Memory::swapSupport)
+			runSetsOfParallelYears(setsOfParallelYears, randomForParallelYears, state, qs);
+		else
+			streamThroughYears(setsOfParallelYears, maxNbYearsPerformedInAset, randomForParallelYears, state, qs,
+				summaryThreads);
 
+		// Writing annual costs statistics 
+		if (not study.parameters.adequacyDraft())
+		{
+			pAnnualCostsStatistics.endStandardDeviations();
+			pAnnualCostsStatistics.writeToOutput();
+		}
+	}
+
+
+	template<class Impl>
+	void ISimulation<Impl>::runSetsOfParallelYears(	std::vector<setOfParallelYears> & setsOfParallelYears,
+													randomNumbers & randomForParallelYears,
+													std::vector<Variable::State> & state,
+													Yuni::Job::QueueService & qs	)
+	{
 		// Loop over sets of parallel years 
 		std::vector<setOfParallelYears>::iterator set_it;
 		for(set_it = setsOfParallelYears.begin(); set_it != setsOfParallelYears.end(); ++set_it)
@@ -1511,6 +1593,9 @@ namespace Simulation
 			qs.wait(Yuni::qseIdle);
 			qs.stop();
 
+			// The jobs notify their completion, useless here
+			pCompletedYears.clear();
+
 			// At this point, the first set of parallel year(s) was run
 			if(!pFirstSetParallelWasRun)
 				pFirstSetParallelWasRun = true;
@@ -1530,34 +1615,208 @@ namespace Simulation
 			if(foundFailure)
 			{
 				logs.fatal() << "At least one year has failed in the previous set of parallel year.";
+				// The MPS file of the problem without solution must be complete before exiting
+				OPT_AttendreLaFinDesEcrituresMPS();
 				AntaresSolverEmergencyShutdown();
 			}
 
 			// Computing the summary : adding the contribution of MC years 
 			// previously computed in parallel
-			ImplementationType::variables.computeSummary(set_it->spaceToPerformedYear, set_it->nbPerformedYears);
+			computeSummary(state, set_it->spaceToPerformedYear, set_it->nbPerformedYears);
 
-			
-			// Computing summary of spatial aggregations
-			ImplementationType::variables.computeSpatialAggregatesSummary(	ImplementationType::variables, 
-																			set_it->spaceToPerformedYear,
-																			set_it->nbPerformedYears	);
-
-			// Computes statistics on annual (system and solution) costs, to be printed in output into separate files
-			if (not study.parameters.adequacyDraft())
-				computeAnnualCostsStatistics(state, set_it);
-			
 			// Set to zero the random numbers of all parallel years
 			randomForParallelYears.reset();
 
 		} // End loop over sets of parallel years
+	}
 
-		// Writing annual costs statistics 
-		if (not study.parameters.adequacyDraft())
+
+	template<class Impl>
+	void ISimulation<Impl>::streamThroughYears(	std::vector<setOfParallelYears> & setsOfParallelYears,
+												uint nbSpaces,
+												randomNumbers & randomForParallelYears,
+												std::vector<Variable::State> & state,
+												Yuni::Job::QueueService & qs,
+												Variable::SummaryThreadPool & summaryThreads	)
+	{
+		// A year waiting to be merged into the synthesis
+		struct RunningYear
 		{
-			pAnnualCostsStatistics.endStandardDeviations();
-			pAnnualCostsStatistics.writeToOutput();
+			uint year;
+			uint numSpace;
+			bool performed;
+			std::map<uint, bool>* yearFailed;
+		};
+
+		// Free spaces (the lowest ones are taken first)
+		std::vector<uint> freeSpaces;
+		for (uint numSpace = nbSpaces; numSpace-- != 0; )
+			freeSpaces.push_back(numSpace);
+
+		// All years started, in the order of the years
+		std::vector<RunningYear> runningYears;
+		// Index (in runningYears) of the next year to merge into the synthesis
+		uint nextYearToMerge = 0;
+		// Years over, but not merged yet
+		std::set<uint> completedYears;
+		std::vector<uint> newlyCompletedYears;
+
+		// Merge into the synthesis all the years over, in the order of the years.
+		// If no year is over since the last call, wait for one of them.
+		auto mergeCompletedYears = [&]()
+		{
+			newlyCompletedYears.clear();
+			{
+				Yuni::MutexLocker locker(pCompletedYearsMutex);
+				newlyCompletedYears.swap(pCompletedYears);
+			}
+			if (newlyCompletedYears.empty())
+			{
+				pYearCompleted.waitAndReset();
+				return;
+			}
+			completedYears.insert(newlyCompletedYears.begin(), newlyCompletedYears.end());
+
+			while (nextYearToMerge < runningYears.size())
+			{
+				auto& running = runningYears[nextYearToMerge];
+				auto completed_it = completedYears.find(running.year);
+				if (completed_it == completedYears.end())
+					break;
+				completedYears.erase(completed_it);
+				++nextYearToMerge;
+
+				if (not running.performed)
+					continue;
+
+				// Same behavior as with sets of parallel years : we stop everything
+				if ((*running.yearFailed)[running.year])
+				{
+					logs.fatal() << "Year " << (running.year + 1) << " has failed.";
+					// The MPS file of the problem without solution must be complete before exiting
+					OPT_AttendreLaFinDesEcrituresMPS();
+					AntaresSolverEmergencyShutdown();
+				}
+
+				std::map<uint, uint> spaceToPerformedYear;
+				spaceToPerformedYear[running.numSpace] = running.year;
+				// Only the workers without any year (including the one of this year) merge it
+				summaryThreads.idleThreads((uint) freeSpaces.size() + 1);
+				computeSummary(state, spaceToPerformedYear, 1);
+
+				// The space is available for another year
+				randomForParallelYears.pYears[running.numSpace].reset();
+				freeSpaces.push_back(running.numSpace);
+			}
+		};
+
+		// The time-series of the next refresh window, generated while the years
+		// of the current window are simulated
+		const bool refreshInBackground = study.parameters.refreshInBackground;
+		Solver::TSGenerator::BackBuffer tsBackBuffer;
+		Yuni::Job::QueueService tsGeneration;
+		tsGeneration.maximumThreadCount(1);
+		bool tsGenerationPending = false;
+
+		qs.start();
+
+		auto end = setsOfParallelYears.end();
+		auto set_it = setsOfParallelYears.begin();
+		while (set_it != end)
+		{
+			// 1 - We may want to regenerate the time-series.
+			// All the years previously started are over and merged at this point.
+			if (set_it->regenerateTS)
+			{
+				if (tsGenerationPending)
+				{
+					// Already generated in background : the new time-series replace the old ones
+					tsGeneration.wait(Yuni::qseIdle);
+					tsGeneration.stop();
+					tsBackBuffer.swap();
+					tsGenerationPending = false;
+				}
+				else
+					regenerateTimeSeries<false>(set_it->yearForTSgeneration);
+			}
+
+			// All sets until the next regeneration of the time-series are run without any barrier
+			do
+			{
+				logs.info() << "parallel batch size : " << set_it->nbYears;
+
+				std::vector<unsigned int>::iterator year_it;
+				for (year_it = set_it->yearsIndices.begin(); year_it != set_it->yearsIndices.end(); ++year_it)
+				{
+					// Get the index of the year
+					unsigned int y = *year_it;
+
+					bool performCalculations = set_it->isYearPerformed[y];
+					unsigned int numSpace = 999999;
+					if (performCalculations)
+					{
+						// Waiting for an available space
+						while (freeSpaces.empty())
+							mergeCompletedYears();
+						numSpace = freeSpaces.back();
+						freeSpaces.pop_back();
+
+						study.runtime->timeseriesNumberYear[numSpace] = y;
+						study.runtime->currentYear[numSpace] = y;
+					}
+
+					// The random numbers are drawn in the order of the years, whether performed or not
+					std::vector<uint> currentYear(1, y);
+					computeRandomNumbers(randomForParallelYears, currentYear, set_it->isYearPerformed,
+						(performCalculations ? numSpace : 0));
+
+					RunningYear running;
+					running.year = y;
+					running.numSpace = numSpace;
+					running.performed = performCalculations;
+					running.yearFailed = &(set_it->yearFailed);
+					runningYears.push_back(running);
+
+					qs.add(
+							new yearJob<ImplementationType>(	this,
+																y,
+																set_it->yearsIndices,
+																set_it->yearFailed,
+																set_it->isFirstPerformedYearOfASet,
+																pFirstSetParallelWasRun,
+																numSpace, 
+																randomForParallelYears,
+																performCalculations,
+																study,
+																state,
+																pYearByYear
+															)
+							);
+				}
+				++set_it;
+			}
+			while (set_it != end && not set_it->regenerateTS);
+
+			// The time-series of the next window are generated while the years above are running
+			if (refreshInBackground && set_it != end)
+			{
+				tsGeneration.add(new tsGenerationJob<ImplementationType>(this, set_it->yearForTSgeneration,
+					tsBackBuffer));
+				tsGeneration.start();
+				tsGenerationPending = true;
+			}
+
+			// Barrier : all years must be over before regenerating the time-series
+			while (nextYearToMerge < runningYears.size())
+				mergeCompletedYears();
+
+			// At this point, the first set of parallel year(s) was run
+			if(!pFirstSetParallelWasRun)
+				pFirstSetParallelWasRun = true;
 		}
+
+		qs.wait(Yuni::qseIdle);
+		qs.stop();
 	}
 
 
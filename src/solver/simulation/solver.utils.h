@@ -357,19 +357,13 @@ namespace Simulation
 		void reset()
 		{
 			for (uint i = 0; i < pMaxNbPerformedYears; i++)	pYears[i].reset();
-
-			yearNumberToIndex.clear();
-
 		}
 
 	public:
 		uint pMaxNbPerformedYears;
+		// Random numbers of the performed years, indexed by the year's space (0, ..., max nb of parallel years - 1)
 		yearRandomNumbers * pYears;
 
-		// Associates : 
-		//		year number (0, ..., total nb of years to compute - 1) --> index of the year's space (0, ..., max nb of parallel years - 1)
-		std::map<uint, uint> yearNumberToIndex;
-
 	};
 
 	// Class representing a hydro cost noise.
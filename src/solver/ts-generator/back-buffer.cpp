@@ -0,0 +1,106 @@
+/*
+** Copyright 2007-2018 RTE
+** Authors: Antares_Simulator Team
+**
+** This file is part of Antares_Simulator.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** There are special exceptions to the terms and conditions of the
+** license as they are applied to this software. View the full text of
+** the exceptions in file COPYING.txt in the directory of this software
+** distribution
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with Antares_Simulator. If not, see <http://www.gnu.org/licenses/>.
+**
+** SPDX-License-Identifier: licenceRef-GPL3_WITH_RTE-Exceptions
+*/
+
+#include "back-buffer.h"
+
+using namespace Yuni;
+
+
+namespace Antares
+{
+namespace Solver
+{
+namespace TSGenerator
+{
+
+
+	BackBuffer::SeriesMatrix& BackBuffer::target(SeriesMatrix& series)
+	{
+		Entry* entry;
+		{
+			MutexLocker locker(pMutex);
+			entry = &(pEntries[&series]);
+		}
+		// Each matrix of the study is handled by a single generator at once
+		if (not entry->synchronized)
+		{
+			entry->copy.copyFrom(series);
+			entry->synchronized = true;
+		}
+		return entry->copy;
+	}
+
+
+	void BackBuffer::swap()
+	{
+		MutexLocker locker(pMutex);
+		auto end = pEntries.end();
+		for (auto it = pEntries.begin(); it != end; ++it)
+		{
+			auto& entry = it->second;
+			if (entry.synchronized)
+			{
+				it->first->swap(entry.copy);
+				entry.synchronized = false;
+			}
+		}
+
+		for (uint i = 0; i != (uint) pAssignments.size(); ++i)
+			pAssignments[i]();
+		pAssignments.clear();
+	}
+
+
+	void BackBuffer::clear()
+	{
+		MutexLocker locker(pMutex);
+		pEntries.clear();
+		pAssignments.clear();
+	}
+
+
+	bool BackBuffer::empty() const
+	{
+		MutexLocker locker(pMutex);
+		if (not pAssignments.empty())
+			return false;
+		auto end = pEntries.end();
+		for (auto it = pEntries.begin(); it != end; ++it)
+		{
+			if (it->second.synchronized)
+				return false;
+		}
+		return true;
+	}
+
+
+
+
+
+} // namespace TSGenerator
+} // namespace Solver
+} // namespace Antares
@@ -0,0 +1,164 @@
+/*
+** Copyright 2007-2018 RTE
+** Authors: Antares_Simulator Team
+**
+** This file is part of Antares_Simulator.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** There are special exceptions to the terms and conditions of the
+** license as they are applied to this software. View the full text of
+** the exceptions in file COPYING.txt in the directory of this software
+** distribution
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with Antares_Simulator. If not, see <http://www.gnu.org/licenses/>.
+**
+** SPDX-License-Identifier: licenceRef-GPL3_WITH_RTE-Exceptions
+*/
+#ifndef __ANTARES_SOLVER_TIME_SERIES_GENERATOR_BACK_BUFFER_H__
+# define __ANTARES_SOLVER_TIME_SERIES_GENERATOR_BACK_BUFFER_H__
+
+# include <yuni/yuni.h>
+# include <yuni/core/noncopyable.h>
+# include <yuni/thread/mutex.h>
+# include <antares/array/matrix.h>
+# include <map>
+# include <vector>
+# include <functional>
+
+
+namespace Antares
+{
+namespace Solver
+{
+namespace TSGenerator
+{
+
+	/*!
+	** \brief Back buffer for the time-series generated in advance
+	**
+	** The time-series of the next refresh window can be generated while the
+	** simulation still reads the current ones. When a back buffer is given to a
+	** generator, the generator writes into a private copy of each matrix
+	** (see `target()`) instead of the matrix of the study. All copies are then
+	** exchanged with the matrices of the study in one go by `swap()`, once
+	** no simulated year uses them anymore. The values derived from the generated
+	** time-series (see `assign()`) are updated at the same time.
+	*/
+	class BackBuffer final : private Yuni::NonCopyable<BackBuffer>
+	{
+	public:
+		//! Time-series matrix
+		typedef Matrix<double, Yuni::sint32> SeriesMatrix;
+
+	public:
+		/*!
+		** \brief Get the matrix to write into instead of a matrix of the study
+		**
+		** The first time a matrix is requested since the last swap, its copy is
+		** synchronized with the content of the study, so that a generator can
+		** rely on the previous content as it would with the matrix of the study.
+		** This method is thread-safe.
+		*/
+		SeriesMatrix& target(SeriesMatrix& series);
+
+		/*!
+		** \brief Assign a value of the study at the next swap
+		**
+		** Used for the values derived from the generated time-series (number of
+		** time-series, nominal capacity with spinning...), which are read by the
+		** simulated years as the matrices are.
+		** This method is thread-safe.
+		*/
+		template<class T> void assign(T& value, const T& newValue);
+
+		/*!
+		** \brief Exchange all the generated matrices with the ones of the study
+		**
+		** \warning No year must be simulated while swapping
+		*/
+		void swap();
+
+		//! Release all the copies
+		void clear();
+
+		//! Get if some matrices are waiting to be swapped
+		bool empty() const;
+
+	private:
+		struct Entry
+		{
+			Entry() : synchronized(false) {}
+			//! The copy of the matrix
+			SeriesMatrix copy;
+			//! True if the copy has been synchronized since the last swap
+			bool synchronized;
+		};
+
+	private:
+		//! All copies, ordered by the address of the matrix of the study
+		std::map<SeriesMatrix*, Entry> pEntries;
+		//! All assignments waiting for the next swap, in the order of the requests
+		std::vector<std::function<void ()> > pAssignments;
+		//! Mutex
+		mutable Yuni::Mutex pMutex;
+
+	}; // class BackBuffer
+
+
+
+	template<class T>
+	inline void BackBuffer::assign(T& value, const T& newValue)
+	{
+		Yuni::MutexLocker locker(pMutex);
+		T* address = &value;
+		pAssignments.push_back([address, newValue] () { *address = newValue; });
+	}
+
+
+	/*!
+	** \brief Get the matrix a generator should write into
+	**
+	** \param buffer The back buffer (null if the time-series are generated in place)
+	** \param series The matrix of the study
+	*/
+	inline BackBuffer::SeriesMatrix& TargetSeries(BackBuffer* buffer, BackBuffer::SeriesMatrix& series)
+	{
+		return (buffer) ? buffer->target(series) : series;
+	}
+
+
+	/*!
+	** \brief Assign a value derived from the generated time-series
+	**
+	** \param buffer The back buffer (null if the time-series are generated in place)
+	** \param value The value of the study
+	** \param newValue Its new value
+	*/
+	template<class T>
+	inline void AssignValue(BackBuffer* buffer, T& value, const T& newValue)
+	{
+		if (buffer)
+			buffer->assign(value, newValue);
+		else
+			value = newValue;
+	}
+
+
+
+
+
+} // namespace TSGenerator
+} // namespace Solver
+} // namespace Antares
+
+#endif // __ANTARES_SOLVER_TIME_SERIES_GENERATOR_BACK_BUFFER_H__
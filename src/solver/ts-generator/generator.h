@@ -31,6 +31,7 @@
 # include <antares/study/fwd.h>
 # include <antares/study/parameters.h>
 # include "xcast/xcast.h"
+# include "back-buffer.h"
 
 
 namespace Antares
@@ -43,9 +44,11 @@ namespace TSGenerator
 
 	/*!
 	** \brief Regenerate the time-series
+	**
+	** \param buffer Back buffer receiving the time-series (null to regenerate them in place)
 	*/
 	template<enum Data::TimeSeries T>
-	bool GenerateTimeSeries(Data::Study& study, uint year);
+	bool GenerateTimeSeries(Data::Study& study, uint year, BackBuffer* buffer = nullptr);
 
 
 	/*!
@@ -41,29 +41,29 @@ namespace TSGenerator
 
 	// forward declaration
 	// Thermal - see thermal.cpp
-	bool GenerateThermalTimeSeries(Data::Study& study, uint year);
+	bool GenerateThermalTimeSeries(Data::Study& study, uint year, BackBuffer* buffer);
 	// Hydro - see hydro.cpp
-	bool GenerateHydroTimeSeries(Data::Study& study, uint year);
+	bool GenerateHydroTimeSeries(Data::Study& study, uint year, BackBuffer* buffer);
 
 
 
 
 	template<>
-	inline bool GenerateTimeSeries<Data::timeSeriesThermal>(Data::Study& study, uint year)
+	inline bool GenerateTimeSeries<Data::timeSeriesThermal>(Data::Study& study, uint year, BackBuffer* buffer)
 	{
-		return GenerateThermalTimeSeries(study, year);
+		return GenerateThermalTimeSeries(study, year, buffer);
 	}
 
 	template<>
-	inline bool GenerateTimeSeries<Data::timeSeriesHydro>(Data::Study& study, uint year)
+	inline bool GenerateTimeSeries<Data::timeSeriesHydro>(Data::Study& study, uint year, BackBuffer* buffer)
 	{
-		return GenerateHydroTimeSeries(study, year);
+		return GenerateHydroTimeSeries(study, year, buffer);
 	}
 
 
 	// --- TS Generators using XCast ---
 	template<enum Data::TimeSeries T>
-	bool GenerateTimeSeries(Data::Study& study, uint year)
+	bool GenerateTimeSeries(Data::Study& study, uint year, BackBuffer* buffer)
 	{
 		auto* xcast = reinterpret_cast<XCast::XCast*>
 			(study.cacheTSGenerator[Data::TimeSeriesBitPatternIntoIndex<T>::value]);
@@ -77,23 +77,24 @@ namespace TSGenerator
 
 		// The current year
 		xcast->year = year;
+		xcast->buffer = buffer;
 
 		switch (T)
 		{
 			case Data::timeSeriesLoad:
-				xcast->random = &(study.runtime->random[Data::seedTsGenLoad]);
+				xcast->seed = study.parameters.seed[Data::seedTsGenLoad];
 				break;
 			case Data::timeSeriesSolar:
-				xcast->random = &(study.runtime->random[Data::seedTsGenSolar]);
+				xcast->seed = study.parameters.seed[Data::seedTsGenSolar];
 				break;
 			case Data::timeSeriesWind:
-				xcast->random = &(study.runtime->random[Data::seedTsGenWind]);
+				xcast->seed = study.parameters.seed[Data::seedTsGenWind];
 				break;
 			case Data::timeSeriesHydro:
-				xcast->random = &(study.runtime->random[Data::seedTsGenHydro]);
+				xcast->seed = study.parameters.seed[Data::seedTsGenHydro];
 				break;
 			default:
-				xcast->random = nullptr;
+				xcast->seed = 0;
 				assert(false and "invalid ts type");
 		}
 
@@ -37,6 +37,8 @@
 #include <antares/memory/memory.h>
 #include "../misc/cholesky.h"
 #include "../misc/matrix-dp-make.h"
+#include "back-buffer.h"
+#include <antares/array/factorization-cache.h>
 
 using namespace Antares;
 using namespace Yuni;
@@ -55,15 +57,15 @@ namespace TSGenerator
 {
 
 
-	static void PreproHydroInitMatrices(Data::Study& study, uint tsCount)
+	static void PreproHydroInitMatrices(Data::Study& study, uint tsCount, BackBuffer* buffer)
 	{
 		study.areas.each([&] (Data::Area& area)
 		{
 			auto& hydroseries = *(area.hydro.series);
 
-			hydroseries.ror.    resize(tsCount, HOURS_PER_YEAR);
-			hydroseries.storage.resize(tsCount, DAYS_PER_YEAR);
-			hydroseries.count  = tsCount;
+			TargetSeries(buffer, hydroseries.ror).    resize(tsCount, HOURS_PER_YEAR);
+			TargetSeries(buffer, hydroseries.storage).resize(tsCount, DAYS_PER_YEAR);
+			AssignValue(buffer, hydroseries.count, tsCount);
 
 			
 			hydroseries.flush();
@@ -71,21 +73,23 @@ namespace TSGenerator
 	}
 
 
-	static void PreproRoundAllEntriesPlusDerated(Data::Study& study)
+	static void PreproRoundAllEntriesPlusDerated(Data::Study& study, BackBuffer* buffer)
 	{
 		bool derated = study.parameters.derated;
 
 		study.areas.each([&] (Data::Area& area)
 		{
 			auto& hydroseries = *(area.hydro.series);
+			auto& ror     = TargetSeries(buffer, hydroseries.ror);
+			auto& storage = TargetSeries(buffer, hydroseries.storage);
 
-			hydroseries.ror.roundAllEntries();
-			hydroseries.storage.roundAllEntries();
+			ror.roundAllEntries();
+			storage.roundAllEntries();
 
 			if (derated)
 			{
-				hydroseries.ror.averageTimeseries();
-				hydroseries.storage.averageTimeseries();
+				ror.averageTimeseries();
+				storage.averageTimeseries();
 			}
 
 			
@@ -97,50 +101,16 @@ namespace TSGenerator
 
 
 
-	bool GenerateHydroTimeSeries(Data::Study& study, uint currentYear)
+	/*!
+	** \brief Get the factorization of the correlation matrix of the months of all areas
+	**
+	** The matrix does not change during a run, the factorization is computed
+	** once and kept in the cache of the study.
+	*/
+	static const Factorization<double>* FactorizationOfTheCorrelationMatrix(Data::Study& study, uint DIM)
 	{
-		
-		
-		
-		
-		
-		
-		
-
-		logs.info()  << "Generating the hydro time-series";
-
-		
-		Progression::Task progression(study, currentYear, Solver::Progression::sectTSGHydro);
-
-		
-		auto& studyRTI = *(study.runtime);
-		auto& calendar = study.calendar;
-
-		
-		uint DIM = 12 * study.areas.size();
-		uint DEM = DIM / 2;
-
-
-		Matrix<double> CHSKY;
-		CHSKY.reset(DIM, DIM);
+		double x;
 
-		double* QCHOLTemp  = new double[DIM];
-
-		Matrix<double> B;
-		B.reset(DIM, DIM);
-		double x, y, z, u;
-		double** nullmatrx = nullptr;
-
-		
-		
-		if (1. > MatrixDPMake<double>(CHSKY.entry, study.preproHydroCorrelation.annual->entry, B.entry, nullmatrx, study.areas.size(), QCHOLTemp, true))
-		{
-			logs.error() << "TS Generator: Hydro: Invalid correlation matrix";
-			AntaresSolverEmergencyShutdown(); 
-		}
-
-		CHSKY.flush();
-		B.flush();
 		Matrix<double> CORRE;
 		CORRE.reset(DIM, DIM);
 
@@ -176,25 +146,83 @@ namespace TSGenerator
 			}
 		}
 
+		uint64 key = FactorizationCache::Checksum<double>(MatrixCache::checksumOffsetBasis, CORRE.entry, DIM);
+		auto* factorization = study.correlationFactorizations.find<double>(key);
+		if (factorization)
+		{
+			logs.debug() << "  TS Generator: Hydro: reusing the factorization of the correlation matrix";
+			return factorization;
+		}
+
+		auto* chsky = new Factorization<double>();
+		chsky->L.reset(DIM, DIM);
+
+		double* QCHOLTemp  = new double[DIM];
+
+		Matrix<double> B;
+		B.reset(DIM, DIM);
+		double** nullmatrx = nullptr;
+
 		
+		
+		if (1. > MatrixDPMake<double>(chsky->L.entry, study.preproHydroCorrelation.annual->entry, B.entry, nullmatrx, study.areas.size(), QCHOLTemp, true))
 		{
-			double r = MatrixDPMake<double>(CHSKY.entry, CORRE.entry, B.entry, nullmatrx, DIM, QCHOLTemp, true);
-			if (r < 1.)
-			{
-				logs.warning() << " TS Generator: Hydro correlation matrix was shrinked by " << r;
-				if (r < 0.)
-					AntaresSolverEmergencyShutdown(); 
-			}
+			logs.error() << "TS Generator: Hydro: Invalid correlation matrix";
+			AntaresSolverEmergencyShutdown(); 
 		}
 
-		Cholesky<double>(CHSKY.entry, B.entry , DIM, QCHOLTemp);
+		
+		// MatrixDPMake() returns the factorization of the (possibly shrunk) matrix
+		chsky->rho = MatrixDPMake<double>(chsky->L.entry, CORRE.entry, B.entry, nullmatrx, DIM, QCHOLTemp, true);
+		if (chsky->rho < 0.)
+		{
+			logs.warning() << " TS Generator: Hydro correlation matrix was shrinked by " << chsky->rho;
+			AntaresSolverEmergencyShutdown(); 
+		}
+		chsky->L.flush();
 
 		
 		B.clear();
 		CORRE.clear();
 		
 		delete[] QCHOLTemp;
-		QCHOLTemp = nullptr;
+
+		return study.correlationFactorizations.add<double>(key, chsky);
+	}
+
+
+
+	bool GenerateHydroTimeSeries(Data::Study& study, uint currentYear, BackBuffer* buffer)
+	{
+		
+		
+		
+		
+		
+		
+		
+
+		logs.info()  << "Generating the hydro time-series";
+
+		
+		Progression::Task progression(study, currentYear, Solver::Progression::sectTSGHydro);
+
+		
+		auto& studyRTI = *(study.runtime);
+		auto& calendar = study.calendar;
+
+		
+		uint DIM = 12 * study.areas.size();
+		uint DEM = DIM / 2;
+
+
+		double x, y, z, u;
+
+		// The correlation matrix of the months of all areas, and its factorization
+		const Factorization<double>* chsky = FactorizationOfTheCorrelationMatrix(study, DIM);
+		if (chsky->rho < 1.)
+			logs.warning() << " TS Generator: Hydro correlation matrix was shrinked by " << chsky->rho;
+		auto& CHSKY = chsky->L;
 
 		double* NORM = new double[DIM];
 		for (uint i = 0; i != DIM; ++i)
@@ -204,7 +232,7 @@ namespace TSGenerator
 		uint nbTimeseries = studyRTI.parameters->nbTimeSeriesHydro;
 
 		
-		PreproHydroInitMatrices(study, nbTimeseries);
+		PreproHydroInitMatrices(study, nbTimeseries, buffer);
 
 		long  cumul = 0;
 
@@ -231,7 +259,9 @@ namespace TSGenerator
 				auto& area   = *(study.areas.byIndex[i / 12]);
 				auto& prepro = *area.hydro.prepro;
 				auto& series = *area.hydro.series;
-				auto& ror    = series.ror[l];
+				auto& seriesROR     = TargetSeries(buffer, series.ror);
+				auto& seriesStorage = TargetSeries(buffer, series.storage);
+				auto& ror    = seriesROR[l];
 
 				auto& colExpectation  = prepro.data[Data::PreproHydro::expectation];
 				auto& colStdDeviation = prepro.data[Data::PreproHydro::stdDeviation];
@@ -244,7 +274,7 @@ namespace TSGenerator
 				uint daysPerMonth     = calendar.months[month].days;
 
 				
-				assert(l < series.ror.width);
+				assert(l < seriesROR.width);
 				assert(not Math::NaN(colPOW[realmonth]));
 
 
@@ -335,7 +365,7 @@ namespace TSGenerator
 					dailyStorage = round(monthlyStorage * dailyInflowPattern / sumInflowPatterns);
 
 					
-					series.storage[l][d] = dailyStorage;
+					seriesStorage[l][d] = dailyStorage;
 
 					monthlyStorage -= dailyStorage;
 					sumInflowPatterns -= dailyInflowPattern;
@@ -359,7 +389,7 @@ namespace TSGenerator
 
 		
 		
-		PreproRoundAllEntriesPlusDerated(study);
+		PreproRoundAllEntriesPlusDerated(study, buffer);
 
 
 		if (0 != (study.parameters.timeSeriesToArchive & Data::timeSeriesHydro))
@@ -373,18 +403,19 @@ namespace TSGenerator
 			{
 				logs.info() << "Archiving the hydro time-series";
 				String output;
+				String folder;
 				study.areas.each([&] (const Data::Area& area)
 				{
-					study.buffer.clear() << study.folderOutput
+					folder.clear() << study.folderOutput
 						<< SEP << "ts-generator" << SEP << "hydro" << SEP
 						<< "mc-" << currentYear << SEP << area.id;
-					if (IO::Directory::Create(study.buffer))
+					if (IO::Directory::Create(folder))
 					{
-						output.clear() << study.buffer << SEP << "ror.txt";
-						area.hydro.series->ror.saveToCSVFile(output);
+						output.clear() << folder << SEP << "ror.txt";
+						TargetSeries(buffer, area.hydro.series->ror).saveToCSVFile(output);
 
-						output.clear() << study.buffer << SEP << "storage.txt";
-						area.hydro.series->storage.saveToCSVFile(output);
+						output.clear() << folder << SEP << "storage.txt";
+						TargetSeries(buffer, area.hydro.series->storage).saveToCSVFile(output);
 
 						
 						area.hydro.series->flush();
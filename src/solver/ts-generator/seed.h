@@ -0,0 +1,73 @@
+/*
+** Copyright 2007-2018 RTE
+** Authors: Antares_Simulator Team
+**
+** This file is part of Antares_Simulator.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** There are special exceptions to the terms and conditions of the
+** license as they are applied to this software. View the full text of
+** the exceptions in file COPYING.txt in the directory of this software
+** distribution
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with Antares_Simulator. If not, see <http://www.gnu.org/licenses/>.
+**
+** SPDX-License-Identifier: licenceRef-GPL3_WITH_RTE-Exceptions
+*/
+#ifndef __ANTARES_SOLVER_TIME_SERIES_GENERATOR_SEED_H__
+# define __ANTARES_SOLVER_TIME_SERIES_GENERATOR_SEED_H__
+
+# include <yuni/yuni.h>
+
+
+namespace Antares
+{
+namespace Solver
+{
+namespace TSGenerator
+{
+
+	//! Avalanche of a 32bits integer (finalizer of MurmurHash3)
+	inline uint MixSeed(uint h)
+	{
+		h ^= h >> 16;
+		h *= 0x85ebca6bu;
+		h ^= h >> 13;
+		h *= 0xc2b2ae35u;
+		h ^= h >> 16;
+		return h;
+	}
+
+
+	/*!
+	** \brief Seed of an independent random stream
+	**
+	** The stream is derived from the user seed, the year of the generation and
+	** the index of the item it is used for (a thermal cluster, a time-series...).
+	** The generated values thus depend neither on the order of the generation
+	** nor on the number of threads.
+	*/
+	inline uint StreamSeed(uint seed, uint year, uint index)
+	{
+		return MixSeed(MixSeed(MixSeed(seed) ^ (year + 0x9e3779b9u)) ^ (index + 0x7f4a7c15u));
+	}
+
+
+
+
+
+} // namespace TSGenerator
+} // namespace Solver
+} // namespace Antares
+
+#endif // __ANTARES_SOLVER_TIME_SERIES_GENERATOR_SEED_H__
@@ -28,11 +28,14 @@
 #include <yuni/yuni.h>
 #include <yuni/core/math.h>
 #include <yuni/core/string.h>
+#include <yuni/job/job.h>
+#include <yuni/job/queue/service.h>
 
 #include <antares/study.h>
 #include <antares/timeelapsed.h>
 #include <antares/logs.h>
 #include <antares/emergency.h>
+#include <antares/memory/memory.h>
 #include <antares/string-to-double.h>
 
 #include "../simulation/simulation.h"
@@ -41,6 +44,8 @@
 #include "../simulation/sim_structure_probleme_adequation.h"
 #include "../simulation/sim_extern_variables_globales.h"
 #include "../aleatoire/alea_fonctions.h"
+#include "back-buffer.h"
+#include "seed.h"
 
 using namespace Yuni;
 
@@ -173,7 +178,7 @@ namespace TSGenerator
 		{
 		public:
 			
-			GeneratorTempData(Data::Study& study, Solver::Progression::Task& progr);
+			GeneratorTempData(Data::Study& study, Solver::Progression::Task& progr, BackBuffer* buffer);
 
 			
 
@@ -185,6 +190,9 @@ namespace TSGenerator
 
 			void operator () (Data::Area& area, Data::ThermalCluster& cluster);
 
+			//! Reset the random generator for a given cluster (see StreamSeed())
+			void resetRandomGenerator(uint clusterIndex);
+
 		public:
 			
 			Data::Study& study;
@@ -198,6 +206,8 @@ namespace TSGenerator
 			
 			bool economyMode;
 			
+			BackBuffer* buffer;
+			
 			bool derated;
 
 
@@ -234,7 +244,7 @@ namespace TSGenerator
 			const uint daysPerYear;
 
 			
-			MersenneTwister& rndgenerator;
+			MersenneTwister rndgenerator;
 
 			
 			double AVP[366];
@@ -282,11 +292,12 @@ namespace TSGenerator
 
 
 
-		GeneratorTempData::GeneratorTempData(Data::Study& study, Solver::Progression::Task& progr) :
+		GeneratorTempData::GeneratorTempData(Data::Study& study, Solver::Progression::Task& progr,
+			BackBuffer* buffer) :
 			study(study),
+			buffer(buffer),
 			nbHoursPerYear(study.runtime->nbHoursPerYear),
 			daysPerYear(study.runtime->nbDaysPerYear),
-			rndgenerator(study.runtime->random[Data::seedTsGenThermal]),
 			pProgression(progr)
 		{
 			
@@ -305,6 +316,13 @@ namespace TSGenerator
 		}
 
 
+		void GeneratorTempData::resetRandomGenerator(uint clusterIndex)
+		{
+			rndgenerator.reset(StreamSeed(study.parameters.seed[Data::seedTsGenThermal], currentYear,
+				clusterIndex));
+		}
+
+
 		void GeneratorTempData::writeResultsToDisk(const Data::Area& area, const Data::ThermalCluster& cluster)
 		{
 			if (not study.parameters.noOutput)
@@ -321,7 +339,7 @@ namespace TSGenerator
 				
 				assert(cluster.series);
 				enum { precision = 0 }; 
-				cluster.series->series.saveToCSVFile(pTempFilename, precision);
+				TargetSeries(buffer, cluster.series->series).saveToCSVFile(pTempFilename, precision);
 			}
 
 			
@@ -456,7 +474,7 @@ namespace TSGenerator
 			if (0 == cluster.unitCount or 0 == cluster.nominalCapacity)
 			{
 				
-				cluster.series->series.reset(1, nbHoursPerYear);
+				TargetSeries(buffer, cluster.series->series).reset(1, nbHoursPerYear);
 				
 				if (archive)
 					writeResultsToDisk(area, cluster);
@@ -464,7 +482,8 @@ namespace TSGenerator
 			}
 
 			
-			cluster.series->series.resize(nbThermalTimeseries, nbHoursPerYear);
+			auto& series = TargetSeries(buffer, cluster.series->series);
+			series.resize(nbThermalTimeseries, nbHoursPerYear);
 			
 			const auto& preproData = *(cluster.prepro);
 
@@ -581,7 +600,7 @@ namespace TSGenerator
 				uint hour = 0;
 
 				if (tsIndex > 1)
-					dstSeries = &cluster.series->series[tsIndex - 2];
+					dstSeries = &series[tsIndex - 2];
 
 				
 				for (uint dayInTheYear = 0; dayInTheYear < daysPerYear; ++dayInTheYear)
@@ -892,20 +911,109 @@ namespace TSGenerator
 
 			
 			if (derated)
-				cluster.series->series.averageTimeseries();
+				series.averageTimeseries();
 			
 			if (archive)
 				writeResultsToDisk(area, cluster);
 			
 			if (economyMode)
-				cluster.calculationOfSpinning();
+				AssignValue(buffer, cluster.nominalCapacityWithSpinning, cluster.calculationOfSpinning(series));
 		}
+
+
+
+		//! All the thermal clusters of the study, in a stable order
+		class ThermalClusterQueue final
+		{
+		public:
+			typedef std::pair<Data::Area*, Data::ThermalCluster*> Item;
+
+		public:
+			explicit ThermalClusterQueue(Data::Study& study) :
+				pNext(0)
+			{
+				study.areas.each([&] (Data::Area& area)
+				{
+					auto end = area.thermal.list.mapping.end();
+					for (auto it = area.thermal.list.mapping.begin(); it != end; ++it)
+						pClusters.push_back(Item(&area, it->second));
+				});
+			}
+
+			uint size() const
+			{
+				return (uint) pClusters.size();
+			}
+
+			const Item& operator [] (uint index) const
+			{
+				return pClusters[index];
+			}
+
+			//! Get the index of the next cluster to generate, false when all have been taken
+			bool next(uint& index)
+			{
+				MutexLocker locker(pMutex);
+				if (pNext >= (uint) pClusters.size())
+					return false;
+				index = pNext++;
+				return true;
+			}
+
+		private:
+			std::vector<Item> pClusters;
+			uint pNext;
+			Mutex pMutex;
+		};
+
+
+		class ThermalGeneratorJob final : public Yuni::Job::IJob
+		{
+		public:
+			ThermalGeneratorJob(Data::Study& study, ThermalClusterQueue& queue,
+				Solver::Progression::Task& progression, uint year, bool archive, BackBuffer* buffer) :
+				study(study),
+				queue(queue),
+				progression(progression),
+				year(year),
+				archive(archive),
+				buffer(buffer)
+			{}
+
+		protected:
+			virtual void onExecute() override
+			{
+				// Scratch arrays owned by this thread only
+				auto* generator = new GeneratorTempData(study, progression, buffer);
+				generator->currentYear = year;
+				generator->archive = archive;
+
+				uint index;
+				while (queue.next(index))
+				{
+					auto& item = queue[index];
+					generator->resetRandomGenerator(index);
+					(*generator)(*item.first, *item.second);
+					++progression;
+				}
+				delete generator;
+			}
+
+		private:
+			Data::Study& study;
+			ThermalClusterQueue& queue;
+			Solver::Progression::Task& progression;
+			uint year;
+			bool archive;
+			BackBuffer* buffer;
+		};
+
 	} 
 
 
 
 
-	bool GenerateThermalTimeSeries(Data::Study& study, uint year)
+	bool GenerateThermalTimeSeries(Data::Study& study, uint year, BackBuffer* buffer)
 	{
 		
 		logs.info();
@@ -914,7 +1022,7 @@ namespace TSGenerator
 
 		
 		
-		auto* generator = new GeneratorTempData(study, progression);
+		auto* generator = new GeneratorTempData(study, progression, buffer);
 		
 		generator->currentYear = year;
 
@@ -922,21 +1030,24 @@ namespace TSGenerator
 		if (generator->archive)
 			generator->prepareOutputFoldersForAllAreas(year);
 
-		# ifdef ANTARES_SWAP_SUPPORT
-		auto& swap = Antares::memory;
-		# endif
+		ThermalClusterQueue queue(study);
 
-		
-		study.areas.each([&] (Data::Area& area)
+		uint nbThreads = study.maxNbYearsInParallel;
+		if (nbThreads > queue.size())
+			nbThreads = queue.size();
+
+		// The swap files can not be flushed concurrently
+		if (Antares::Memory::swapSupport or nbThreads <= 1)
 		{
-			
-			auto end = area.thermal.list.mapping.end();
-			for (auto it = area.thermal.list.mapping.begin(); it != end; ++it)
+			# ifdef ANTARES_SWAP_SUPPORT
+			auto& swap = Antares::memory;
+			# endif
+
+			for (uint i = 0; i != queue.size(); ++i)
 			{
-				
-				auto& cluster = *(it->second);
-				
-				(*generator)(area, cluster);
+				auto& item = queue[i];
+				generator->resetRandomGenerator(i);
+				(*generator)(*item.first, *item.second);
 
 				
 				++progression;
@@ -946,7 +1057,19 @@ namespace TSGenerator
 				swap.flushAll();
 				# endif
 			}
-		});
+		}
+		else
+		{
+			logs.info() << "  " << queue.size() << " thermal clusters, " << nbThreads << " threads";
+
+			Yuni::Job::QueueService qs;
+			qs.maximumThreadCount(nbThreads);
+			for (uint t = 0; t != nbThreads; ++t)
+				qs.add(new ThermalGeneratorJob(study, queue, progression, year, generator->archive, buffer));
+			qs.start();
+			qs.wait(Yuni::qseIdle);
+			qs.stop();
+		}
 
 		
 		delete generator;
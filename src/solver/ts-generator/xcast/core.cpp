@@ -32,6 +32,7 @@
 #include "constants.h"
 #include "../../misc/cholesky.h"
 #include "../../misc/matrix-dp-make.h"
+#include <antares/array/factorization-cache.h>
 #include "math.hxx"
 
 
@@ -49,12 +50,102 @@ namespace XCast
 {
 
 
-	bool XCast::generateValuesForTheCurrentDay()
+	bool XCast::prepareCorrelationMatrices()
+	{
+		const uint processCount = (uint) pData.localareas.size();
+
+		float** triangle = new float*[processCount];
+		for (uint i = 0; i != processCount; ++i)
+			triangle[i] = new float[processCount];
+		float* temp = new float[processCount];
+
+		bool success = true;
+		for (uint month = 0; month != 12 and success; ++month)
+		{
+			auto* corrMonth = pData.correlation[study.calendar.months[month].realmonth];
+
+			if (Cholesky<float>(triangle, corrMonth->entry, processCount, temp))
+			{
+				// C n'est pas sdp, mais peut-etre proche de sdp
+				// on tente un abattement de 0.999
+				for (uint i = 0; i != processCount; ++i)
+				{
+					// on ne traite qu'en dessous de la diagonale et celle-ci n'a pas change (=1 partout)
+					for (uint j = 0; j < i; ++j)
+						corrMonth->entry[i][j] *= 0.999f;
+				}
+
+				if (Cholesky<float>(triangle, corrMonth->entry, processCount, temp))
+				{
+					// la matrice C n'est pas admissible, on abandonne
+					logs.error() << "TS " << pTSName << " generator: invalid correlation matrix";
+					success = false;
+				}
+			}
+		}
+
+		for (uint i = 0; i != processCount; ++i)
+			delete[] triangle[i];
+		delete[] triangle;
+		delete[] temp;
+		return success;
+	}
+
+
+	float XCast::Worker::factorizeCorrelationMatrixOfTheMonth(uint processCount)
+	{
+		auto& cache = xcast.study.correlationFactorizations;
+
+		uint64 key = FactorizationCache::Checksum<float>(MatrixCache::checksumOffsetBasis, CORR, processCount);
+		key = FactorizationCache::Checksum<float>(key, pCorrMonth->entry, processCount);
+
+		auto* factorization = cache.find<float>(key);
+		if (factorization)
+		{
+			auto& cachedL = factorization->L;
+			auto& cachedB = factorization->B;
+			for (uint s = 0; s != processCount; ++s)
+			{
+				for (uint t = 0; t <= s; ++t)
+				{
+					Triangle_courant[s][t] = cachedL[s][t];
+					Carre_reference[s][t]  = cachedB[s][t];
+				}
+			}
+			return factorization->rho;
+		}
+
+		float shrink = MatrixDPMake<float>(Triangle_courant, CORR, Carre_reference, pCorrMonth->entry, processCount, pQCHOLTotal);
+		if (shrink != -1.f)
+		{
+			auto* newFactorization = new Factorization<float>();
+			newFactorization->rho = shrink;
+			auto& L = newFactorization->L;
+			auto& B = newFactorization->B;
+			L.reset(processCount, processCount);
+			B.reset(processCount, processCount);
+			for (uint s = 0; s != processCount; ++s)
+			{
+				for (uint t = 0; t <= s; ++t)
+				{
+					L[s][t] = Triangle_courant[s][t];
+					B[s][t] = Carre_reference[s][t];
+				}
+			}
+			L.flush();
+			B.flush();
+			cache.add<float>(key, newFactorization);
+		}
+		return shrink;
+	}
+
+
+	bool XCast::Worker::generateValuesForTheCurrentDay()
 	{
 		enum { nbHoursADay = 24, };
 
 		// The number of processes
-		uint processCount = (uint) pData.localareas.size();
+		uint processCount = (uint) xcast.pData.localareas.size();
 		// shrink
 		float shrink;
 
@@ -65,17 +156,17 @@ namespace XCast
 		// NDP
 		uint Compteur_ndp = 0;
 
-		// si le code est appele pour la premiere fois, on initialise tous les
-		// processus par l'esperance des lois marginales
-		if (pNeverInitialized)
+		// au debut de chaque serie, on initialise tous les processus par
+		// l'esperance des lois marginales
+		if (pNewSeries)
 		{
-			pNeverInitialized = false;
+			pNewSeries = false;
 			pNewMonth = true;
 			for (uint s = 0; s != processCount; ++s)
 			{
 				if (!verification(A[s], B[s], G[s], D[s], L[s], T[s]))
 				{
-					logs.error() << "TS " << pTSName << " generator: invalid local parameters (" << (s + 1) << ')';
+					logs.error() << "TS " << xcast.pTSName << " generator: invalid local parameters (" << (s + 1) << ')';
 					return false;
 				}
 				// Il s'agit d'une position relative par rapport a l'esperance
@@ -98,24 +189,8 @@ namespace XCast
 		// si les parametres ont change on reinitialise certaines variables intermediaires
 		if (pNewMonth)
 		{
-			if (Cholesky<float>(Triangle_courant, pCorrMonth->entry, processCount, pQCHOLTotal))
-			{
-				// C n'est pas sdp, mais peut-etre proche de sdp
-				// on tente un abattement de 0.999
-				for (uint i = 0; i != processCount; ++i)
-				{
-					// on ne traite qu'en dessous de la diagonale et celle-ci n'a pas change (=1 partout)
-					for (uint j = 0; j < i; ++j)
-						pCorrMonth->entry[i][j] *= 0.999f;
-				}
-
-				if (Cholesky<float>(Triangle_courant, pCorrMonth->entry, processCount, pQCHOLTotal))
-				{
-					// la matrice C n'est pas admissible, on abandonne
-					logs.error() << "TS " << pTSName << " generator: invalid correlation matrix";
-					return false;
-				}
-			}
+			// la matrice du mois a deja ete verifiee (et eventuellement abattue)
+			// par XCast::prepareCorrelationMatrices()
 
 			for (uint s = 0; s != processCount; ++s)
 			{
@@ -131,7 +206,7 @@ namespace XCast
 				{
 					// les bornes d'ecretement du processus n'encadrent pas l'esperance
 					// de sa loi marginale
-					logs.error() << "TS " << pTSName << " generator: invalid local parameters";
+					logs.error() << "TS " << xcast.pTSName << " generator: invalid local parameters";
 					return false;
 				}
 				D_COPIE[s] = diffusion(A[s], B[s], G[s], D[s], L[s], T[s], ESPE[s]);
@@ -220,11 +295,11 @@ namespace XCast
 			}
 
 			// calcul et factorisation de la matrice  du mois
-			shrink = MatrixDPMake<float>(Triangle_courant, CORR, Carre_reference, pCorrMonth->entry, processCount, pQCHOLTotal);
+			shrink = factorizeCorrelationMatrixOfTheMonth(processCount);
 			if (shrink == -1.f)
 			{
 				// sortie impossible  car on a vrifi que C est d.p
-				logs.error() << "TS " << pTSName << " generator: invalid correlation matrix";
+				logs.error() << "TS " << xcast.pTSName << " generator: invalid correlation matrix";
 				return false;
 			}
 			// sert pour le decompte final des matrices ndp quand accuracy=0
@@ -413,7 +488,7 @@ namespace XCast
 							if (shrink == -1.f)
 							{
 								// sortie impossible  car on a vrifi que C est d.p
-								logs.error() << "TS " << pTSName << " generator: invalid correlation matrix";
+								logs.error() << "TS " << xcast.pTSName << " generator: invalid correlation matrix";
 								return false;
 							}
 							if (shrink < 1.f)
@@ -66,18 +66,16 @@ namespace XCast
 
 
 
-	void XCast::normal(float& x, float& y)
+	void XCast::Worker::normal(float& x, float& y)
 	{
-		assert(random != NULL);
-
 		double z;
 		double xd;
 		double yd;
 
 		do
 		{
-			xd = 2. * random->next() - 1.;
-			yd = 2. * random->next() - 1.;
+			xd = 2. * random.next() - 1.;
+			yd = 2. * random.next() - 1.;
 			z  = (xd * xd) + (yd * yd);
 		}
 		while (z > 1.);
@@ -61,6 +61,9 @@
 #include <yuni/io/directory.h>
 #include <antares/memory/memory.h>
 #include <antares/study/area/constants.h>
+#include <yuni/job/job.h>
+#include <yuni/job/queue/service.h>
+#include "../seed.h"
 
 
 using namespace Yuni;
@@ -95,14 +98,18 @@ namespace XCast
 	XCast::XCast(Data::Study& study, Data::TimeSeries ts) :
 		study(study),
 		timeSeriesType(ts),
+		seed(0),
+		buffer(nullptr),
 		pNeverInitialized(true),
-		pAccuracyOnCorrelation(false)
+		pAccuracyOnCorrelation(false),
+		pNextTimeSeries(0),
+		pUseConversion(nullptr)
 	{}
 
 
 	XCast::~XCast()
 	{
-		destroyTemporaryData();
+		delete[] pUseConversion;
 	}
 
 
@@ -133,7 +140,7 @@ namespace XCast
 				study.areas.each([&] (Data::Area& area)
 				{
 					filename.clear() << output << SEP << area.id << ".txt";
-					predicate.matrix(area).saveToCSVFile(filename);
+					TargetSeries(buffer, predicate.matrix(area)).saveToCSVFile(filename);
 
 					
 					++progression;
@@ -147,7 +154,7 @@ namespace XCast
 
 
 	template<class PredicateT>
-	void XCast::applyTransferFunction(PredicateT& predicate)
+	void XCast::Worker::applyTransferFunction(PredicateT& predicate)
 	{
 		
 		
@@ -175,13 +182,13 @@ namespace XCast
 		float* dailyResults;
 
 		
-		const uint processCount = (uint) pData.localareas.size();
+		const uint processCount = (uint) xcast.pData.localareas.size();
 
 		for (uint s = 0; s != processCount; ++s)
 		{
-			if (pUseConversion[s])
+			if (xcast.pUseConversion[s])
 			{
-				auto& data = predicate.xcastData(*(pData.localareas[s]));
+				auto& data = predicate.xcastData(*(xcast.pData.localareas[s]));
 				
 				auto& tf = data.conversion;
 
@@ -328,9 +335,20 @@ namespace XCast
 
 
 
-	void XCast::allocateTemporaryData()
+	XCast::Worker::Worker(XCast& xcast) :
+		pComputedPointCount(0),
+		pNDPMatrixCount(0),
+		pLevellingCount(0),
+		pCorrelationMatrixCount(0),
+		xcast(xcast),
+		pCorrMonth(nullptr),
+		pNewSeries(true),
+		Nombre_points_intermediaire(0),
+		pNewMonth(true),
+		pAccuracyOnCorrelation(false),
+		All_normal(false)
 	{
-		uint p = (uint) pData.localareas.size();
+		uint p = (uint) xcast.pData.localareas.size();
 
 		Allocator<Yuni::Logs::Verbosity::Debug::enabled> m;
 
@@ -360,8 +378,6 @@ namespace XCast
 
 		D_COPIE = m.allocate<float>(p);
 
-		pUseConversion = m.allocate<bool>(p);
-
 		Presque_maxi = m.allocate<float>(p);
 		Presque_mini = m.allocate<float>(p);
 		pQCHOLTotal  = m.allocate<float>(p);
@@ -392,57 +408,290 @@ namespace XCast
 	}
 
 
-	void XCast::destroyTemporaryData()
+	XCast::Worker::~Worker()
+	{
+		uint p = (uint) xcast.pData.localareas.size();
+		for (uint i = 0; i != p; ++i)
+		{
+			delete[] CORR[i];
+			delete[] FO[i];
+			delete[] LISS[i];
+			delete[] DATL[i];
+			delete[] Triangle_reference[i];
+			delete[] Triangle_courant[i];
+			delete[] DATA[i];
+			delete[] Carre_courant[i];
+			delete[] Carre_reference[i];
+		}
+		delete[] Carre_courant;
+		delete[] Carre_reference;
+		delete[] D_COPIE;
+		delete[] DATA;
+		delete[] Triangle_reference;
+		delete[] Triangle_courant;
+		delete[] LISS;
+		delete[] DATL;
+		delete[] CORR;
+		delete[] FO;
+		delete[] A;
+		delete[] B;
+		delete[] G;
+		delete[] D;
+		delete[] M;
+		delete[] T;
+		delete[] L;
+		delete[] BO;
+		delete[] MA;
+		delete[] MI;
+		delete[] POSI;
+		delete[] MAXI;
+		delete[] MINI;
+		delete[] Presque_maxi;
+		delete[] Presque_mini;
+		delete[] ESPE;
+		delete[] STDE;
+		delete[] DIFF;
+		delete[] TREN;
+		delete[] WIEN;
+		delete[] BROW;
+		delete[] pQCHOLTotal;
+	}
+
+
+	template<class PredicateT>
+	void XCast::Worker::generate(uint tsIndex, PredicateT& predicate, Progression::Task& progression)
 	{
-		if (!pNeverInitialized)
+		enum
 		{
-			uint p = (uint) pData.localareas.size();
-			for (uint i = 0; i != p; ++i)
+			
+			nbHoursADay = 24,
+		};
+
+		const uint processCount = (uint) xcast.pData.localareas.size();
+
+		// A new time-series, with its own random stream
+		random.reset(StreamSeed(xcast.seed, xcast.year, tsIndex));
+		pNewSeries = true;
+		pAccuracyOnCorrelation = xcast.pAccuracyOnCorrelation;
+
+		
+		uint hourInTheYear = 0;
+
+		
+		
+		
+		for (uint month = 0; month != 12; ++month)
+		{
+			
+			uint realmonth = xcast.study.calendar.months[month].realmonth;
+
+			
+			pNewMonth = true;
+			
+			pCorrMonth = xcast.pData.correlation[realmonth];
+
+			
+			for (uint s = 0; s != processCount; ++s)
 			{
-				delete[] CORR[i];
-				delete[] FO[i];
-				delete[] LISS[i];
-				delete[] DATL[i];
-				delete[] Triangle_reference[i];
-				delete[] Triangle_courant[i];
-				delete[] DATA[i];
-				delete[] Carre_courant[i];
-				delete[] Carre_reference[i];
+				assert(s < xcast.pData.localareas.size() && "Bound checking");
+				auto& xcastdata = predicate.xcastData(*(xcast.pData.localareas[s]));
+				A[s] = xcastdata.data       [alpha] [realmonth];
+				B[s] = xcastdata.data       [beta]  [realmonth];
+				G[s] = xcastdata.data       [gamma] [realmonth];
+				D[s] = xcastdata.data       [delta] [realmonth];
+				M[s] = (int) xcastdata.data [mu]    [realmonth];
+				T[s] = xcastdata.data       [theta] [realmonth];
+				L[s] = xcastdata.distribution;
+
+				switch (xcastdata.distribution)
+				{
+					case Data::XCast::dtUniform:
+						{
+							BO[s] = true;
+							MI[s] = G[s];
+							MA[s] = D[s];
+							break;
+						}
+					case Data::XCast::dtBeta:
+						{
+							BO[s] = true;
+							MI[s] = G[s];
+							MA[s] = D[s];
+							break;
+						}
+					case Data::XCast::dtNormal:
+						{
+							BO[s] = false;
+							MI[s] = - std::numeric_limits<float>::max();
+							MA[s] = + std::numeric_limits<float>::max();
+							break;
+						}
+					default:
+						{
+							BO[s] = false;
+							MI[s] = G[s];
+							MA[s] = + std::numeric_limits<float>::max();
+						}
+				}
+				memcpy(FO[s], xcastdata.K[realmonth], sizeof(float) * nbHoursADay);
+
+				
+				xcastdata.data.flush();
+				xcastdata.K.flush();
+			}
+
+			uint nbDaysPerMonth = xcast.study.calendar.months[month].days;
+			for (uint j = 0; j != nbDaysPerMonth; ++j)
+			{
+				const uint pointCount = pComputedPointCount;
+				if (not generateValuesForTheCurrentDay())
+					AntaresSolverEmergencyShutdown(); 
+				// a matrix for each point if the accuracy on correlation is required, a matrix a day otherwise
+				pCorrelationMatrixCount += (pAccuracyOnCorrelation) ? (pComputedPointCount - pointCount) : 1;
+
+				# ifndef NDEBUG
+				
+				for (uint s = 0; s != processCount; ++s)
+				{
+					float* dailyResults  = DATA[s];
+					
+					for (uint h = 0; h != nbHoursADay; ++h)
+					{
+						assert(0 == Math::Infinite(dailyResults[h]) && "Infinite value");
+					}
+				}
+				# endif
+
+
+				
+				for (uint s = 0; s != processCount; ++s)
+				{
+					assert(s < xcast.pData.localareas.size() && "Bound checking");
+					auto& currentArea = *xcast.pData.localareas[s];
+					
+					auto& srcData = predicate.xcastData(currentArea);
+					if (srcData.useTranslation != Data::XCast::tsTranslationBeforeConversion)
+						continue;
+
+					
+					auto& column = srcData.translation[0];
+					float* dailyResults  = DATA[s];
+					assert(hourInTheYear + nbHoursADay <= srcData.translation.height && "Bound checking");
+
+					
+					for (uint h = 0; h != nbHoursADay; ++h)
+					{
+						assert(0 == Math::Infinite(dailyResults[h]) && "Infinite value");
+						dailyResults[h] += (float) column[hourInTheYear + h];
+					}
+
+					
+					srcData.translation.flush();
+				}
+
+				
+				applyTransferFunction(predicate);
+
+				# ifndef NDEBUG
+				
+				for (uint s = 0; s != processCount; ++s)
+				{
+					float* dailyResults  = DATA[s];
+					
+					for (uint h = 0; h != nbHoursADay; ++h)
+					{
+						assert(0 == Math::Infinite(dailyResults[h]) && "Infinite value");
+					}
+				}
+				# endif
+
+				for (uint s = 0; s != processCount; ++s)
+				{
+					assert(s < xcast.pData.localareas.size() && "Bound checking");
+					auto& currentArea = *xcast.pData.localareas[s];
+					
+					auto& srcData = predicate.xcastData(currentArea);
+
+					
+					auto& series = *(xcast.pSeries[s]);
+					assert(tsIndex < series.width);
+					auto& column = series.column(tsIndex);
+					float* dailyResults = DATA[s];
+
+					
+					for (uint h = 0; h != nbHoursADay; ++h)
+					{
+						assert(0 == Math::Infinite(dailyResults[h]) && "Infinite value");
+						dailyResults[h] *= (float)srcData.capacity;
+					}
+
+					
+					if (srcData.useTranslation == Data::XCast::tsTranslationAfterConversion)
+					{
+						assert(hourInTheYear + nbHoursADay <= srcData.translation.height && "Bound checking");
+						auto& tsavg = srcData.translation[0];
+						for (uint h = 0; h != nbHoursADay; ++h)
+							dailyResults[h] += (float) tsavg[hourInTheYear + h];
+					}
+
+					
+					assert(hourInTheYear + nbHoursADay <= series.height && "Bound checking");
+					for (uint h = 0; h != nbHoursADay; ++h)
+						column[hourInTheYear + h] = Math::Round(dailyResults[h]);
+
+					
+					series.flush();
+					srcData.translation.flush();
+
+					
+					++progression;
+				}
+
+				hourInTheYear += nbHoursADay;
+
+				
+				pNewMonth = false;
 			}
-			delete[] Carre_courant;
-			delete[] Carre_reference;
-			delete[] D_COPIE;
-			delete[] DATA;
-			delete[] Triangle_reference;
-			delete[] Triangle_courant;
-			delete[] LISS;
-			delete[] DATL;
-			delete[] CORR;
-			delete[] FO;
-			delete[] A;
-			delete[] B;
-			delete[] G;
-			delete[] D;
-			delete[] M;
-			delete[] T;
-			delete[] L;
-			delete[] BO;
-			delete[] MA;
-			delete[] MI;
-			delete[] POSI;
-			delete[] MAXI;
-			delete[] MINI;
-			delete[] Presque_maxi;
-			delete[] Presque_mini;
-			delete[] ESPE;
-			delete[] STDE;
-			delete[] DIFF;
-			delete[] TREN;
-			delete[] WIEN;
-			delete[] BROW;
-			delete[] pQCHOLTotal;
-			delete[] pUseConversion;
 		}
+
+	}
+
+
+
+	template<class PredicateT>
+	class XCast::GeneratorJob final : public Yuni::Job::IJob
+	{
+	public:
+		GeneratorJob(XCast& xcast, XCast::Worker& worker, PredicateT& predicate, Progression::Task& progression) :
+			xcast(xcast),
+			worker(worker),
+			predicate(predicate),
+			progression(progression)
+		{}
+
+	protected:
+		virtual void onExecute() override
+		{
+			uint tsIndex;
+			while (xcast.nextTimeSeries(tsIndex))
+				worker.generate(tsIndex, predicate, progression);
+		}
+
+	private:
+		XCast& xcast;
+		XCast::Worker& worker;
+		PredicateT& predicate;
+		Progression::Task& progression;
+	};
+
+
+	bool XCast::nextTimeSeries(uint& tsIndex)
+	{
+		MutexLocker locker(pMutex);
+		if (pNextTimeSeries >= nbTimeseries)
+			return false;
+		tsIndex = pNextTimeSeries++;
+		return true;
 	}
 
 
@@ -479,7 +728,7 @@ namespace XCast
 			
 			loadFromStudy(predicate.correlation(study), predicate);
 			
-			allocateTemporaryData();
+			pUseConversion = new bool[pData.localareas.size()];
 
 			for (uint s = 0; s != pData.localareas.size(); ++s)
 			{
@@ -487,14 +736,16 @@ namespace XCast
 				auto& area = *(pData.localareas[s]);
 
 				
-				predicate.matrix(area).resize(nbTimeseries, nbHours);
-				predicate.matrix(area).flush();
-				auto& xcast = predicate.xcastData(area);
+				auto& series = TargetSeries(buffer, predicate.matrix(area));
+				series.resize(nbTimeseries, nbHours);
+				series.flush();
+				auto& xcastdata = predicate.xcastData(area);
 				
-				pUseConversion[s] = (xcast.useConversion && xcast.conversion.width >= 3);
+				pUseConversion[s] = (xcastdata.useConversion && xcastdata.conversion.width >= 3);
 			}
 
 			pAccuracyOnCorrelation = ((study.parameters.timeSeriesAccuracyOnCorrelation & timeSeriesType) != 0);
+			pNeverInitialized = false;
 		}
 
 		
@@ -518,212 +769,76 @@ namespace XCast
 		
 		updateMissingCoefficients(predicate);
 
-		
-		pComputedPointCount = 0;
-		pNDPMatrixCount     = 0;
-		pLevellingCount     = 0;
-
-
-		for (uint tsIndex = 0; tsIndex != nbTimeseries; ++tsIndex)
-		{
-			
-			uint hourInTheYear = 0;
-
-			
-			
-			
-			for (uint month = 0; month != 12; ++month)
-			{
-				
-				uint realmonth = study.calendar.months[month].realmonth;
-
-				
-				pNewMonth = true;
-				
-				pCorrMonth = pData.correlation[realmonth];
-
-				
-				for (uint s = 0; s != processCount; ++s)
-				{
-					assert(s < pData.localareas.size() && "Bound checking");
-					auto& xcastdata = predicate.xcastData(*(pData.localareas[s]));
-					A[s] = xcastdata.data       [alpha] [realmonth];
-					B[s] = xcastdata.data       [beta]  [realmonth];
-					G[s] = xcastdata.data       [gamma] [realmonth];
-					D[s] = xcastdata.data       [delta] [realmonth];
-					M[s] = (int) xcastdata.data [mu]    [realmonth];
-					T[s] = xcastdata.data       [theta] [realmonth];
-					L[s] = xcastdata.distribution;
-
-					switch (xcastdata.distribution)
-					{
-						case Data::XCast::dtUniform:
-							{
-								BO[s] = true;
-								MI[s] = G[s];
-								MA[s] = D[s];
-								break;
-							}
-						case Data::XCast::dtBeta:
-							{
-								BO[s] = true;
-								MI[s] = G[s];
-								MA[s] = D[s];
-								break;
-							}
-						case Data::XCast::dtNormal:
-							{
-								BO[s] = false;
-								MI[s] = - std::numeric_limits<float>::max();
-								MA[s] = + std::numeric_limits<float>::max();
-								break;
-							}
-						default:
-							{
-								BO[s] = false;
-								MI[s] = G[s];
-								MA[s] = + std::numeric_limits<float>::max();
-							}
-					}
-					memcpy(FO[s], xcastdata.K[realmonth], sizeof(float) * nbHoursADay);
 
-					
-					xcastdata.data.flush();
-					xcastdata.K.flush();
-				}
 
-				uint nbDaysPerMonth = study.calendar.months[month].days;
-				for (uint j = 0; j != nbDaysPerMonth; ++j)
-				{
-					if (not generateValuesForTheCurrentDay())
-						AntaresSolverEmergencyShutdown(); 
+		if (not prepareCorrelationMatrices())
+			AntaresSolverEmergencyShutdown();
 
-					# ifndef NDEBUG
-					
-					for (uint s = 0; s != processCount; ++s)
-					{
-						float* dailyResults  = DATA[s];
-						
-						for (uint h = 0; h != nbHoursADay; ++h)
-						{
-							assert(0 == Math::Infinite(dailyResults[h]) && "Infinite value");
-						}
-					}
-					# endif
-
-
-					
-					for (uint s = 0; s != processCount; ++s)
-					{
-						assert(s < pData.localareas.size() && "Bound checking");
-						auto& currentArea = *pData.localareas[s];
-						
-						auto& srcData = predicate.xcastData(currentArea);
-						if (srcData.useTranslation != Data::XCast::tsTranslationBeforeConversion)
-							continue;
-
-						
-						auto& column = srcData.translation[0];
-						float* dailyResults  = DATA[s];
-						assert(hourInTheYear + nbHoursADay <= srcData.translation.height && "Bound checking");
-
-						
-						for (uint h = 0; h != nbHoursADay; ++h)
-						{
-							assert(0 == Math::Infinite(dailyResults[h]) && "Infinite value");
-							dailyResults[h] += (float) column[hourInTheYear + h];
-						}
-
-						
-						srcData.translation.flush();
-					}
-
-					
-					applyTransferFunction(predicate);
-
-					# ifndef NDEBUG
-					
-					for (uint s = 0; s != processCount; ++s)
-					{
-						float* dailyResults  = DATA[s];
-						
-						for (uint h = 0; h != nbHoursADay; ++h)
-						{
-							assert(0 == Math::Infinite(dailyResults[h]) && "Infinite value");
-						}
-					}
-					# endif
-
-					for (uint s = 0; s != processCount; ++s)
-					{
-						assert(s < pData.localareas.size() && "Bound checking");
-						auto& currentArea = *pData.localareas[s];
-						
-						auto& srcData = predicate.xcastData(currentArea);
-
-						
-						auto& series = predicate.matrix(currentArea);
-						assert(tsIndex < series.width);
-						auto& column = series.column(tsIndex);
-						float* dailyResults = DATA[s];
-
-						
-						for (uint h = 0; h != nbHoursADay; ++h)
-						{
-							assert(0 == Math::Infinite(dailyResults[h]) && "Infinite value");
-							dailyResults[h] *= (float)srcData.capacity;
-						}
-
-						
-						if (srcData.useTranslation == Data::XCast::tsTranslationAfterConversion)
-						{
-							assert(hourInTheYear + nbHoursADay <= srcData.translation.height && "Bound checking");
-							auto& tsavg = srcData.translation[0];
-							for (uint h = 0; h != nbHoursADay; ++h)
-								dailyResults[h] += (float) tsavg[hourInTheYear + h];
-						}
-
-						
-						assert(hourInTheYear + nbHoursADay <= series.height && "Bound checking");
-						for (uint h = 0; h != nbHoursADay; ++h)
-							column[hourInTheYear + h] = Math::Round(dailyResults[h]);
-
-						
-						series.flush();
-						srcData.translation.flush();
+		// The matrices to write into, retrieved once for all
+		pSeries.resize(processCount);
+		for (uint s = 0; s != processCount; ++s)
+			pSeries[s] = &TargetSeries(buffer, predicate.matrix(*(pData.localareas[s])));
 
-						
-						++progression;
-					}
+		uint nbThreads = study.maxNbYearsInParallel;
+		if (nbThreads > nbTimeseries)
+			nbThreads = nbTimeseries;
+		if (nbThreads == 0)
+			nbThreads = 1;
 
-					hourInTheYear += nbHoursADay;
+		// Each thread owns its own temporary data
+		std::vector<Worker*> workers(nbThreads);
+		for (uint t = 0; t != nbThreads; ++t)
+			workers[t] = new Worker(*this);
 
-					
-					pNewMonth = false;
-				}
-			}
+		// The swap files can not be flushed concurrently
+		if (Antares::Memory::swapSupport or nbThreads == 1)
+		{
+			for (uint tsIndex = 0; tsIndex != nbTimeseries; ++tsIndex)
+				workers[0]->generate(tsIndex, predicate, progression);
+		}
+		else
+		{
+			logs.info() << "  " << nbTimeseries << " time-series, " << nbThreads << " threads";
+
+			pNextTimeSeries = 0;
+			Yuni::Job::QueueService qs;
+			qs.maximumThreadCount(nbThreads);
+			for (uint t = 0; t != nbThreads; ++t)
+				qs.add(new GeneratorJob<PredicateT>(*this, *workers[t], predicate, progression));
+			qs.start();
+			qs.wait(Yuni::qseIdle);
+			qs.stop();
+		}
 
-		} 
+		uint computedPointCount = 0;
+		uint correlationMatrixCount = 0;
+		uint ndpMatrixCount = 0;
+		for (uint t = 0; t != nbThreads; ++t)
+		{
+			computedPointCount     += workers[t]->pComputedPointCount;
+			correlationMatrixCount += workers[t]->pCorrelationMatrixCount;
+			ndpMatrixCount         += workers[t]->pNDPMatrixCount;
+			delete workers[t];
+		}
+		pSeries.clear();
 
 
 
 		
 		{
-			uint y = ((pAccuracyOnCorrelation) ? pComputedPointCount : (nbTimeseries * 365));
-			uint z = pNDPMatrixCount;
-
 			logs.info() << "  "
-				<< pComputedPointCount << " points calculated, using "
-				<< y << " correlation matrices, out of which "
-				<< z << " were npsd and transformed";
+				<< computedPointCount << " points calculated, using "
+				<< correlationMatrixCount << " correlation matrices, out of which "
+				<< ndpMatrixCount << " were npsd and transformed";
 		}
 
 		if (study.parameters.derated)
 		{
 			study.areas.each([&] (Data::Area& area)
 			{
-				predicate.matrix(area).averageTimeseries();
-				predicate.matrix(area).flush();
+				auto& series = TargetSeries(buffer, predicate.matrix(area));
+				series.averageTimeseries();
+				series.flush();
 			});
 		}
 
@@ -743,7 +858,7 @@ namespace XCast
 				assert(area.load.series);
 				assert(static_cast<uint>(Data::fhrDSM) < area.reserves.width);
 
-				auto& matrix = area.load.series->series;
+				auto& matrix = TargetSeries(buffer, area.load.series->series);
 				auto& dsmvalues = area.reserves.column(Data::fhrDSM);
 
 				
@@ -31,7 +31,10 @@
 # include <antares/study/fwd.h>
 # include <antares/mersenne-twister/mersenne-twister.h>
 # include "studydata.h"
+# include "../back-buffer.h"
 # include <yuni/core/noncopyable.h>
+# include <yuni/thread/mutex.h>
+# include <vector>
 
 
 namespace Antares
@@ -109,136 +112,202 @@ namespace XCast
 		//! The time-series type
 		const Data::TimeSeries timeSeriesType;
 
-		//! The random generator to use
-		MersenneTwister* random;
+		//! The seed of the random streams (one stream per time-series, see StreamSeed())
+		uint seed;
+		//! The back buffer to generate into (null to generate in place)
+		BackBuffer* buffer;
 
 
 	private:
-		void allocateTemporaryData();
-		void destroyTemporaryData();
+		/*!
+		** \brief Temporary data for the generation of a single time-series
+		**
+		** Each thread owns its own worker. A time-series starts from the expected
+		** values of the processes and uses its own random stream, thus it does
+		** not depend on the time-series generated before it.
+		*/
+		class Worker final : private Yuni::NonCopyable<Worker>
+		{
+		public:
+			explicit Worker(XCast& xcast);
+			~Worker();
+
+			/*!
+			** \brief Generate the time-series `tsIndex` for all processes
+			*/
+			template<class PredicateT>
+			void generate(uint tsIndex, PredicateT& predicate, Progression::Task& progression);
+
+		public:
+			// Statistics
+			//! The number of computed points a day
+			uint pComputedPointCount;
+			uint pNDPMatrixCount;
+			uint pLevellingCount;
+			//! The number of correlation matrices used
+			uint pCorrelationMatrixCount;
+
+		private:
+			/*!
+			** \brief Perform the generation of the time-series on a single day for all processes
+			**
+			** Ce code effectue dans l'ordre :
+			** a) elaboration de series de valeurs horaires X(a) de processus "purs"
+			**    definis par A,B,G,D,T,L,C
+			** b) transformation de ces series en X(b) par un lissage en moyenne glissante
+			**    defini par M (permet de regler l'autocorrelation a court terme)
+			** c) Modulation des series en X(c) en fonction de coefficients FO de
+			**    variations quotidienne des valeurs horaires
+			** d) Ecretement (haut, bas) de la serie en X(d) de façon a la contenir dans
+			**    des bornes imposees MI,MA
+			**
+			** ATTENTION : les 4 étapes sont enchainees pour chaque point horaire.
+			** On ne passe donc pas de t à t+1 en faisant
+			**   X(a)(t) -> X(a)(t+1)
+			**   X(b)(t) -> X(b)(t+1)
+			**
+			** Le processus X(a) peut donc s'ecarter de sa loi marginale et de son
+			** autocorrelation theoriques si les modulations FO et les bornes MI,MA
+			** conduisent frequemment a rectifier sa trajectoire.
+			** Ce cas peut se presenter si les bornes d'ecretement MI,MA sont egales a
+			** G,D (voire plus etroites) et si les modulations FO sont marquees.
+			**
+			**
+			** LOIS MODELISEES
+			** regle generale pour tous les types de loi : t>=0
+			** regles particulieres selon les types de lois :
+			**
+			** \code
+			** code loi		a				b			g				d       autres contraintes    Loi marginale
+			** 1		quelconque     quelconque  g> INFININ/2   d<INFINIP/2			g<=d		 Uniforme sur l'intervalle	(g,d)
+			** 2			a>0				b>0    g> INFININ/2   d<INFINIP/2		    g<=d		 Bêta (a,b)sur l'intervalle (g,d)
+			** 3	    quelconque          b>=0   g=  a-6*b	  d= a+6*b	                         Normale d'espérance a et d'écart-type b
+			** 4			a>=1		    b>0	   g> INFININ/2   d= gamma_euler(1+1/a)			     Weibull de forme a, d'échelle b et définie pour x>g
+			** 5			a>=1			b>0	   g> INFININ/2   d non défini					     Gamma de forme a, d'échelle b et définie pour x>g
+			** \endcode
+			*/
+			bool generateValuesForTheCurrentDay();
+
+			template<class PredicateT> void applyTransferFunction(PredicateT& predicate);
+
+			/*!
+			** \brief Factorize the correlation matrix of the month (CORR)
+			**
+			** The matrix only depends on the data of the month, thus its factorization
+			** is kept in the cache of the study and reused by all time-series.
+			** \return The shrink ratio (see MatrixDPMake()), -1 if the matrix is invalid
+			*/
+			float factorizeCorrelationMatrixOfTheMonth(uint processCount);
+
+			//! Tirage de deux variables normales centrees et reduites
+			void normal(float& x, float& y);
+
+		private:
+			//! The generator
+			XCast& xcast;
+			//! The random stream of the current time-series
+			MersenneTwister random;
+
+			//! The correlation matrix for the current month
+			const Matrix<float>* pCorrMonth;
+
+			//! True when starting a new time-series
+			bool pNewSeries;
+			uint Nombre_points_intermediaire;
+
+			//! True when starting a new month (some data may have to be reinitialized)
+			bool pNewMonth;
+
+			bool pAccuracyOnCorrelation;
+			bool All_normal;  //all processes are Normal 
+
+			float* A; // les variables de A à CO sont des vues de ALPH à CORR pour un mois particulier
+			float* B;
+			float* G;
+			float* D;
+			int*   M;
+			float* T;
+			Data::XCast::Distribution* L;
+			bool*  BO;
+			float* MA;
+			float* MI;
+			float** FO; // contrainte : FO >=0
+
+			float STEP;
+			float SQST;
+			float* POSI;
+			float** CORR;
+			float* MAXI;
+			float* MINI;
+			float* Presque_maxi;
+			float* Presque_mini;
+			float* ESPE;
+			float* STDE;
+			float** LISS;
+			float** DATL;
+
+			float* DIFF;
+			float* TREN;
+			float* WIEN;
+			float* BROW;
+
+			float* BASI; // used only if all processes are Normal
+			float* ALPH; // used only if all processes are Normal
+			float* BETA; // used only if all processes are Normal
+
+			float** Triangle_reference;
+			float** Triangle_courant;
+			float** Carre_reference;
+			float** Carre_courant;
+
+			float* D_COPIE;
+
+			float** DATA;
+
+			// cholesky temporary data
+			float* pQCHOLTotal;
+
+		}; // class Worker
+
+		//! Job generating time-series in parallel (see xcast.cpp)
+		template<class PredicateT> class GeneratorJob;
 
+	private:
 		template<class PredicateT> void updateMissingCoefficients(PredicateT& predicate);
 		template<class PredicateT> bool runWithPredicate(PredicateT& predicate, Progression::Task& progression);
 
 		/*!
-		** \brief Export all time-series for each process into the output folder
-		*/
-		template<class PredicateT>
-		void exportTimeSeriesToTheOutput(Progression::Task& progression, PredicateT& predicate);
-
-		/*!
-		** \brief Perform the generation of the time-series on a single day for all processes
-		**
-		** Ce code effectue dans l'ordre :
-		** a) elaboration de series de valeurs horaires X(a) de processus "purs"
-		**    definis par A,B,G,D,T,L,C
-		** b) transformation de ces series en X(b) par un lissage en moyenne glissante
-		**    defini par M (permet de regler l'autocorrelation a court terme)
-		** c) Modulation des series en X(c) en fonction de coefficients FO de
-		**    variations quotidienne des valeurs horaires
-		** d) Ecretement (haut, bas) de la serie en X(d) de façon a la contenir dans
-		**    des bornes imposees MI,MA
-		**
-		** ATTENTION : les 4 étapes sont enchainees pour chaque point horaire.
-		** On ne passe donc pas de t à t+1 en faisant
-		**   X(a)(t) -> X(a)(t+1)
-		**   X(b)(t) -> X(b)(t+1)
+		** \brief Check the correlation matrix of each month, before the generation
 		**
-		** Le processus X(a) peut donc s'ecarter de sa loi marginale et de son
-		** autocorrelation theoriques si les modulations FO et les bornes MI,MA
-		** conduisent frequemment a rectifier sa trajectoire.
-		** Ce cas peut se presenter si les bornes d'ecretement MI,MA sont egales a
-		** G,D (voire plus etroites) et si les modulations FO sont marquees.
-		**
-		**
-		** LOIS MODELISEES
-		** regle generale pour tous les types de loi : t>=0
-		** regles particulieres selon les types de lois :
-		**
-		** \code
-		** code loi		a				b			g				d       autres contraintes    Loi marginale
-		** 1		quelconque     quelconque  g> INFININ/2   d<INFINIP/2			g<=d		 Uniforme sur l'intervalle	(g,d)
-		** 2			a>0				b>0    g> INFININ/2   d<INFINIP/2		    g<=d		 Bêta (a,b)sur l'intervalle (g,d)
-		** 3	    quelconque          b>=0   g=  a-6*b	  d= a+6*b	                         Normale d'espérance a et d'écart-type b
-		** 4			a>=1		    b>0	   g> INFININ/2   d= gamma_euler(1+1/a)			     Weibull de forme a, d'échelle b et définie pour x>g
-		** 5			a>=1			b>0	   g> INFININ/2   d non défini					     Gamma de forme a, d'échelle b et définie pour x>g
-		** \endcode
+		** A matrix which is not definite positive, but close to, is slightly shrunk
+		** once and for all. The workers then only read the matrices.
 		*/
-		bool generateValuesForTheCurrentDay();
+		bool prepareCorrelationMatrices();
 
-		template<class PredicateT> void applyTransferFunction(PredicateT& predicate);
+		//! Get the index of the next time-series to generate, false when all have been taken
+		bool nextTimeSeries(uint& tsIndex);
 
-		//! Tirage de deux variables normales centrees et reduites
-		void normal(float& x, float& y);
+		/*!
+		** \brief Export all time-series for each process into the output folder
+		*/
+		template<class PredicateT>
+		void exportTimeSeriesToTheOutput(Progression::Task& progression, PredicateT& predicate);
 
 
 	private:
 		//! Some data after transformation
 		StudyData pData;
 
-		//! The correlation matrix for the current month
-		const Matrix<float>* pCorrMonth;
-
 		bool pNeverInitialized;
-		uint Nombre_points_intermediaire;
-
-		//! True when starting a new month (some data may have to be reinitialized)
-		bool pNewMonth;
+		bool pAccuracyOnCorrelation;
 
-		// Statistics
-		//! The number of computed points a day
-		uint pComputedPointCount;
-		uint pNDPMatrixCount;
-		uint pLevellingCount;
+		//! The matrix to write into, for each process
+		std::vector<Matrix<double, Yuni::sint32>*> pSeries;
 
-		bool pAccuracyOnCorrelation;
-		bool All_normal;  //all processes are Normal 
-
-		float* A; // les variables de A à CO sont des vues de ALPH à CORR pour un mois particulier
-		float* B;
-		float* G;
-		float* D;
-		int*   M;
-		float* T;
-		Data::XCast::Distribution* L;
-		bool*  BO;
-		float* MA;
-		float* MI;
-		float** FO; // contrainte : FO >=0
-
-		float STEP;
-		float SQST;
-		float* POSI;
-		float** CORR;
-		float* MAXI;
-		float* MINI;
-		float* Presque_maxi;
-		float* Presque_mini;
-		float* ESPE;
-		float* STDE;
-		float** LISS;
-		float** DATL;
-
-		float* DIFF;
-		float* TREN;
-		float* WIEN;
-		float* BROW;
-
-		float* BASI; // used only if all processes are Normal
-		float* ALPH; // used only if all processes are Normal
-		float* BETA; // used only if all processes are Normal
-
-		float** Triangle_reference;
-		float** Triangle_courant;
-		float** Carre_reference;
-		float** Carre_courant;
-
-		float* D_COPIE;
-
-		float** DATA;
-
-		// cholesky temporary data
-		float* pQCHOLTotal;
+		//! The index of the next time-series to generate
+		uint pNextTimeSeries;
+		//! Mutex for pNextTimeSeries
+		Yuni::Mutex pMutex;
 
 		//!
 		bool* pUseConversion;
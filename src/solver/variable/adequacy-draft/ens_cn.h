@@ -120,7 +120,10 @@ namespace AdequacyDraft
 		};
 
 	public:
-		~ENS_CN() {}
+		~ENS_CN()
+		{
+			delete[] pValuesForTheCurrentYear;
+		}
 
 		void initializeFromStudy(Data::Study& study)
 		{			
@@ -130,7 +133,10 @@ namespace AdequacyDraft
 			AncestorType::pResults.averageMaxValue(study.runtime->rangeLimits.year[Data::rangeCount]);
 
 			// Intermediate values
-			pValuesForTheCurrentYear.initializeFromStudy(study);
+			pNbYearsParallel = study.maxNbYearsInParallel;
+			pValuesForTheCurrentYear = new IntermediateValues[pNbYearsParallel];
+			for (unsigned int numSpace = 0; numSpace < pNbYearsParallel; numSpace++)
+				pValuesForTheCurrentYear[numSpace].initializeFromStudy(study);
 
 			// Next
 			NextType::initializeFromStudy(study);
@@ -169,8 +175,11 @@ namespace AdequacyDraft
 
 		void yearBegin(unsigned int year, unsigned int numSpace)
 		{
-			// Reset the values for the current year
-			pValuesForTheCurrentYear.reset();
+			if (AncestorType::isComputed)
+			{
+				// Reset the values for the current year
+				pValuesForTheCurrentYear[numSpace].reset();
+			}
 
 			// Next variable
 			NextType::yearBegin(year, numSpace);
@@ -197,10 +206,11 @@ namespace AdequacyDraft
 		
 		void yearEnd(unsigned int year, unsigned int numSpace)
 		{
-			// Compute all statistics for the current year (daily,weekly,monthly)
-			pValuesForTheCurrentYear.computeStatisticsAdequacyForTheCurrentYear();
-			// Merge all those values with the global results
-			AncestorType::pResults.merge(year, pValuesForTheCurrentYear);
+			if (AncestorType::isComputed)
+			{
+				// Compute all statistics for the current year (daily,weekly,monthly)
+				pValuesForTheCurrentYear[numSpace].computeStatisticsAdequacyForTheCurrentYear();
+			}
 
 			// Next variable
 			NextType::yearEnd(year, numSpace);
@@ -208,7 +218,14 @@ namespace AdequacyDraft
 
 		void computeSummary(std::map<unsigned int, unsigned int> & numSpaceToYear, unsigned int nbYearsForCurrentSummary)
 		{
-			// Nothing to do here because number of parallel years is reduced to 1 in draft mode
+			if (AncestorType::isComputed)
+			{
+				for (auto it = numSpaceToYear.begin(); it != numSpaceToYear.end(); ++it)
+				{
+					// Merge all those values with the global results
+					AncestorType::pResults.merge(it->second /*year*/, pValuesForTheCurrentYear[it->first]);
+				}
+			}
 
 			// Next variable
 			NextType::computeSummary(numSpaceToYear, nbYearsForCurrentSummary);
@@ -222,12 +239,15 @@ namespace AdequacyDraft
 
 		void hourForEachArea(State& state, unsigned int numSpace)
 		{
-			if (state.hourlyAdequacyResults->DefaillanceAvecReseau > 0.)
+			if (AncestorType::isComputed)
 			{
-				pValuesForTheCurrentYear.hour[state.hourInTheYear] -=
-					state.hourlyAdequacyResults->MargeAvecReseau;
-				state.eensSystemCN -=
-					state.hourlyAdequacyResults->MargeAvecReseau;
+				if (state.hourlyAdequacyResults->DefaillanceAvecReseau > 0.)
+				{
+					pValuesForTheCurrentYear[numSpace].hour[state.hourInTheYear] -=
+						state.hourlyAdequacyResults->MargeAvecReseau;
+					state.eensSystemCN -=
+						state.hourlyAdequacyResults->MargeAvecReseau;
+				}
 			}
 			// Next variable
 			NextType::hourForEachArea(state, numSpace);
@@ -254,7 +274,8 @@ namespace AdequacyDraft
 
 	private:
 		//! Intermediate values for each year
-		IntermediateValues pValuesForTheCurrentYear;
+		IntermediateValues* pValuesForTheCurrentYear;
+		unsigned int pNbYearsParallel;
 
 	}; // class ENS_CN
 
@@ -115,7 +115,10 @@ namespace AdequacyDraft
 		};
 
 	public:
-		~ENS_CN_System() {}
+		~ENS_CN_System()
+		{
+			delete[] pValuesForTheCurrentYear;
+		}
 
 		void initializeFromStudy(Data::Study& study)
 		{
@@ -124,6 +127,12 @@ namespace AdequacyDraft
 			AncestorType::pResults.reset();
 			pRatio = 1. / study.runtime->rangeLimits.year[Data::rangeCount];
 
+			// Intermediate values
+			pNbYearsParallel = study.maxNbYearsInParallel;
+			pValuesForTheCurrentYear = new IntermediateValues[pNbYearsParallel];
+			for (unsigned int numSpace = 0; numSpace < pNbYearsParallel; numSpace++)
+				pValuesForTheCurrentYear[numSpace].initializeFromStudy(study);
+
 			// Special draft variable : non applicability is set here, not in ancester class
 			AncestorType::isNonApplicable[0] = false;
 
@@ -164,6 +173,12 @@ namespace AdequacyDraft
 
 		void yearBegin(unsigned int year, unsigned int numSpace)
 		{
+			if (AncestorType::isComputed)
+			{
+				// Reset the values for the current year
+				pValuesForTheCurrentYear[numSpace].reset();
+			}
+
 			// Next variable
 			NextType::yearBegin(year, numSpace);
 		}
@@ -195,6 +210,20 @@ namespace AdequacyDraft
 
 		void computeSummary(std::map<unsigned int, unsigned int> & numSpaceToYear, unsigned int nbYearsForCurrentSummary)
 		{
+			if (AncestorType::isComputed)
+			{
+				// Merge all those values with the global results, in the order of the years
+				for (auto it = numSpaceToYear.begin(); it != numSpaceToYear.end(); ++it)
+				{
+					const IntermediateValues& values = pValuesForTheCurrentYear[it->first];
+					for (unsigned int h = 0; h != maxHoursInAYear; ++h)
+					{
+						AncestorType::pResults.rawdata.hourly[h] += values.hour[h];
+						AncestorType::pResults.rawdata.year[0] += values.hour[h];
+					}
+				}
+			}
+
 			// Next variable
 			NextType::computeSummary(numSpaceToYear, nbYearsForCurrentSummary);
 		}
@@ -209,6 +238,9 @@ namespace AdequacyDraft
 		{
 			// Next variable
 			NextType::hourForEachArea(state, numSpace);
+
+			// The energy not served of the whole system is known once all areas are done
+			pValuesForTheCurrentYear[numSpace].hour[state.hourInTheYear] = state.eensSystemCN * pRatio;
 		}
 
 		void hourForEachThermalCluster(State& state, unsigned int numSpace)
@@ -219,8 +251,6 @@ namespace AdequacyDraft
 
 		void hourEnd(State& state, unsigned int hourInTheYear)
 		{
-			AncestorType::pResults.rawdata.hourly[hourInTheYear] += state.eensSystemCN * pRatio;
-			AncestorType::pResults.rawdata.year[0] += state.eensSystemCN * pRatio;
 			// Next
 			NextType::hourEnd(state, hourInTheYear);
 		}
@@ -234,6 +264,9 @@ namespace AdequacyDraft
 
 	private:
 		double pRatio;
+		//! Intermediate values for each year
+		IntermediateValues* pValuesForTheCurrentYear;
+		unsigned int pNbYearsParallel;
 
 	}; // class ENS_CN_System
 
@@ -119,7 +119,10 @@ namespace AdequacyDraft
 		};
 
 	public:
-		~LOLD_CN() {}
+		~LOLD_CN()
+		{
+			delete[] pValuesForTheCurrentYear;
+		}
 
 		void initializeFromStudy(Data::Study& study)
 		{			
@@ -129,7 +132,10 @@ namespace AdequacyDraft
 			AncestorType::pResults.averageMaxValue(study.runtime->rangeLimits.year[Data::rangeCount]);
 
 			// Intermediate values
-			pValuesForTheCurrentYear.initializeFromStudy(study);
+			pNbYearsParallel = study.maxNbYearsInParallel;
+			pValuesForTheCurrentYear = new IntermediateValues[pNbYearsParallel];
+			for (unsigned int numSpace = 0; numSpace < pNbYearsParallel; numSpace++)
+				pValuesForTheCurrentYear[numSpace].initializeFromStudy(study);
 
 			// Next
 			NextType::initializeFromStudy(study);
@@ -169,7 +175,7 @@ namespace AdequacyDraft
 		void yearBegin(unsigned int year, unsigned int numSpace)
 		{
 			// Reset the values for the current year
-			pValuesForTheCurrentYear.reset();
+			pValuesForTheCurrentYear[numSpace].reset();
 
 			// Next variable
 			NextType::yearBegin(year, numSpace);
@@ -197,17 +203,19 @@ namespace AdequacyDraft
 		void yearEnd(unsigned int year, unsigned int numSpace)
 		{
 			// Compute all statistics for the current year (daily,weekly,monthly)
-			pValuesForTheCurrentYear.computeStatisticsAdequacyForTheCurrentYear();
-			// Merge all those values with the global results
-			AncestorType::pResults.merge(year, pValuesForTheCurrentYear);
+			pValuesForTheCurrentYear[numSpace].computeStatisticsAdequacyForTheCurrentYear();
 
 			// Next variable
 			NextType::yearEnd(year, numSpace);
 		}
 
 		void computeSummary(std::map<unsigned int, unsigned int> & numSpaceToYear, unsigned int nbYearsForCurrentSummary)
-		{	
-			// Nothing to do here because number of parallel years is reduced to 1 in draft mode
+		{
+			for (auto it = numSpaceToYear.begin(); it != numSpaceToYear.end(); ++it)
+			{
+				// Merge all those values with the global results
+				AncestorType::pResults.merge(it->second /*year*/, pValuesForTheCurrentYear[it->first]);
+			}
 			
 			// Next variable
 			NextType::computeSummary(numSpaceToYear, nbYearsForCurrentSummary);
@@ -223,7 +231,7 @@ namespace AdequacyDraft
 		{
 			if (state.hourlyAdequacyResults->DefaillanceAvecReseau > 0.)
 			{
-				pValuesForTheCurrentYear.hour[state.hourInTheYear] += 1.;
+				pValuesForTheCurrentYear[numSpace].hour[state.hourInTheYear] += 1.;
 				state.loleSystemCN_HasFailure = true;
 			}
 			// Next variable
@@ -251,7 +259,8 @@ namespace AdequacyDraft
 
 	private:
 		//! Intermediate values for each year
-		IntermediateValues pValuesForTheCurrentYear;
+		IntermediateValues* pValuesForTheCurrentYear;
+		unsigned int pNbYearsParallel;
 	}; // class LOLD_CN
 
 
@@ -115,12 +115,22 @@ namespace AdequacyDraft
 		};
 
 	public:
-		~LOLD_CN_System() {	}
+		~LOLD_CN_System()
+		{
+			delete[] pValuesForTheCurrentYear;
+		}
 
 		void initializeFromStudy(Data::Study& study)
 		{
 			// Average on all years
 			pRatio = 1. / study.runtime->rangeLimits.year[Data::rangeCount];
+
+			// Intermediate values
+			pNbYearsParallel = study.maxNbYearsInParallel;
+			pValuesForTheCurrentYear = new IntermediateValues[pNbYearsParallel];
+			for (unsigned int numSpace = 0; numSpace < pNbYearsParallel; numSpace++)
+				pValuesForTheCurrentYear[numSpace].initializeFromStudy(study);
+
 			AncestorType::pResults.initializeFromStudy(study);
 			AncestorType::pResults.reset();
 
@@ -165,6 +175,12 @@ namespace AdequacyDraft
 
 		void yearBegin(unsigned int year, unsigned int numSpace)
 		{
+			if (AncestorType::isComputed)
+			{
+				// Reset the values for the current year
+				pValuesForTheCurrentYear[numSpace].reset();
+			}
+
 			// Next variable
 			NextType::yearBegin(year, numSpace);
 		}
@@ -195,7 +211,21 @@ namespace AdequacyDraft
 		}
 
 		void computeSummary(std::map<unsigned int, unsigned int> & numSpaceToYear, unsigned int nbYearsForCurrentSummary)
-		{	
+		{
+			if (AncestorType::isComputed)
+			{
+				// Merge all those values with the global results, in the order of the years
+				for (auto it = numSpaceToYear.begin(); it != numSpaceToYear.end(); ++it)
+				{
+					const IntermediateValues& values = pValuesForTheCurrentYear[it->first];
+					for (unsigned int h = 0; h != maxHoursInAYear; ++h)
+					{
+						AncestorType::pResults.rawdata.hourly[h] = values.hour[h];
+						AncestorType::pResults.rawdata.year[0] += values.hour[h];
+					}
+				}
+			}
+
 			// Next variable
 			NextType::computeSummary(numSpaceToYear, nbYearsForCurrentSummary);
 		}
@@ -208,6 +238,13 @@ namespace AdequacyDraft
 
 		void hourForEachArea(State& state, unsigned int numSpace)
 		{
+			if (AncestorType::isComputed)
+			{
+				const PROBLEME_HORAIRE_ADEQUATION& problem = *state.problemeHoraireAdequation;
+				pValuesForTheCurrentYear[numSpace].hour[state.hourInTheYear]
+					= (double) problem.DefaillanceEuropeenneAvecReseau * pRatio;
+			}
+
 			// Next variable
 			NextType::hourForEachArea(state, numSpace);
 		}
@@ -220,11 +257,6 @@ namespace AdequacyDraft
 
 		void hourEnd(State& state, unsigned int hourInTheYear)
 		{
-			AncestorType::pResults.rawdata.hourly[hourInTheYear]
-				= (double) ProblemeHoraireAdequation.DefaillanceEuropeenneAvecReseau * pRatio;
-			AncestorType::pResults.rawdata.year[0]
-				+= (double) ProblemeHoraireAdequation.DefaillanceEuropeenneAvecReseau * pRatio;
-
 			// Next
 			NextType::hourEnd(state, hourInTheYear);
 		}
@@ -237,6 +269,9 @@ namespace AdequacyDraft
 
 	private:
 		double pRatio;
+		//! Intermediate values for each year
+		IntermediateValues* pValuesForTheCurrentYear;
+		unsigned int pNbYearsParallel;
 
 	}; // class LOLD_CN_System
 
@@ -115,12 +115,27 @@ namespace AdequacyDraft
 		};
 
 	public:
-		~LOLD_IS_System() {	}
+		~LOLD_IS_System()
+		{
+			delete[] pValuesForTheCurrentYear;
+			delete[] pValuesForTheYearHorsReseau;
+		}
 
 		void initializeFromStudy(Data::Study& study)
 		{
 			// Average on all years
 			pRatio = 1. / study.runtime->rangeLimits.year[Data::rangeCount];
+
+			// Intermediate values
+			pNbYearsParallel = study.maxNbYearsInParallel;
+			pValuesForTheCurrentYear = new IntermediateValues[pNbYearsParallel];
+			pValuesForTheYearHorsReseau = new IntermediateValues[pNbYearsParallel];
+			for (unsigned int numSpace = 0; numSpace < pNbYearsParallel; numSpace++)
+			{
+				pValuesForTheCurrentYear[numSpace].initializeFromStudy(study);
+				pValuesForTheYearHorsReseau[numSpace].initializeFromStudy(study);
+			}
+
 			AncestorType::pResults.initializeFromStudy(study);
 			AncestorType::pResults.reset();
 
@@ -165,6 +180,13 @@ namespace AdequacyDraft
 
 		void yearBegin(unsigned int year, unsigned int numSpace)
 		{
+			if (AncestorType::isComputed)
+			{
+				// Reset the values for the current year
+				pValuesForTheCurrentYear[numSpace].reset();
+				pValuesForTheYearHorsReseau[numSpace].reset();
+			}
+
 			// Next variable
 			NextType::yearBegin(year, numSpace);
 		}
@@ -194,7 +216,22 @@ namespace AdequacyDraft
 		}
 
 		void computeSummary(std::map<unsigned int, unsigned int> & numSpaceToYear, unsigned int nbYearsForCurrentSummary)
-		{	
+		{
+			if (AncestorType::isComputed)
+			{
+				// Merge all those values with the global results, in the order of the years
+				for (auto it = numSpaceToYear.begin(); it != numSpaceToYear.end(); ++it)
+				{
+					const IntermediateValues& values = pValuesForTheCurrentYear[it->first];
+					const IntermediateValues& valuesHorsReseau = pValuesForTheYearHorsReseau[it->first];
+					for (unsigned int h = 0; h != maxHoursInAYear; ++h)
+					{
+						AncestorType::pResults.rawdata.hourly[h] = values.hour[h];
+						AncestorType::pResults.rawdata.year[0] += valuesHorsReseau.hour[h];
+					}
+				}
+			}
+
 			// Next variable
 			NextType::computeSummary(numSpaceToYear, nbYearsForCurrentSummary);
 		}
@@ -207,6 +244,15 @@ namespace AdequacyDraft
 
 		void hourForEachArea(State& state, unsigned int numSpace)
 		{
+			if (AncestorType::isComputed)
+			{
+				const PROBLEME_HORAIRE_ADEQUATION& problem = *state.problemeHoraireAdequation;
+				pValuesForTheCurrentYear[numSpace].hour[state.hourInTheYear]
+					= (double) problem.DefaillanceEuropeenneAvecReseau * pRatio;
+				pValuesForTheYearHorsReseau[numSpace].hour[state.hourInTheYear]
+					= (double) problem.DefaillanceEuropeenneHorsReseau * pRatio;
+			}
+
 			// Next variable
 			NextType::hourForEachArea(state, numSpace);
 		}
@@ -219,11 +265,6 @@ namespace AdequacyDraft
 
 		void hourEnd(State& state, unsigned int hourInTheYear)
 		{
-			AncestorType::pResults.rawdata.hourly[hourInTheYear]
-				= (double) ProblemeHoraireAdequation.DefaillanceEuropeenneAvecReseau * pRatio;
-			AncestorType::pResults.rawdata.year[0]
-				+= (double) ProblemeHoraireAdequation.DefaillanceEuropeenneHorsReseau * pRatio;
-
 			// Next
 			NextType::hourEnd(state, hourInTheYear);
 		}
@@ -236,6 +277,11 @@ namespace AdequacyDraft
 
 	private:
 		double pRatio;
+		//! Intermediate values for each year
+		IntermediateValues* pValuesForTheCurrentYear;
+		//! Values for the annual result, from the failures without the network
+		IntermediateValues* pValuesForTheYearHorsReseau;
+		unsigned int pNbYearsParallel;
 
 	}; // class LOLD_IS_System
 
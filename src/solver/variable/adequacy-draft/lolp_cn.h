@@ -115,16 +115,27 @@ namespace AdequacyDraft
 		};
 
 	public:
-		~LOLP_CN() {}
+		~LOLP_CN()
+		{
+			delete[] pValuesForTheCurrentYear;
+			delete[] gotFailureForTheCurrentYearCN;
+		}
 
 		void initializeFromStudy(Data::Study& study)
 		{			
-			// Average on all years
-			gotFailureForTheCurrentYearCN = false;
-
 			AncestorType::pResults.initializeFromStudy(study);
 			AncestorType::pResults.reset();
 
+			// Intermediate values
+			pNbYearsParallel = study.maxNbYearsInParallel;
+			pValuesForTheCurrentYear = new IntermediateValues[pNbYearsParallel];
+			gotFailureForTheCurrentYearCN = new bool[pNbYearsParallel];
+			for (unsigned int numSpace = 0; numSpace < pNbYearsParallel; numSpace++)
+			{
+				pValuesForTheCurrentYear[numSpace].initializeFromStudy(study);
+				gotFailureForTheCurrentYearCN[numSpace] = false;
+			}
+
 			// Next
 			NextType::initializeFromStudy(study);
 		}
@@ -162,6 +173,12 @@ namespace AdequacyDraft
 
 		void yearBegin(unsigned int year, unsigned int numSpace)
 		{
+			if (AncestorType::isComputed)
+			{
+				// Reset the values for the current year
+				pValuesForTheCurrentYear[numSpace].reset();
+			}
+
 			// Next variable
 			NextType::yearBegin(year, numSpace);
 		}
@@ -187,10 +204,13 @@ namespace AdequacyDraft
 		
 		void yearEnd(unsigned int year, unsigned int numSpace)
 		{
-			if (gotFailureForTheCurrentYearCN)
+			if (AncestorType::isComputed)
 			{
-				AncestorType::pResults.andYear[year] = 1.;
-				gotFailureForTheCurrentYearCN = false;
+				if (gotFailureForTheCurrentYearCN[numSpace])
+				{
+					AncestorType::pResults.andYear[year] = 1.;
+					gotFailureForTheCurrentYearCN[numSpace] = false;
+				}
 			}
 
 			// Next variable
@@ -198,8 +218,17 @@ namespace AdequacyDraft
 		}
 
 		void computeSummary(std::map<unsigned int, unsigned int> & numSpaceToYear, unsigned int nbYearsForCurrentSummary)
-		{			
-			// Nothing to do here because number of parallel years is reduced to 1 in draft mode
+		{
+			if (AncestorType::isComputed)
+			{
+				for (auto it = numSpaceToYear.begin(); it != numSpaceToYear.end(); ++it)
+				{
+					// Merge the hours in failure with the global results
+					const IntermediateValues& values = pValuesForTheCurrentYear[it->first];
+					for (unsigned int h = 0; h != maxHoursInAYear; ++h)
+						AncestorType::pResults.andHourly[h] += values.hour[h];
+				}
+			}
 
 			// Next variable
 			NextType::computeSummary(numSpaceToYear, nbYearsForCurrentSummary);
@@ -213,10 +242,13 @@ namespace AdequacyDraft
 
 		void hourForEachArea(State& state, unsigned int numSpace)
 		{
-			if (state.hourlyAdequacyResults->DefaillanceAvecReseau > 0.)
+			if (AncestorType::isComputed)
 			{
-				AncestorType::pResults.andHourly[state.hourInTheYear] += 100.;
-				gotFailureForTheCurrentYearCN = true;
+				if (state.hourlyAdequacyResults->DefaillanceAvecReseau > 0.)
+				{
+					pValuesForTheCurrentYear[numSpace].hour[state.hourInTheYear] = 100.;
+					gotFailureForTheCurrentYearCN[numSpace] = true;
+				}
 			}
 			// Next variable
 			NextType::hourForEachArea(state, numSpace);
@@ -241,8 +273,11 @@ namespace AdequacyDraft
 		}
 
 
-	public:
-		bool gotFailureForTheCurrentYearCN;
+	private:
+		//! Intermediate values for each year
+		IntermediateValues* pValuesForTheCurrentYear;
+		unsigned int pNbYearsParallel;
+		bool* gotFailureForTheCurrentYearCN;
 
 	}; // class LOLP_CN
 
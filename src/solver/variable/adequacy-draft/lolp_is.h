@@ -115,15 +115,27 @@ namespace AdequacyDraft
 		};
 
 	public:
-		~LOLP_IS() {}
+		~LOLP_IS()
+		{
+			delete[] pValuesForTheCurrentYear;
+			delete[] gotFailureForTheCurrentYearIS;
+		}
 
 		void initializeFromStudy(Data::Study& study)
 		{
-			// Average on all years
-			gotFailureForTheCurrentYearIS = false;
 			AncestorType::pResults.initializeFromStudy(study);
 			AncestorType::pResults.reset();
 
+			// Intermediate values
+			pNbYearsParallel = study.maxNbYearsInParallel;
+			pValuesForTheCurrentYear = new IntermediateValues[pNbYearsParallel];
+			gotFailureForTheCurrentYearIS = new bool[pNbYearsParallel];
+			for (unsigned int numSpace = 0; numSpace < pNbYearsParallel; numSpace++)
+			{
+				pValuesForTheCurrentYear[numSpace].initializeFromStudy(study);
+				gotFailureForTheCurrentYearIS[numSpace] = false;
+			}
+
 			// Next
 			NextType::initializeFromStudy(study);
 		}
@@ -161,6 +173,12 @@ namespace AdequacyDraft
 
 		void yearBegin(unsigned int year, unsigned int numSpace)
 		{
+			if (AncestorType::isComputed)
+			{
+				// Reset the values for the current year
+				pValuesForTheCurrentYear[numSpace].reset();
+			}
+
 			// Next variable
 			NextType::yearBegin(year, numSpace);
 		}
@@ -186,10 +204,13 @@ namespace AdequacyDraft
 		
 		void yearEnd(unsigned int year, unsigned int numSpace)
 		{
-			if (gotFailureForTheCurrentYearIS)
+			if (AncestorType::isComputed)
 			{
-				AncestorType::pResults.andYear[year] = 1.;
-				gotFailureForTheCurrentYearIS = false;
+				if (gotFailureForTheCurrentYearIS[numSpace])
+				{
+					AncestorType::pResults.andYear[year] = 1.;
+					gotFailureForTheCurrentYearIS[numSpace] = false;
+				}
 			}
 
 			// Next variable
@@ -197,9 +218,18 @@ namespace AdequacyDraft
 		}
 
 		void computeSummary(std::map<unsigned int, unsigned int> & numSpaceToYear, unsigned int nbYearsForCurrentSummary)
-		{			
-			// Nothing to do here because number of parallel years is reduced to 1 in draft mode
-			
+		{
+			if (AncestorType::isComputed)
+			{
+				for (auto it = numSpaceToYear.begin(); it != numSpaceToYear.end(); ++it)
+				{
+					// Merge the hours in failure with the global results
+					const IntermediateValues& values = pValuesForTheCurrentYear[it->first];
+					for (unsigned int h = 0; h != maxHoursInAYear; ++h)
+						AncestorType::pResults.andHourly[h] += values.hour[h];
+				}
+			}
+
 			// Next variable
 			NextType::computeSummary(numSpaceToYear, nbYearsForCurrentSummary);
 		}
@@ -212,10 +242,13 @@ namespace AdequacyDraft
 
 		void hourForEachArea(State& state, unsigned int numSpace)
 		{
-			if (state.hourlyAdequacyResults->DefaillanceHorsReseau > 0.)
+			if (AncestorType::isComputed)
 			{
-				AncestorType::pResults.andHourly[state.hourInTheYear] += 100.;
-				gotFailureForTheCurrentYearIS = true;
+				if (state.hourlyAdequacyResults->DefaillanceHorsReseau > 0.)
+				{
+					pValuesForTheCurrentYear[numSpace].hour[state.hourInTheYear] = 100.;
+					gotFailureForTheCurrentYearIS[numSpace] = true;
+				}
 			}
 			// Next variable
 			NextType::hourForEachArea(state, numSpace);
@@ -240,8 +273,11 @@ namespace AdequacyDraft
 		}
 
 
-	public:
-		bool gotFailureForTheCurrentYearIS;
+	private:
+		//! Intermediate values for each year
+		IntermediateValues* pValuesForTheCurrentYear;
+		unsigned int pNbYearsParallel;
+		bool* gotFailureForTheCurrentYearIS;
 
 	}; // class LOLP_IS
 
@@ -115,12 +115,27 @@ namespace AdequacyDraft
 		};
 
 	public:
-		~LOLP_IS_System() {	}
+		~LOLP_IS_System()
+		{
+			delete[] pValuesForTheCurrentYear;
+			delete[] pGotFailure;
+		}
 
 		void initializeFromStudy(Data::Study& study)
 		{			
 			// Average on all years
 			pRatio = 100. / study.runtime->rangeLimits.year[Data::rangeCount];
+
+			// Intermediate values
+			pNbYearsParallel = study.maxNbYearsInParallel;
+			pValuesForTheCurrentYear = new IntermediateValues[pNbYearsParallel];
+			pGotFailure = new double[pNbYearsParallel];
+			for (unsigned int numSpace = 0; numSpace < pNbYearsParallel; numSpace++)
+			{
+				pValuesForTheCurrentYear[numSpace].initializeFromStudy(study);
+				pGotFailure[numSpace] = 0.;
+			}
+
 			AncestorType::pResults.initializeFromStudy(study);
 			AncestorType::pResults.reset();
 
@@ -164,7 +179,13 @@ namespace AdequacyDraft
 
 		void yearBegin(unsigned int year, unsigned int numSpace)
 		{
-			pGotFailure = 0.;
+			if (AncestorType::isComputed)
+			{
+				// Reset the values for the current year
+				pValuesForTheCurrentYear[numSpace].reset();
+
+				pGotFailure[numSpace] = 0.;
+			}
 			// Next variable
 			NextType::yearBegin(year, numSpace);
 		}
@@ -189,10 +210,13 @@ namespace AdequacyDraft
 		
 		void yearEnd(unsigned int y, unsigned int numSpace)
 		{
-			if (pGotFailure > 0.)
+			if (AncestorType::isComputed)
 			{
-				AncestorType::pResults.rawdata.year[y] += pRatio;
-				pGotFailure = false;
+				if (pGotFailure[numSpace] > 0.)
+				{
+					AncestorType::pResults.rawdata.year[y] += pRatio;
+					pGotFailure[numSpace] = 0.;
+				}
 			}
 			// Next variable
 			NextType::yearEnd(y, numSpace);
@@ -200,23 +224,37 @@ namespace AdequacyDraft
 
 		void computeSummary(std::map<unsigned int, unsigned int> & numSpaceToYear, unsigned int nbYearsForCurrentSummary)
 		{
+			if (AncestorType::isComputed)
+			{
+				// Merge all those values with the global results, in the order of the years
+				for (auto it = numSpaceToYear.begin(); it != numSpaceToYear.end(); ++it)
+				{
+					const IntermediateValues& values = pValuesForTheCurrentYear[it->first];
+					for (unsigned int h = 0; h != maxHoursInAYear; ++h)
+						AncestorType::pResults.rawdata.hourly[h] += values.hour[h];
+				}
+			}
+
 			// Next variable
 			NextType::computeSummary(numSpaceToYear, nbYearsForCurrentSummary);
 		}
 
 		void hourBegin(unsigned int hourInTheYear)
 		{
-			AncestorType::pResults.rawdata.hourly[hourInTheYear]
-				+= (double) ProblemeHoraireAdequation.DefaillanceEuropeenneHorsReseau * pRatio;
-
-			pGotFailure += (double)ProblemeHoraireAdequation.DefaillanceEuropeenneHorsReseau;
-
 			// Next variable
 			NextType::hourBegin(hourInTheYear);
 		}
 
 		void hourForEachArea(State& state, unsigned int numSpace)
 		{
+			if (AncestorType::isComputed)
+			{
+				const PROBLEME_HORAIRE_ADEQUATION& problem = *state.problemeHoraireAdequation;
+				pValuesForTheCurrentYear[numSpace].hour[state.hourInTheYear]
+					= (double) problem.DefaillanceEuropeenneHorsReseau * pRatio;
+				pGotFailure[numSpace] += (double) problem.DefaillanceEuropeenneHorsReseau;
+			}
+
 			// Next variable
 			NextType::hourForEachArea(state, numSpace);
 		}
@@ -241,7 +279,10 @@ namespace AdequacyDraft
 
 	private:
 		double pRatio;
-		double pGotFailure;
+		//! Intermediate values for each year
+		IntermediateValues* pValuesForTheCurrentYear;
+		unsigned int pNbYearsParallel;
+		double* pGotFailure;
 
 	}; // class LOLP_IS_System
 
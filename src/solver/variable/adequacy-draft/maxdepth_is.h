@@ -115,7 +115,10 @@ namespace AdequacyDraft
 		};
 
 	public:
-		~MaxDepth_IS() {}
+		~MaxDepth_IS()
+		{
+			delete[] pMargin;
+		}
 
 		void initializeFromStudy(Data::Study& study)
 		{			
@@ -123,6 +126,10 @@ namespace AdequacyDraft
 			AncestorType::pResults.initializeFromStudy(study);
 			AncestorType::pResults.reset();
 
+			// Intermediate values
+			pNbYearsParallel = study.maxNbYearsInParallel;
+			pMargin = new double[pNbYearsParallel];
+
 			// Next
 			NextType::initializeFromStudy(study);
 		}
@@ -160,7 +167,10 @@ namespace AdequacyDraft
 
 		void yearBegin(unsigned int year, unsigned int numSpace)
 		{
-			pMargin = 1e100;
+			if (AncestorType::isComputed)
+			{
+				pMargin[numSpace] = 1e100;
+			}
 			// Next variable
 			NextType::yearBegin(year, numSpace);
 		}
@@ -186,7 +196,10 @@ namespace AdequacyDraft
 		
 		void yearEnd(unsigned int y, unsigned int numSpace)
 		{
-			AncestorType::pResults.rawdata.year[y] = pMargin;
+			if (AncestorType::isComputed)
+			{
+				AncestorType::pResults.rawdata.year[y] = pMargin[numSpace];
+			}
 			// Next variable
 			NextType::yearEnd(y, numSpace);
 		}
@@ -207,8 +220,11 @@ namespace AdequacyDraft
 
 		void hourForEachArea(State& state, unsigned int numSpace)
 		{
-			if (state.hourlyAdequacyResults->MargeHorsReseau < pMargin)
-				pMargin = state.hourlyAdequacyResults->MargeHorsReseau;
+			if (AncestorType::isComputed)
+			{
+				if (state.hourlyAdequacyResults->MargeHorsReseau < pMargin[numSpace])
+					pMargin[numSpace] = state.hourlyAdequacyResults->MargeHorsReseau;
+			}
 			// Next variable
 			NextType::hourForEachArea(state, numSpace);
 		}
@@ -233,7 +249,9 @@ namespace AdequacyDraft
 
 
 	private:
-		double pMargin;
+		//! The lowest margin of the current year, for each year
+		double* pMargin;
+		unsigned int pNbYearsParallel;
 
 	}; // class MaxDepth_IS
 
@@ -117,7 +117,10 @@ namespace AdequacyDraft
 		};
 
 	public:
-		~MinMarg_CN() {	}
+		~MinMarg_CN()
+		{
+			delete[] pValuesForTheCurrentYear;
+		}
 
 		void initializeFromStudy(Data::Study& study)
 		{			
@@ -126,7 +129,10 @@ namespace AdequacyDraft
 			AncestorType::pResults.reset();
 			AncestorType::pResults.averageMaxValue(study.runtime->rangeLimits.year[Data::rangeCount]);
 
-			pValuesForTheCurrentYear.initializeFromStudy(study);
+			pNbYearsParallel = study.maxNbYearsInParallel;
+			pValuesForTheCurrentYear = new IntermediateValues[pNbYearsParallel];
+			for (unsigned int numSpace = 0; numSpace < pNbYearsParallel; numSpace++)
+				pValuesForTheCurrentYear[numSpace].initializeFromStudy(study);
 
 			// Next
 			NextType::initializeFromStudy(study);
@@ -166,8 +172,11 @@ namespace AdequacyDraft
 
 		void yearBegin(unsigned int year, unsigned int numSpace)
 		{
-			// Reset the values for the current year
-			pValuesForTheCurrentYear.reset();
+			if (AncestorType::isComputed)
+			{
+				// Reset the values for the current year
+				pValuesForTheCurrentYear[numSpace].reset();
+			}
 
 			// Next variable
 			NextType::yearBegin(year, numSpace);
@@ -194,11 +203,12 @@ namespace AdequacyDraft
 		
 		void yearEnd(unsigned int year, unsigned int numSpace)
 		{
-			// Compute all statistics for the current year (daily,weekly,monthly)
-			pValuesForTheCurrentYear.computeStatisticsAdequacyForTheCurrentYear();
-			pValuesForTheCurrentYear.adjustValuesAdequacyWhenRelatedToAPrice();
-			// Merge all those values with the global results
-			AncestorType::pResults.merge(year, pValuesForTheCurrentYear);
+			if (AncestorType::isComputed)
+			{
+				// Compute all statistics for the current year (daily,weekly,monthly)
+				pValuesForTheCurrentYear[numSpace].computeStatisticsAdequacyForTheCurrentYear();
+				pValuesForTheCurrentYear[numSpace].adjustValuesAdequacyWhenRelatedToAPrice();
+			}
 
 			// Next variable
 			NextType::yearEnd(year, numSpace);
@@ -206,7 +216,14 @@ namespace AdequacyDraft
 
 		void computeSummary(std::map<unsigned int, unsigned int> & numSpaceToYear, unsigned int nbYearsForCurrentSummary)
 		{
-			// Nothing to do here because number of parallel years is reduced to 1 in draft mode
+			if (AncestorType::isComputed)
+			{
+				for (auto it = numSpaceToYear.begin(); it != numSpaceToYear.end(); ++it)
+				{
+					// Merge all those values with the global results
+					AncestorType::pResults.merge(it->second /*year*/, pValuesForTheCurrentYear[it->first]);
+				}
+			}
 
 			// Next variable
 			NextType::computeSummary(numSpaceToYear, nbYearsForCurrentSummary);
@@ -220,7 +237,10 @@ namespace AdequacyDraft
 
 		void hourForEachArea(State& state, unsigned int numSpace)
 		{
-			pValuesForTheCurrentYear[state.hourInTheYear] = state.hourlyAdequacyResults->MargeAvecReseau;
+			if (AncestorType::isComputed)
+			{
+				pValuesForTheCurrentYear[numSpace][state.hourInTheYear] = state.hourlyAdequacyResults->MargeAvecReseau;
+			}
 			// Next variable
 			NextType::hourForEachArea(state, numSpace);
 		}
@@ -245,7 +265,8 @@ namespace AdequacyDraft
 
 	private:
 		//! Intermediate values for each year
-		IntermediateValues pValuesForTheCurrentYear;
+		IntermediateValues* pValuesForTheCurrentYear;
+		unsigned int pNbYearsParallel;
 	}; // class MinMarg_CN
 
 
@@ -200,8 +200,11 @@ namespace Adequacy
 
 		void yearBegin(unsigned int year, unsigned int numSpace)
 		{
-			// Reset the values for the current year
-			pValuesForTheCurrentYear[numSpace].reset();
+			if (AncestorType::isComputed)
+			{
+				// Reset the values for the current year
+				pValuesForTheCurrentYear[numSpace].reset();
+			}
 			// Next variable
 			NextType::yearBegin(year, numSpace);
 		}
@@ -214,10 +217,13 @@ namespace Adequacy
 
 		void yearEndBuildForEachThermalCluster(State& state, uint year, unsigned int numSpace)
 		{
-			// Get end year calculations
-			for (unsigned int i = 0; i < state.study.runtime->rangeLimits.hour[Data::rangeCount]; ++i)
+			if (AncestorType::isComputed)
 			{
-				pValuesForTheCurrentYear[numSpace][i] += state.thermalClusterOperatingCostForYear[i];
+				// Get end year calculations
+				for (unsigned int i = 0; i < state.study.runtime->rangeLimits.hour[Data::rangeCount]; ++i)
+				{
+					pValuesForTheCurrentYear[numSpace][i] += state.thermalClusterOperatingCostForYear[i];
+				}
 			}
 
 			// Next variable
@@ -233,8 +239,11 @@ namespace Adequacy
 
 		void yearEnd(unsigned int year, unsigned int numSpace)
 		{
-			// Compute all statistics for the current year (daily,weekly,monthly)
-			pValuesForTheCurrentYear[numSpace].computeStatisticsForTheCurrentYear();
+			if (AncestorType::isComputed)
+			{
+				// Compute all statistics for the current year (daily,weekly,monthly)
+				pValuesForTheCurrentYear[numSpace].computeStatisticsForTheCurrentYear();
+			}
 
 			// Next variable
 			NextType::yearEnd(year, numSpace);
@@ -242,10 +251,13 @@ namespace Adequacy
 
 		void computeSummary(std::map<unsigned int, unsigned int> & numSpaceToYear, unsigned int nbYearsForCurrentSummary)
 		{
-			for (unsigned int numSpace = 0; numSpace < nbYearsForCurrentSummary; ++numSpace)
+			if (AncestorType::isComputed)
 			{
-				// Merge all those values with the global results
-				AncestorType::pResults.merge(numSpaceToYear[numSpace] /*year*/, pValuesForTheCurrentYear[numSpace]);
+				for (auto it = numSpaceToYear.begin(); it != numSpaceToYear.end(); ++it)
+				{
+					// Merge all those values with the global results
+					AncestorType::pResults.merge(it->second /*year*/, pValuesForTheCurrentYear[it->first]);
+				}
 			}
 			
 			// Next variable
@@ -260,22 +272,25 @@ namespace Adequacy
 
 		void hourForEachArea(State& state, unsigned int numSpace)
 		{
-			// Total UnsupliedEnergy emissions
-			pValuesForTheCurrentYear[numSpace][state.hourInTheYear] +=
-				// Current Hydro Storage generation
-				(state.hourlyResults->ValeursHorairesDeDefaillancePositive[state.hourInTheWeek]
-				* state.area->thermal.unsuppliedEnergyCost)
-				+
-				((state.hourlyResults->ValeursHorairesDeDefaillanceNegative[state.hourInTheWeek]
-				+ state.resSpilled.entry[state.area->index][state.hourInTheWeek])
-				* state.area->thermal.spilledEnergyCost);
-
-			// Hydro costs : water value and pumping
-			pValuesForTheCurrentYear[numSpace].hour[state.hourInTheYear] +=
-				state.problemeHebdo->CaracteristiquesHydrauliques[state.area->index]->WeeklyWaterValueStateRegular
-				*
-				(state.hourlyResults->TurbinageHoraire[state.hourInTheWeek]
-					- state.area->hydro.pumpingEfficiency * state.hourlyResults->PompageHoraire[state.hourInTheWeek]);
+			if (AncestorType::isComputed)
+			{
+				// Total UnsupliedEnergy emissions
+				pValuesForTheCurrentYear[numSpace][state.hourInTheYear] +=
+					// Current Hydro Storage generation
+					(state.hourlyResults->ValeursHorairesDeDefaillancePositive[state.hourInTheWeek]
+					* state.area->thermal.unsuppliedEnergyCost)
+					+
+					((state.hourlyResults->ValeursHorairesDeDefaillanceNegative[state.hourInTheWeek]
+					+ state.resSpilled.entry[state.area->index][state.hourInTheWeek])
+					* state.area->thermal.spilledEnergyCost);
+
+				// Hydro costs : water value and pumping
+				pValuesForTheCurrentYear[numSpace].hour[state.hourInTheYear] +=
+					state.problemeHebdo->CaracteristiquesHydrauliques[state.area->index]->WeeklyWaterValueStateRegular
+					*
+					(state.hourlyResults->TurbinageHoraire[state.hourInTheWeek]
+						- state.area->hydro.pumpingEfficiency * state.hourlyResults->PompageHoraire[state.hourInTheWeek]);
+			}
 
 			// Next variable
 			NextType::hourForEachArea(state, numSpace);
@@ -283,8 +298,11 @@ namespace Adequacy
 
 		void hourForEachThermalCluster(State& state, unsigned int numSpace)
 		{
-			// Total OverallCost
-			pValuesForTheCurrentYear[numSpace][state.hourInTheYear] += state.thermalClusterOperatingCost;
+			if (AncestorType::isComputed)
+			{
+				// Total OverallCost
+				pValuesForTheCurrentYear[numSpace][state.hourInTheYear] += state.thermalClusterOperatingCost;
+			}
 			// Next item in the list
 			NextType::hourForEachThermalCluster(state, numSpace);
 		}
@@ -294,7 +312,7 @@ namespace Adequacy
 			NextType::hourEnd(state, hourInTheYear);
 		}
 
-		Antares::Memory::Stored<double>::ConstReturnType retrieveRawHourlyValuesForCurrentYear(unsigned int, unsigned int numSpace) const
+		Antares::Memory::Stored<IntermediateValues::HourlyType>::ConstReturnType retrieveRawHourlyValuesForCurrentYear(unsigned int, unsigned int numSpace) const
 		{
 			return pValuesForTheCurrentYear[numSpace].hour;
 		}
@@ -194,8 +194,11 @@ namespace Adequacy
 
 		void yearBegin(unsigned int year, unsigned int numSpace)
 		{
-			// Reset the values for the current year
-			pValuesForTheCurrentYear[numSpace].reset();
+			if (AncestorType::isComputed)
+			{
+				// Reset the values for the current year
+				pValuesForTheCurrentYear[numSpace].reset();
+			}
 			// Next variable
 			NextType::yearBegin(year, numSpace);
 		}
@@ -221,8 +224,11 @@ namespace Adequacy
 		
 		void yearEnd(unsigned int year, unsigned int numSpace)
 		{
-			// Compute all statistics for the current year (daily,weekly,monthly)
-			pValuesForTheCurrentYear[numSpace].computeStatisticsForTheCurrentYear();
+			if (AncestorType::isComputed)
+			{
+				// Compute all statistics for the current year (daily,weekly,monthly)
+				pValuesForTheCurrentYear[numSpace].computeStatisticsForTheCurrentYear();
+			}
 
 			// Next variable
 			NextType::yearEnd(year, numSpace);
@@ -230,10 +236,13 @@ namespace Adequacy
 
 		void computeSummary(std::map<unsigned int, unsigned int> & numSpaceToYear, unsigned int nbYearsForCurrentSummary)
 		{
-			for (unsigned int numSpace = 0; numSpace < nbYearsForCurrentSummary; ++numSpace)
+			if (AncestorType::isComputed)
 			{
-				// Merge all those values with the global results
-				AncestorType::pResults.merge(numSpaceToYear[numSpace] /*year*/, pValuesForTheCurrentYear[numSpace]);
+				for (auto it = numSpaceToYear.begin(); it != numSpaceToYear.end(); ++it)
+				{
+					// Merge all those values with the global results
+					AncestorType::pResults.merge(it->second /*year*/, pValuesForTheCurrentYear[it->first]);
+				}
 			}
 			
 			// Next variable
@@ -248,12 +257,15 @@ namespace Adequacy
 
 		void hourForEachArea(State& state, unsigned int numSpace)
 		{
-			assert(state.hourlyResults && "Invalid pointer to simplex results");
+			if (AncestorType::isComputed)
+			{
+				assert(state.hourlyResults && "Invalid pointer to simplex results");
 
-			// Total SpilledEnergy emissions
-			pValuesForTheCurrentYear[numSpace][state.hourInTheYear] =
-				+ state.hourlyResults->ValeursHorairesDeDefaillanceNegative[state.hourInTheWeek]
-				+ state.resSpilled.entry[state.area->index][state.hourInTheWeek];
+				// Total SpilledEnergy emissions
+				pValuesForTheCurrentYear[numSpace][state.hourInTheYear] =
+					+ state.hourlyResults->ValeursHorairesDeDefaillanceNegative[state.hourInTheWeek]
+					+ state.resSpilled.entry[state.area->index][state.hourInTheWeek];
+			}
 
 			// Next variable
 			NextType::hourForEachArea(state, numSpace);
@@ -271,7 +283,7 @@ namespace Adequacy
 			NextType::hourEnd(state, hourInTheYear);
 		}
 
-		Antares::Memory::Stored<double>::ConstReturnType retrieveRawHourlyValuesForCurrentYear(unsigned int, unsigned int numSpace) const
+		Antares::Memory::Stored<IntermediateValues::HourlyType>::ConstReturnType retrieveRawHourlyValuesForCurrentYear(unsigned int, unsigned int numSpace) const
 		{
 			return pValuesForTheCurrentYear[numSpace].hour;
 		}
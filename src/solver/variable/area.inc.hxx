@@ -27,6 +27,7 @@
 
 #include "variable.h"
 #include "area.h"
+#include "summary.h"
 #include <cassert>
 
 
@@ -190,11 +191,6 @@ namespace Variable
 			state.initFromAreaIndex(area.index, numSpace);
 
 			auto& variablesForArea = pAreas[area.index];
-
-			// DTG MRG
-			state.dispatchableMargin =
-				variablesForArea.retrieveHourlyResultsForCurrentYear <Economy::VCardDispatchableGenMargin>(numSpace);
-
 			variablesForArea.weekForEachArea(state, numSpace);
 
 			// NOTE
@@ -278,11 +274,11 @@ namespace Variable
 	template<>
 	void Areas<NEXTTYPE>::computeSummary(std::map<unsigned int, unsigned int> & numSpaceToYear, unsigned int nbYearsForCurrentSummary)
 	{
-		for (uint i = 0; i != pAreaCount; ++i)
+		// The results of an area only depend on its own variables
+		MergeItemsIntoSummary(pAreaCount, [&] (uint i)
 		{
-			// Broadcast to all areas
 			pAreas[i].computeSummary(numSpaceToYear, nbYearsForCurrentSummary);
-		}
+		});
 	}
 
 
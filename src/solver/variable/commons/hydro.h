@@ -200,11 +200,14 @@ namespace Economy
 
 		void yearBegin(unsigned int year, unsigned int numSpace)
 		{
-			// The current time-series
-			auto& ror = pArea->hydro.series->ror;
-			const unsigned int nbchro = NumeroChroniquesTireesParPays[numSpace][pArea->index]->Hydraulique;
-			pFatalValues[numSpace] = &(ror.entry[(nbchro < ror.width ? nbchro : 0)]);
-			ror.flush();
+			if (AncestorType::isComputed)
+			{
+				// The current time-series
+				auto& ror = pArea->hydro.series->ror;
+				const unsigned int nbchro = NumeroChroniquesTireesParPays[numSpace][pArea->index]->Hydraulique;
+				pFatalValues[numSpace] = &(ror.entry[(nbchro < ror.width ? nbchro : 0)]);
+				ror.flush();
+			}
 			// Next variable
 			NextType::yearBegin(year, numSpace);
 		}
@@ -230,8 +233,11 @@ namespace Economy
 		
 		void yearEnd(unsigned int year, unsigned int numSpace)
 		{
-			// Compute all statistics for the current year (daily,weekly,monthly)
-			pValuesForTheCurrentYear[numSpace].computeStatisticsForTheCurrentYear();
+			if (AncestorType::isComputed)
+			{
+				// Compute all statistics for the current year (daily,weekly,monthly)
+				pValuesForTheCurrentYear[numSpace].computeStatisticsForTheCurrentYear();
+			}
 
 			// Next variable
 			NextType::yearEnd(year, numSpace);
@@ -239,10 +245,13 @@ namespace Economy
 
 		void computeSummary(std::map<unsigned int, unsigned int> & numSpaceToYear, unsigned int nbYearsForCurrentSummary)
 		{
-			for (unsigned int numSpace = 0; numSpace < nbYearsForCurrentSummary; ++numSpace)
+			if (AncestorType::isComputed)
 			{
-				// Merge all those values with the global results
-				AncestorType::pResults.merge(numSpaceToYear[numSpace] /*year*/, pValuesForTheCurrentYear[numSpace]);
+				for (auto it = numSpaceToYear.begin(); it != numSpaceToYear.end(); ++it)
+				{
+					// Merge all those values with the global results
+					AncestorType::pResults.merge(it->second /*year*/, pValuesForTheCurrentYear[it->first]);
+				}
 			}
 			
 			// Next variable
@@ -257,7 +266,10 @@ namespace Economy
 
 		void hourForEachArea(State& state, unsigned int numSpace)
 		{
-			pValuesForTheCurrentYear[numSpace][state.hourInTheYear] = (*pFatalValues[numSpace])[state.hourInTheYear];
+			if (AncestorType::isComputed)
+			{
+				pValuesForTheCurrentYear[numSpace][state.hourInTheYear] = (*pFatalValues[numSpace])[state.hourInTheYear];
+			}
 			// Next variable
 			NextType::hourForEachArea(state, numSpace);
 		}
@@ -273,7 +285,7 @@ namespace Economy
 			NextType::hourEnd(state, hourInTheYear);
 		}
 
-		Antares::Memory::Stored<double>::ConstReturnType retrieveRawHourlyValuesForCurrentYear(unsigned int, unsigned int numSpace) const
+		Antares::Memory::Stored<IntermediateValues::HourlyType>::ConstReturnType retrieveRawHourlyValuesForCurrentYear(unsigned int, unsigned int numSpace) const
 		{
 			return pValuesForTheCurrentYear[numSpace].hour;
 		}
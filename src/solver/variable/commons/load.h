@@ -196,15 +196,18 @@ namespace Economy
 
 		void yearBegin(unsigned int year, unsigned int numSpace)
 		{
-			// The current time-series
-			//
-			// At this point, these values are not the raw values of the load timeseries
-			// see performTransformationsBeforeLaunchingSimulation()
-			// L* = L + DSM
-			//
-			(void)::memcpy(pValuesForTheCurrentYear[numSpace].hour,
-				pArea->load.series->series[NumeroChroniquesTireesParPays[numSpace][pArea->index]->Consommation],
-				sizeof(double) * pArea->load.series->series.height);
+			if (AncestorType::isComputed)
+			{
+				// The current time-series
+				//
+				// At this point, these values are not the raw values of the load timeseries
+				// see performTransformationsBeforeLaunchingSimulation()
+				// L* = L + DSM
+				//
+				pValuesForTheCurrentYear[numSpace].copyHourlyValues(
+					pArea->load.series->series[NumeroChroniquesTireesParPays[numSpace][pArea->index]->Consommation],
+					pArea->load.series->series.height);
+			}
 
 			// Next variable
 			NextType::yearBegin(year, numSpace);
@@ -231,8 +234,11 @@ namespace Economy
 		
 		void yearEnd(unsigned int year, unsigned int numSpace)
 		{
-			// Compute all statistics for the current year (daily,weekly,monthly)
-			pValuesForTheCurrentYear[numSpace].computeStatisticsForTheCurrentYear();
+			if (AncestorType::isComputed)
+			{
+				// Compute all statistics for the current year (daily,weekly,monthly)
+				pValuesForTheCurrentYear[numSpace].computeStatisticsForTheCurrentYear();
+			}
 
 			// Next variable
 			NextType::yearEnd(year, numSpace);
@@ -240,10 +246,13 @@ namespace Economy
 
 		void computeSummary(std::map<unsigned int, unsigned int> & numSpaceToYear, unsigned int nbYearsForCurrentSummary)
 		{
-			for (unsigned int numSpace = 0; numSpace < nbYearsForCurrentSummary; ++numSpace)
+			if (AncestorType::isComputed)
 			{
-				// Merge all those values with the global results
-				AncestorType::pResults.merge(numSpaceToYear[numSpace] /*year*/, pValuesForTheCurrentYear[numSpace]);
+				for (auto it = numSpaceToYear.begin(); it != numSpaceToYear.end(); ++it)
+				{
+					// Merge all those values with the global results
+					AncestorType::pResults.merge(it->second /*year*/, pValuesForTheCurrentYear[it->first]);
+				}
 			}
 			
 			// Next variable
@@ -274,7 +283,7 @@ namespace Economy
 		}
 
 
-		Antares::Memory::Stored<double>::ConstReturnType retrieveRawHourlyValuesForCurrentYear(unsigned int, unsigned int numSpace) const
+		Antares::Memory::Stored<IntermediateValues::HourlyType>::ConstReturnType retrieveRawHourlyValuesForCurrentYear(unsigned int, unsigned int numSpace) const
 		{
 			return pValuesForTheCurrentYear[numSpace].hour;
 		}
@@ -155,7 +155,7 @@ namespace Economy
 			for(unsigned int numSpace = 0; numSpace < pNbYearsParallel; numSpace++)
 			{
 				// Memcpy for the first value
-				(void)::memcpy(pValuesForTheCurrentYear[numSpace].hour, area->miscGen.entry[0], sizeof(double) * area->miscGen.height);
+				pValuesForTheCurrentYear[numSpace].copyHourlyValues(area->miscGen.entry[0], area->miscGen.height);
 
 				{
 					// We must not include the CHP and the Solar. So we have to start from `2`
@@ -232,8 +232,11 @@ namespace Economy
 		
 		void yearEnd(unsigned int year, unsigned int numSpace)
 		{
-			// Compute all statistics for the current year (daily,weekly,monthly)
-			pValuesForTheCurrentYear[numSpace].computeStatisticsForTheCurrentYear();
+			if (AncestorType::isComputed)
+			{
+				// Compute all statistics for the current year (daily,weekly,monthly)
+				pValuesForTheCurrentYear[numSpace].computeStatisticsForTheCurrentYear();
+			}
 
 			// Next variable
 			NextType::yearEnd(year, numSpace);
@@ -241,8 +244,11 @@ namespace Economy
 
 		void computeSummary(std::map<unsigned int, unsigned int> & numSpaceToYear, unsigned int nbYearsForCurrentSummary)
 		{			
-			for (unsigned int numSpace = 0; numSpace < nbYearsForCurrentSummary; ++numSpace)
-				AncestorType::pResults.merge(0, pValuesForTheCurrentYear[numSpace]);
+			if (AncestorType::isComputed)
+			{
+				for (auto it = numSpaceToYear.begin(); it != numSpaceToYear.end(); ++it)
+					AncestorType::pResults.merge(0, pValuesForTheCurrentYear[it->first]);
+			}
 			
 			// Next variable
 			NextType::computeSummary(numSpaceToYear, nbYearsForCurrentSummary);
@@ -271,7 +277,7 @@ namespace Economy
 			NextType::hourEnd(state, hourInTheYear);
 		}
 
-		Antares::Memory::Stored<double>::ConstReturnType retrieveRawHourlyValuesForCurrentYear(unsigned int, unsigned int numSpace) const
+		Antares::Memory::Stored<IntermediateValues::HourlyType>::ConstReturnType retrieveRawHourlyValuesForCurrentYear(unsigned int, unsigned int numSpace) const
 		{
 			return pValuesForTheCurrentYear[numSpace].hour;
 		}
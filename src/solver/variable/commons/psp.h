@@ -153,7 +153,7 @@ namespace Economy
 		{
 			// Copy raw values
 			for(unsigned int numSpace = 0; numSpace < pNbYearsParallel; numSpace++)
-				(void)::memcpy(pValuesForTheCurrentYear[numSpace].hour, area->miscGen.entry[Data::fhhPSP], sizeof(double) * area->miscGen.height);
+				pValuesForTheCurrentYear[numSpace].copyHourlyValues(area->miscGen.entry[Data::fhhPSP], area->miscGen.height);
 
 			// Next
 			NextType::initializeFromArea(study, area);
@@ -219,8 +219,11 @@ namespace Economy
 		
 		void yearEnd(unsigned int year, unsigned int numSpace)
 		{
-			// Compute all statistics for the current year (daily,weekly,monthly)
-			pValuesForTheCurrentYear[numSpace].computeStatisticsForTheCurrentYear();
+			if (AncestorType::isComputed)
+			{
+				// Compute all statistics for the current year (daily,weekly,monthly)
+				pValuesForTheCurrentYear[numSpace].computeStatisticsForTheCurrentYear();
+			}
 
 			// Next variable
 			NextType::yearEnd(year, numSpace);
@@ -228,8 +231,11 @@ namespace Economy
 
 		void computeSummary(std::map<unsigned int, unsigned int> & numSpaceToYear, unsigned int nbYearsForCurrentSummary)
 		{			
-			for (unsigned int numSpace = 0; numSpace < nbYearsForCurrentSummary; ++numSpace)
-				AncestorType::pResults.merge(0, pValuesForTheCurrentYear[numSpace]);
+			if (AncestorType::isComputed)
+			{
+				for (auto it = numSpaceToYear.begin(); it != numSpaceToYear.end(); ++it)
+					AncestorType::pResults.merge(0, pValuesForTheCurrentYear[it->first]);
+			}
 			
 			// Next variable
 			NextType::computeSummary(numSpaceToYear, nbYearsForCurrentSummary);
@@ -258,7 +264,7 @@ namespace Economy
 			NextType::hourEnd(state, hourInTheYear);
 		}
 
-		Antares::Memory::Stored<double>::ConstReturnType retrieveRawHourlyValuesForCurrentYear(unsigned int, unsigned int numSpace) const
+		Antares::Memory::Stored<IntermediateValues::HourlyType>::ConstReturnType retrieveRawHourlyValuesForCurrentYear(unsigned int, unsigned int numSpace) const
 		{
 			return pValuesForTheCurrentYear[numSpace].hour;
 		}
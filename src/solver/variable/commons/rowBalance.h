@@ -155,7 +155,7 @@ namespace Economy
 		{
 			// Copy raw values
 			unsigned int height = area->miscGen.height;
-			(void)::memcpy(pValuesForTheCurrentYear.hour, area->miscGen.entry[Data::fhhRowBalance], sizeof(double) * height);
+			pValuesForTheCurrentYear.copyHourlyValues(area->miscGen.entry[Data::fhhRowBalance], height);
 
 			if (study->parameters.mode == Data::stdmAdequacy)
 			{
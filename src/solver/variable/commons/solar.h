@@ -194,10 +194,13 @@ namespace Economy
 
 		void yearBegin(unsigned int year, unsigned int numSpace)
 		{
-			// The current time-series
-			(void)::memcpy(pValuesForTheCurrentYear[numSpace].hour,
-				pArea->solar.series->series.entry[NumeroChroniquesTireesParPays[numSpace][pArea->index]->Solar],
-				sizeof(double) * pArea->solar.series->series.height);
+			if (AncestorType::isComputed)
+			{
+				// The current time-series
+				pValuesForTheCurrentYear[numSpace].copyHourlyValues(
+					pArea->solar.series->series.entry[NumeroChroniquesTireesParPays[numSpace][pArea->index]->Solar],
+					pArea->solar.series->series.height);
+			}
 
 			// Next variable
 			NextType::yearBegin(year, numSpace);
@@ -224,8 +227,11 @@ namespace Economy
 		
 		void yearEnd(unsigned int year, unsigned int numSpace)
 		{
-			// Compute all statistics for the current year (daily,weekly,monthly)
-			pValuesForTheCurrentYear[numSpace].computeStatisticsForTheCurrentYear();
+			if (AncestorType::isComputed)
+			{
+				// Compute all statistics for the current year (daily,weekly,monthly)
+				pValuesForTheCurrentYear[numSpace].computeStatisticsForTheCurrentYear();
+			}
 
 			// Next variable
 			NextType::yearEnd(year, numSpace);
@@ -233,10 +239,13 @@ namespace Economy
 
 		void computeSummary(std::map<unsigned int, unsigned int> & numSpaceToYear, unsigned int nbYearsForCurrentSummary)
 		{
-			for (unsigned int numSpace = 0; numSpace < nbYearsForCurrentSummary; ++numSpace)
+			if (AncestorType::isComputed)
 			{
-				// Merge all those values with the global results
-				AncestorType::pResults.merge(numSpaceToYear[numSpace] /*year*/, pValuesForTheCurrentYear[numSpace]);
+				for (auto it = numSpaceToYear.begin(); it != numSpaceToYear.end(); ++it)
+				{
+					// Merge all those values with the global results
+					AncestorType::pResults.merge(it->second /*year*/, pValuesForTheCurrentYear[it->first]);
+				}
 			}
 			
 			// Next variable
@@ -266,7 +275,7 @@ namespace Economy
 			NextType::hourEnd(state, hourInTheYear);
 		}
 
-		Antares::Memory::Stored<double>::ConstReturnType retrieveRawHourlyValuesForCurrentYear(unsigned int, unsigned int numSpace) const
+		Antares::Memory::Stored<IntermediateValues::HourlyType>::ConstReturnType retrieveRawHourlyValuesForCurrentYear(unsigned int, unsigned int numSpace) const
 		{
 			return pValuesForTheCurrentYear[numSpace].hour;
 		}
@@ -295,7 +295,7 @@ namespace Common
 		template<class V, class SetT>
 		void yearEndSpatialAggregates(V& allVars, uint year, const SetT& set, uint numSpace)
 		{
-			if (VCardType::VCardOrigin::spatialAggregateMode & Category::spatialAggregateEachYear)
+			if ((VCardType::VCardOrigin::spatialAggregateMode & Category::spatialAggregateEachYear) && AncestorType::isComputed)
 				internalSpatialAggregateForCurrentYear(allVars, set, numSpace);
 
 			// Next variable
@@ -305,7 +305,7 @@ namespace Common
 		template<class V>
 		void computeSpatialAggregatesSummary(V& allVars, std::map<unsigned int, unsigned int> & numSpaceToYear, uint nbYearsForCurrentSummary)
 		{
-			if (VCardType::VCardOrigin::spatialAggregateMode & Category::spatialAggregateEachYear)
+			if ((VCardType::VCardOrigin::spatialAggregateMode & Category::spatialAggregateEachYear) && AncestorType::isComputed)
 				internalSpatialAggregateForParallelYears(numSpaceToYear, nbYearsForCurrentSummary);
 
 			// Next variable
@@ -315,7 +315,7 @@ namespace Common
 		template<class V, class SetT>
 		void simulationEndSpatialAggregates(V& allVars, const SetT& set)
 		{
-			if (VCardType::VCardOrigin::spatialAggregateMode & Category::spatialAggregateOnce)
+			if ((VCardType::VCardOrigin::spatialAggregateMode & Category::spatialAggregateOnce) && AncestorType::isComputed)
 				internalSpatialAggregate(allVars, 0, set);
 
 			// Next variable
@@ -430,12 +430,12 @@ namespace Common
 
 		void internalSpatialAggregateForParallelYears(std::map<unsigned int, unsigned int> & numSpaceToYear, uint nbYearsForCurrentSummary)
 		{
-			for (unsigned int numSpace = 0; numSpace < nbYearsForCurrentSummary; ++numSpace)
+			for (auto it = numSpaceToYear.begin(); it != numSpaceToYear.end(); ++it)
 			{
 				// Merge all those values with the global results
-				VariableAccessorType::ComputeSummary(	pValuesForTheCurrentYear[numSpace],
+				VariableAccessorType::ComputeSummary(	pValuesForTheCurrentYear[it->first],
 														AncestorType::pResults,
-														numSpaceToYear[numSpace]	);
+														it->second	);
 			}
 		}
 
@@ -195,9 +195,12 @@ namespace Economy
 
 		void yearBegin(unsigned int year, unsigned int numSpace)
 		{
-			// The current time-series
-			const Matrix<>::ColumnType& load = pArea->wind.series->series.entry[NumeroChroniquesTireesParPays[numSpace][pArea->index]->Eolien];
-			(void)::memcpy(pValuesForTheCurrentYear[numSpace].hour, load, sizeof(double) * pArea->wind.series->series.height);
+			if (AncestorType::isComputed)
+			{
+				// The current time-series
+				const Matrix<>::ColumnType& load = pArea->wind.series->series.entry[NumeroChroniquesTireesParPays[numSpace][pArea->index]->Eolien];
+				pValuesForTheCurrentYear[numSpace].copyHourlyValues(load, pArea->wind.series->series.height);
+			}
 
 			// Next variable
 			NextType::yearBegin(year, numSpace);
@@ -224,8 +227,11 @@ namespace Economy
 		
 		void yearEnd(unsigned int year, unsigned int numSpace)
 		{
-			// Compute all statistics for the current year (daily,weekly,monthly)
-			pValuesForTheCurrentYear[numSpace].computeStatisticsForTheCurrentYear();
+			if (AncestorType::isComputed)
+			{
+				// Compute all statistics for the current year (daily,weekly,monthly)
+				pValuesForTheCurrentYear[numSpace].computeStatisticsForTheCurrentYear();
+			}
 
 			// Next variable
 			NextType::yearEnd(year, numSpace);
@@ -233,10 +239,13 @@ namespace Economy
 
 		void computeSummary(std::map<unsigned int, unsigned int> & numSpaceToYear, unsigned int nbYearsForCurrentSummary)
 		{
-			for (unsigned int numSpace = 0; numSpace < nbYearsForCurrentSummary; ++numSpace)
+			if (AncestorType::isComputed)
 			{
-				// Merge all those values with the global results
-				AncestorType::pResults.merge(numSpaceToYear[numSpace] /*year*/, pValuesForTheCurrentYear[numSpace]);
+				for (auto it = numSpaceToYear.begin(); it != numSpaceToYear.end(); ++it)
+				{
+					// Merge all those values with the global results
+					AncestorType::pResults.merge(it->second /*year*/, pValuesForTheCurrentYear[it->first]);
+				}
 			}
 			
 			// Next variable
@@ -267,7 +276,7 @@ namespace Economy
 		}
 
 
-		Antares::Memory::Stored<double>::ConstReturnType retrieveRawHourlyValuesForCurrentYear(unsigned int, unsigned int numSpace) const
+		Antares::Memory::Stored<IntermediateValues::HourlyType>::ConstReturnType retrieveRawHourlyValuesForCurrentYear(unsigned int, unsigned int numSpace) const
 		{
 			return pValuesForTheCurrentYear[numSpace].hour;
 		}
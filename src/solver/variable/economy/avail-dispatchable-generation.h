@@ -215,11 +215,14 @@ namespace Economy
 
 		void yearBegin(unsigned int year, unsigned int numSpace)
 		{
-			// Somme de toutes les productions disponibles pour l'ensemble des
-			// paliers thermiques (+must-run)
-			pValuesForTheCurrentYear[numSpace].reset();
-			addThermalClusterList(pArea->thermal.list, numSpace);
-			addThermalClusterList(pArea->thermal.mustrunList, numSpace);
+			if (AncestorType::isComputed)
+			{
+				// Somme de toutes les productions disponibles pour l'ensemble des
+				// paliers thermiques (+must-run)
+				pValuesForTheCurrentYear[numSpace].reset();
+				addThermalClusterList(pArea->thermal.list, numSpace);
+				addThermalClusterList(pArea->thermal.mustrunList, numSpace);
+			}
 
 			// Next variable
 			NextType::yearBegin(year, numSpace);
@@ -248,8 +251,11 @@ namespace Economy
 		
 		void yearEnd(unsigned int year, unsigned int numSpace)
 		{
-			// Compute all statistics for the current year (daily,weekly,monthly)
-			pValuesForTheCurrentYear[numSpace].computeStatisticsForTheCurrentYear();
+			if (AncestorType::isComputed)
+			{
+				// Compute all statistics for the current year (daily,weekly,monthly)
+				pValuesForTheCurrentYear[numSpace].computeStatisticsForTheCurrentYear();
+			}
 
 			// Next variable
 			NextType::yearEnd(year, numSpace);
@@ -257,10 +263,13 @@ namespace Economy
 
 		void computeSummary(std::map<unsigned int, unsigned int> & numSpaceToYear, unsigned int nbYearsForCurrentSummary)
 		{
-			for (unsigned int numSpace = 0; numSpace < nbYearsForCurrentSummary; ++numSpace)
+			if (AncestorType::isComputed)
 			{
-				// Merge all those values with the global results
-				AncestorType::pResults.merge(numSpaceToYear[numSpace] /*year*/, pValuesForTheCurrentYear[numSpace]);
+				for (auto it = numSpaceToYear.begin(); it != numSpaceToYear.end(); ++it)
+				{
+					// Merge all those values with the global results
+					AncestorType::pResults.merge(it->second /*year*/, pValuesForTheCurrentYear[it->first]);
+				}
 			}
 			
 			// Next variable
@@ -292,7 +301,7 @@ namespace Economy
 		}
 
 
-		Antares::Memory::Stored<double>::ConstReturnType retrieveRawHourlyValuesForCurrentYear(unsigned int, unsigned int numSpace) const
+		Antares::Memory::Stored<IntermediateValues::HourlyType>::ConstReturnType retrieveRawHourlyValuesForCurrentYear(unsigned int, unsigned int numSpace) const
 		{
 			return pValuesForTheCurrentYear[numSpace].hour;
 		}
@@ -241,10 +241,10 @@ namespace Economy
 
 		void computeSummary(std::map<unsigned int, unsigned int> & numSpaceToYear, unsigned int nbYearsForCurrentSummary)
 		{
-			for (unsigned int numSpace = 0; numSpace < nbYearsForCurrentSummary; ++numSpace)
+			for (auto it = numSpaceToYear.begin(); it != numSpaceToYear.end(); ++it)
 			{
 				// Merge all those values with the global results
-				AncestorType::pResults.merge(numSpaceToYear[numSpace] /*year*/, pValuesForTheCurrentYear[numSpace]);
+				AncestorType::pResults.merge(it->second /*year*/, pValuesForTheCurrentYear[it->first]);
 			}
 			
 			// Next variable
@@ -290,7 +290,7 @@ namespace Economy
 			NextType::hourEnd(state, hourInTheYear);
 		}
 
-		Antares::Memory::Stored<double>::ConstReturnType
+		Antares::Memory::Stored<IntermediateValues::HourlyType>::ConstReturnType
 		retrieveRawHourlyValuesForCurrentYear(unsigned int, unsigned int numSpace) const
 		{
 			return pValuesForTheCurrentYear[numSpace].hour;
@@ -188,8 +188,11 @@ namespace Economy
 
 		void yearBegin(unsigned int year, unsigned int numSpace)
 		{
-			// Reset the values for the current year
-			pValuesForTheCurrentYear[numSpace].reset();
+			if (AncestorType::isComputed)
+			{
+				// Reset the values for the current year
+				pValuesForTheCurrentYear[numSpace].reset();
+			}
 			// Next variable
 			NextType::yearBegin(year, numSpace);
 		}
@@ -215,8 +218,11 @@ namespace Economy
 		
 		void yearEnd(unsigned int year, unsigned int numSpace)
 		{
-			// Compute all statistics for the current year (daily,weekly,monthly)
-			pValuesForTheCurrentYear[numSpace].computeStatisticsForTheCurrentYear();
+			if (AncestorType::isComputed)
+			{
+				// Compute all statistics for the current year (daily,weekly,monthly)
+				pValuesForTheCurrentYear[numSpace].computeStatisticsForTheCurrentYear();
+			}
 
 			// Next variable
 			NextType::yearEnd(year, numSpace);
@@ -224,10 +230,13 @@ namespace Economy
 
 		void computeSummary(std::map<unsigned int, unsigned int> & numSpaceToYear, unsigned int nbYearsForCurrentSummary)
 		{
-			for (unsigned int numSpace = 0; numSpace < nbYearsForCurrentSummary; ++numSpace)
+			if (AncestorType::isComputed)
 			{
-				// Merge all those values with the global results
-				AncestorType::pResults.merge(numSpaceToYear[numSpace] /*year*/, pValuesForTheCurrentYear[numSpace]);
+				for (auto it = numSpaceToYear.begin(); it != numSpaceToYear.end(); ++it)
+				{
+					// Merge all those values with the global results
+					AncestorType::pResults.merge(it->second /*year*/, pValuesForTheCurrentYear[it->first]);
+				}
 			}
 			
 			// Next variable
@@ -248,12 +257,15 @@ namespace Economy
 
 		void hourForEachThermalCluster(State& state, unsigned int numSpace)
 		{
-			// Total CO2 emissions
-			// For all thermal clusters of a given area
-			// CO2 = CO2 for the thermal cluster/Mwh * production
-			pValuesForTheCurrentYear[numSpace][state.hourInTheYear] +=
-				// production for the current thermal dispatchable cluster
-				(state.cluster->co2 * state.thermalClusterProduction);
+			if (AncestorType::isComputed)
+			{
+				// Total CO2 emissions
+				// For all thermal clusters of a given area
+				// CO2 = CO2 for the thermal cluster/Mwh * production
+				pValuesForTheCurrentYear[numSpace][state.hourInTheYear] +=
+					// production for the current thermal dispatchable cluster
+					(state.cluster->co2 * state.thermalClusterProduction);
+			}
 
 			// Next item in the list
 			NextType::hourForEachThermalCluster(state, numSpace);
@@ -265,7 +277,7 @@ namespace Economy
 		}
 
 
-		Antares::Memory::Stored<double>::ConstReturnType retrieveRawHourlyValuesForCurrentYear(unsigned int, unsigned int numSpace) const
+		Antares::Memory::Stored<IntermediateValues::HourlyType>::ConstReturnType retrieveRawHourlyValuesForCurrentYear(unsigned int, unsigned int numSpace) const
 		{
 			return pValuesForTheCurrentYear[numSpace].hour;
 		}
@@ -198,7 +198,10 @@ namespace Economy
 
 		void yearBegin(unsigned int year, unsigned int numSpace)
 		{
-			pValuesForTheCurrentYear[numSpace].reset();
+			if (AncestorType::isComputed)
+			{
+				pValuesForTheCurrentYear[numSpace].reset();
+			}
 
 			// Next variable
 			NextType::yearBegin(year, numSpace);
@@ -225,8 +228,11 @@ namespace Economy
 		
 		void yearEnd(unsigned int year, unsigned int numSpace)
 		{
-			// Compute all statistics for the current year (daily,weekly,monthly)
-			pValuesForTheCurrentYear[numSpace].computeStatisticsForTheCurrentYear();
+			if (AncestorType::isComputed)
+			{
+				// Compute all statistics for the current year (daily,weekly,monthly)
+				pValuesForTheCurrentYear[numSpace].computeStatisticsForTheCurrentYear();
+			}
 
 			// Next variable
 			NextType::yearEnd(year, numSpace);
@@ -234,10 +240,13 @@ namespace Economy
 
 		void computeSummary(std::map<unsigned int, unsigned int> & numSpaceToYear, unsigned int nbYearsForCurrentSummary)
 		{
-			for (unsigned int numSpace = 0; numSpace < nbYearsForCurrentSummary; ++numSpace)
+			if (AncestorType::isComputed)
 			{
-				// Merge all those values with the global results
-				AncestorType::pResults.merge(numSpaceToYear[numSpace] /*year*/, pValuesForTheCurrentYear[numSpace]);
+				for (auto it = numSpaceToYear.begin(); it != numSpaceToYear.end(); ++it)
+				{
+					// Merge all those values with the global results
+					AncestorType::pResults.merge(it->second /*year*/, pValuesForTheCurrentYear[it->first]);
+				}
 			}
 			
 			// Next variable
@@ -252,8 +261,11 @@ namespace Economy
 
 		void hourForEachArea(State& state, unsigned int numSpace)
 		{
-			pValuesForTheCurrentYear[numSpace][state.hourInTheYear] +=
-				state.scratchpad->dispatchableGenerationMargin[state.hourInTheWeek];
+			if (AncestorType::isComputed)
+			{
+				pValuesForTheCurrentYear[numSpace][state.hourInTheYear] +=
+					state.scratchpad->dispatchableGenerationMargin[state.hourInTheWeek];
+			}
 			// Next variable
 			NextType::hourForEachArea(state, numSpace);
 		}
@@ -285,7 +297,7 @@ namespace Economy
 		}
 
 
-		Antares::Memory::Stored<double>::ConstReturnType retrieveRawHourlyValuesForCurrentYear(unsigned int, unsigned int numSpace) const
+		Antares::Memory::Stored<IntermediateValues::HourlyType>::ConstReturnType retrieveRawHourlyValuesForCurrentYear(unsigned int, unsigned int numSpace) const
 		{
 			return pValuesForTheCurrentYear[numSpace].hour;
 		}
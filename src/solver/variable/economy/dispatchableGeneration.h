@@ -216,9 +216,12 @@ namespace Economy
 
 		void yearBegin(unsigned int year, unsigned int numSpace)
 		{
-			// Reset the values for the current year
-			for (unsigned int i = 0; i != VCardType::columnCount; ++i)
-				pValuesForTheCurrentYear[numSpace][i].reset();
+			if (AncestorType::isComputed)
+			{
+				// Reset the values for the current year
+				for (unsigned int i = 0; i != VCardType::columnCount; ++i)
+					pValuesForTheCurrentYear[numSpace][i].reset();
+			}
 			// Next variable
 			NextType::yearBegin(year, numSpace);
 		}
@@ -244,8 +247,10 @@ namespace Economy
 		
 		void yearEnd(unsigned int year, unsigned int numSpace)
 		{
-
-			VariableAccessorType::template ComputeStatistics<VCardType>(pValuesForTheCurrentYear[numSpace]);
+			if (AncestorType::isComputed)
+			{
+				VariableAccessorType::template ComputeStatistics<VCardType>(pValuesForTheCurrentYear[numSpace]);
+			}
 
 			// Next variable
 			NextType::yearEnd(year, numSpace);
@@ -253,12 +258,15 @@ namespace Economy
 
 		void computeSummary(std::map<unsigned int, unsigned int> & numSpaceToYear, unsigned int nbYearsForCurrentSummary)
 		{
-			for (unsigned int numSpace = 0; numSpace < nbYearsForCurrentSummary; ++numSpace)
-				VariableAccessorType::ComputeSummary(	
-														pValuesForTheCurrentYear[numSpace], 
-														AncestorType::pResults, 
-														numSpaceToYear[numSpace]
-													);
+			if (AncestorType::isComputed)
+			{
+				for (auto it = numSpaceToYear.begin(); it != numSpaceToYear.end(); ++it)
+					VariableAccessorType::ComputeSummary(	
+															pValuesForTheCurrentYear[it->first], 
+															AncestorType::pResults, 
+															it->second
+														);
+			}
 			// Next variable
 			NextType::computeSummary(numSpaceToYear, nbYearsForCurrentSummary);
 		}
@@ -277,9 +285,12 @@ namespace Economy
 
 		void hourForEachThermalCluster(State& state, unsigned int numSpace)
 		{
-			// Adding the dispatchable generation for the class_name fuel
-			pValuesForTheCurrentYear[numSpace][state.cluster->groupID][state.hourInTheYear]
-				+= state.thermalClusterProduction;
+			if (AncestorType::isComputed)
+			{
+				// Adding the dispatchable generation for the class_name fuel
+				pValuesForTheCurrentYear[numSpace][state.cluster->groupID][state.hourInTheYear]
+					+= state.thermalClusterProduction;
+			}
 			// Next item in the list
 			NextType::hourForEachThermalCluster(state, numSpace);
 		}
@@ -290,7 +301,7 @@ namespace Economy
 		}
 
 
-		Antares::Memory::Stored<double>::ConstReturnType retrieveRawHourlyValuesForCurrentYear(unsigned int column, unsigned int numSpace) const
+		Antares::Memory::Stored<IntermediateValues::HourlyType>::ConstReturnType retrieveRawHourlyValuesForCurrentYear(unsigned int column, unsigned int numSpace) const
 		{
 			return pValuesForTheCurrentYear[numSpace][column].hour;
 		}
@@ -197,8 +197,11 @@ namespace Antares
 
 					void yearBegin(unsigned int year, unsigned int numSpace)
 					{
-						// Reset the values for the current year
-						pValuesForTheCurrentYear[numSpace].reset();
+						if (AncestorType::isComputed)
+						{
+							// Reset the values for the current year
+							pValuesForTheCurrentYear[numSpace].reset();
+						}
 						// Next variable
 						NextType::yearBegin(year, numSpace);
 					}
@@ -223,8 +226,11 @@ namespace Antares
 
 					void yearEnd(unsigned int year, unsigned int numSpace)
 					{
-						// Compute all statistics for the current year (daily,weekly,monthly)
-						pValuesForTheCurrentYear[numSpace].computeStatisticsForTheCurrentYear();
+						if (AncestorType::isComputed)
+						{
+							// Compute all statistics for the current year (daily,weekly,monthly)
+							pValuesForTheCurrentYear[numSpace].computeStatisticsForTheCurrentYear();
+						}
 
 						// Next variable
 						NextType::yearEnd(year, numSpace);
@@ -232,10 +238,13 @@ namespace Antares
 
 					void computeSummary(std::map<unsigned int, unsigned int> & numSpaceToYear, unsigned int nbYearsForCurrentSummary)
 					{
-						for (unsigned int numSpace = 0; numSpace < nbYearsForCurrentSummary; ++numSpace)
+						if (AncestorType::isComputed)
 						{
-							// Merge all those values with the global results
-							AncestorType::pResults.merge(numSpaceToYear[numSpace] /*year*/, pValuesForTheCurrentYear[numSpace]);
+							for (auto it = numSpaceToYear.begin(); it != numSpaceToYear.end(); ++it)
+							{
+								// Merge all those values with the global results
+								AncestorType::pResults.merge(it->second /*year*/, pValuesForTheCurrentYear[it->first]);
+							}
 						}
 
 						// Next variable
@@ -250,11 +259,14 @@ namespace Antares
 
 					void hourForEachArea(State& state, unsigned int numSpace)
 					{
-						// Hydro costs : storage and pumping
-						pValuesForTheCurrentYear[numSpace].hour[state.hourInTheYear] +=
-							state.hourlyResults->valeurH2oHoraire[state.hourInTheWeek]
-							*
-							(state.hourlyResults->TurbinageHoraire[state.hourInTheWeek] - pPumpRatio * state.hourlyResults->PompageHoraire[state.hourInTheWeek]);
+						if (AncestorType::isComputed)
+						{
+							// Hydro costs : storage and pumping
+							pValuesForTheCurrentYear[numSpace].hour[state.hourInTheYear] +=
+								state.hourlyResults->valeurH2oHoraire[state.hourInTheWeek]
+								*
+								(state.hourlyResults->TurbinageHoraire[state.hourInTheWeek] - pPumpRatio * state.hourlyResults->PompageHoraire[state.hourInTheWeek]);
+						}
 
 						// Next variable
 						NextType::hourForEachArea(state, numSpace);
@@ -273,7 +285,7 @@ namespace Antares
 					}
 
 
-					Antares::Memory::Stored<double>::ConstReturnType retrieveRawHourlyValuesForCurrentYear(unsigned int, unsigned int numSpace) const
+					Antares::Memory::Stored<IntermediateValues::HourlyType>::ConstReturnType retrieveRawHourlyValuesForCurrentYear(unsigned int, unsigned int numSpace) const
 					{
 						return pValuesForTheCurrentYear[numSpace].hour;
 					}
@@ -194,8 +194,11 @@ namespace Economy
 
 		void yearBegin(unsigned int year, unsigned int numSpace)
 		{
-			// Reset the values for the current year
-			pValuesForTheCurrentYear[numSpace].reset();
+			if (AncestorType::isComputed)
+			{
+				// Reset the values for the current year
+				pValuesForTheCurrentYear[numSpace].reset();
+			}
 
 			// Next variable
 			NextType::yearBegin(year, numSpace);
@@ -222,8 +225,11 @@ namespace Economy
 
 		void yearEnd(unsigned int year, unsigned int numSpace)
 		{
-			// Compute all statistics for the current year (daily, weekly, monthly, annual).
-			pValuesForTheCurrentYear[numSpace].computeStatisticsForTheCurrentYear();
+			if (AncestorType::isComputed)
+			{
+				// Compute all statistics for the current year (daily, weekly, monthly, annual).
+				pValuesForTheCurrentYear[numSpace].computeStatisticsForTheCurrentYear();
+			}
 
 			// Next variable
 			NextType::yearEnd(year, numSpace);
@@ -231,10 +237,13 @@ namespace Economy
 
 		void computeSummary(std::map<unsigned int, unsigned int> & numSpaceToYear, unsigned int nbYearsForCurrentSummary)
 		{
-			for (unsigned int numSpace = 0; numSpace < nbYearsForCurrentSummary; ++numSpace)
+			if (AncestorType::isComputed)
 			{
-				// Merge all those values with the global results
-				AncestorType::pResults.merge(numSpaceToYear[numSpace] /*year*/, pValuesForTheCurrentYear[numSpace]);
+				for (auto it = numSpaceToYear.begin(); it != numSpaceToYear.end(); ++it)
+				{
+					// Merge all those values with the global results
+					AncestorType::pResults.merge(it->second /*year*/, pValuesForTheCurrentYear[it->first]);
+				}
 			}
 
 			// Next variable
@@ -249,9 +258,12 @@ namespace Economy
 
 		void hourForEachArea(State& state, unsigned int numSpace)
 		{
-			// Retrieving the inflows
-			pValuesForTheCurrentYear[numSpace].hour[state.hourInTheYear] = 
-					state.problemeHebdo->CaracteristiquesHydrauliques[pArea->index]->ApportNaturelHoraire[state.hourInTheWeek];
+			if (AncestorType::isComputed)
+			{
+				// Retrieving the inflows
+				pValuesForTheCurrentYear[numSpace].hour[state.hourInTheYear] = 
+						state.problemeHebdo->CaracteristiquesHydrauliques[pArea->index]->ApportNaturelHoraire[state.hourInTheWeek];
+			}
 
 			// Next variable
 			NextType::hourForEachArea(state, numSpace);
@@ -269,7 +281,7 @@ namespace Economy
 			NextType::hourEnd(state, hourInTheYear);
 		}
 
-		Antares::Memory::Stored<double>::ConstReturnType retrieveRawHourlyValuesForCurrentYear(unsigned int, unsigned int numSpace) const
+		Antares::Memory::Stored<IntermediateValues::HourlyType>::ConstReturnType retrieveRawHourlyValuesForCurrentYear(unsigned int, unsigned int numSpace) const
 		{
 			return pValuesForTheCurrentYear[numSpace].hour;
 		}
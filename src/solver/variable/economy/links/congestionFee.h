@@ -182,7 +182,10 @@ namespace Economy
 
 		void yearBegin(uint year, unsigned int numSpace)
 		{
-			pValuesForTheCurrentYear[numSpace].reset();
+			if (AncestorType::isComputed)
+			{
+				pValuesForTheCurrentYear[numSpace].reset();
+			}
 			// Next variable
 			NextType::yearBegin(year, numSpace);
 		}
@@ -208,8 +211,11 @@ namespace Economy
 		
 		void yearEnd(uint year, unsigned int numSpace)
 		{
-			// Compute all statistics for the current year (daily,weekly,monthly)
-			pValuesForTheCurrentYear[numSpace].computeStatisticsForTheCurrentYear();
+			if (AncestorType::isComputed)
+			{
+				// Compute all statistics for the current year (daily,weekly,monthly)
+				pValuesForTheCurrentYear[numSpace].computeStatisticsForTheCurrentYear();
+			}
 
 			// Next variable
 			NextType::yearEnd(year, numSpace);
@@ -217,10 +223,13 @@ namespace Economy
 
 		void computeSummary(std::map<unsigned int, unsigned int> & numSpaceToYear, unsigned int nbYearsForCurrentSummary)
 		{
-			for (unsigned int numSpace = 0; numSpace < nbYearsForCurrentSummary; ++numSpace)
+			if (AncestorType::isComputed)
 			{
-				// Merge all those values with the global results
-				AncestorType::pResults.merge(numSpaceToYear[numSpace], pValuesForTheCurrentYear[numSpace]);
+				for (auto it = numSpaceToYear.begin(); it != numSpaceToYear.end(); ++it)
+				{
+					// Merge all those values with the global results
+					AncestorType::pResults.merge(it->second, pValuesForTheCurrentYear[it->first]);
+				}
 			}
 			
 			// Next variable
@@ -247,12 +256,15 @@ namespace Economy
 
 		void hourForEachLink(State& state, unsigned int numSpace)
 		{
-			# define UPSTREAM_PRICE    state.problemeHebdo->ResultatsHoraires[state.link->from->index]->CoutsMarginauxHoraires[state.hourInTheWeek]
-			# define DOWNSTREAM_PRICE  state.problemeHebdo->ResultatsHoraires[state.link->with->index]->CoutsMarginauxHoraires[state.hourInTheWeek]
+			if (AncestorType::isComputed)
+			{
+				# define UPSTREAM_PRICE    state.problemeHebdo->ResultatsHoraires[state.link->from->index]->CoutsMarginauxHoraires[state.hourInTheWeek]
+				# define DOWNSTREAM_PRICE  state.problemeHebdo->ResultatsHoraires[state.link->with->index]->CoutsMarginauxHoraires[state.hourInTheWeek]
 
-			// Congestion Fee
-			pValuesForTheCurrentYear[numSpace].hour[state.hourInTheYear] =
-				state.ntc->ValeurDuFlux[state.link->index] * (UPSTREAM_PRICE - DOWNSTREAM_PRICE);
+				// Congestion Fee
+				pValuesForTheCurrentYear[numSpace].hour[state.hourInTheYear] =
+					state.ntc->ValeurDuFlux[state.link->index] * (UPSTREAM_PRICE - DOWNSTREAM_PRICE);
+			}
 			// Next item in the list
 			NextType::hourForEachLink(state, numSpace);
 
@@ -272,7 +284,7 @@ namespace Economy
 			NextType::buildDigest(results, digestLevel, dataLevel);
 		}
 
-		Antares::Memory::Stored<double>::ConstReturnType retrieveRawHourlyValuesForCurrentYear(uint, uint numSpace) const
+		Antares::Memory::Stored<IntermediateValues::HourlyType>::ConstReturnType retrieveRawHourlyValuesForCurrentYear(uint, uint numSpace) const
 		{
 			return pValuesForTheCurrentYear[numSpace].hour;
 		}
@@ -182,8 +182,11 @@ namespace Economy
 
 		void yearBegin(uint year, unsigned int numSpace)
 		{
-			// Reset
-			pValuesForTheCurrentYear[numSpace].reset();
+			if (AncestorType::isComputed)
+			{
+				// Reset
+				pValuesForTheCurrentYear[numSpace].reset();
+			}
 			// Next variable
 			NextType::yearBegin(year, numSpace);
 		}
@@ -209,8 +212,11 @@ namespace Economy
 		
 		void yearEnd(unsigned int year, unsigned int numSpace)
 		{
-			// Compute all statistics for the current year (daily,weekly,monthly)
-			pValuesForTheCurrentYear[numSpace].computeStatisticsForTheCurrentYear();
+			if (AncestorType::isComputed)
+			{
+				// Compute all statistics for the current year (daily,weekly,monthly)
+				pValuesForTheCurrentYear[numSpace].computeStatisticsForTheCurrentYear();
+			}
 
 			// Next variable
 			NextType::yearEnd(year, numSpace);
@@ -218,10 +224,13 @@ namespace Economy
 
 		void computeSummary(std::map<unsigned int, unsigned int> & numSpaceToYear, unsigned int nbYearsForCurrentSummary)
 		{
-			for (unsigned int numSpace = 0; numSpace < nbYearsForCurrentSummary; ++numSpace)
+			if (AncestorType::isComputed)
 			{
-				// Merge all those values with the global results
-				AncestorType::pResults.merge(numSpaceToYear[numSpace], pValuesForTheCurrentYear[numSpace]);
+				for (auto it = numSpaceToYear.begin(); it != numSpaceToYear.end(); ++it)
+				{
+					// Merge all those values with the global results
+					AncestorType::pResults.merge(it->second, pValuesForTheCurrentYear[it->first]);
+				}
 			}
 			
 			// Next variable
@@ -248,12 +257,15 @@ namespace Economy
 
 		void hourForEachLink(State& state, unsigned int numSpace)
 		{
-			# define UPSTREAM_PRICE    state.problemeHebdo->ResultatsHoraires[state.link->from->index]->CoutsMarginauxHoraires[state.hourInTheWeek]
-			# define DOWNSTREAM_PRICE  state.problemeHebdo->ResultatsHoraires[state.link->with->index]->CoutsMarginauxHoraires[state.hourInTheWeek]
+			if (AncestorType::isComputed)
+			{
+				# define UPSTREAM_PRICE    state.problemeHebdo->ResultatsHoraires[state.link->from->index]->CoutsMarginauxHoraires[state.hourInTheWeek]
+				# define DOWNSTREAM_PRICE  state.problemeHebdo->ResultatsHoraires[state.link->with->index]->CoutsMarginauxHoraires[state.hourInTheWeek]
 
-			// Congestion Fee
-			pValuesForTheCurrentYear[numSpace].hour[state.hourInTheYear] =
-				Yuni::Math::Abs(state.ntc->ValeurDuFlux[state.link->index] * (UPSTREAM_PRICE - DOWNSTREAM_PRICE));
+				// Congestion Fee
+				pValuesForTheCurrentYear[numSpace].hour[state.hourInTheYear] =
+					Yuni::Math::Abs(state.ntc->ValeurDuFlux[state.link->index] * (UPSTREAM_PRICE - DOWNSTREAM_PRICE));
+			}
 			// Next item in the list
 			NextType::hourForEachLink(state, numSpace);
 
@@ -273,7 +285,7 @@ namespace Economy
 			NextType::buildDigest(results, digestLevel, dataLevel);
 		}
 
-		Antares::Memory::Stored<double>::ConstReturnType retrieveRawHourlyValuesForCurrentYear(uint, uint numSpace) const
+		Antares::Memory::Stored<IntermediateValues::HourlyType>::ConstReturnType retrieveRawHourlyValuesForCurrentYear(uint, uint numSpace) const
 		{
 			return pValuesForTheCurrentYear[numSpace].hour;
 		}
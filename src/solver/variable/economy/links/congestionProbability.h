@@ -210,12 +210,15 @@ namespace Economy
 
 		void yearBegin(uint year, unsigned int numSpace)
 		{
-			// Reset
-			pValuesForTheCurrentYear[numSpace][0].reset();
-			pValuesForTheCurrentYear[numSpace][1].reset();
+			if (AncestorType::isComputed)
+			{
+				// Reset
+				pValuesForTheCurrentYear[numSpace][0].reset();
+				pValuesForTheCurrentYear[numSpace][1].reset();
 
-			pValuesForYearLocalReport[numSpace][0].reset();
-			pValuesForYearLocalReport[numSpace][1].reset();	
+				pValuesForYearLocalReport[numSpace][0].reset();
+				pValuesForYearLocalReport[numSpace][1].reset();	
+			}
 
 			// Next variable
 			NextType::yearBegin(year, numSpace);
@@ -243,10 +246,13 @@ namespace Economy
 
 		void yearEnd(uint year, uint numSpace)
 		{
-			for (uint i = 0; i != VCardType::columnCount; ++i)
+			if (AncestorType::isComputed)
 			{
-				// Compute all statistics for the current year (daily,weekly,monthly)
-				pValuesForTheCurrentYear[numSpace][i].computeProbabilitiesForTheCurrentYear();
+				for (uint i = 0; i != VCardType::columnCount; ++i)
+				{
+					// Compute all statistics for the current year (daily,weekly,monthly)
+					pValuesForTheCurrentYear[numSpace][i].computeProbabilitiesForTheCurrentYear();
+				}
 			}
 
 			// Next variable
@@ -255,12 +261,15 @@ namespace Economy
 
 		void computeSummary(std::map<unsigned int, unsigned int> & numSpaceToYear, unsigned int nbYearsForCurrentSummary)
 		{
-			for (unsigned int numSpace = 0; numSpace < nbYearsForCurrentSummary; ++numSpace)
+			if (AncestorType::isComputed)
 			{
-				for (uint i = 0; i != VCardType::columnCount; ++i)
+				for (auto it = numSpaceToYear.begin(); it != numSpaceToYear.end(); ++it)
 				{
-					// Merge all those values with the global results
-					AncestorType::pResults[i].merge(numSpaceToYear[numSpace], pValuesForTheCurrentYear[numSpace][i]);
+					for (uint i = 0; i != VCardType::columnCount; ++i)
+					{
+						// Merge all those values with the global results
+						AncestorType::pResults[i].merge(it->second, pValuesForTheCurrentYear[it->first][i]);
+					}
 				}
 			}
 
@@ -288,14 +297,17 @@ namespace Economy
 
 		void hourForEachLink(State& state, unsigned int numSpace)
 		{
-			assert(state.link != NULL);
-			auto& linkdata = state.link->data;
-			// CONG. PROB +
-			if (state.ntc->ValeurDuFlux[state.link->index] > + linkdata.entry[Data::fhlNTCDirect][state.hourInTheYear] - 10e-6)
-				pValuesForTheCurrentYear[numSpace][0].hour[state.hourInTheYear] += pRatio;
-			// CONG. PROB -
-			if (state.ntc->ValeurDuFlux[state.link->index] < - linkdata.entry[Data::fhlNTCIndirect][state.hourInTheYear] + 10e-6)
-				pValuesForTheCurrentYear[numSpace][1].hour[state.hourInTheYear] += pRatio;
+			if (AncestorType::isComputed)
+			{
+				assert(state.link != NULL);
+				auto& linkdata = state.link->data;
+				// CONG. PROB +
+				if (state.ntc->ValeurDuFlux[state.link->index] > + linkdata.entry[Data::fhlNTCDirect][state.hourInTheYear] - 10e-6)
+					pValuesForTheCurrentYear[numSpace][0].hour[state.hourInTheYear] += pRatio;
+				// CONG. PROB -
+				if (state.ntc->ValeurDuFlux[state.link->index] < - linkdata.entry[Data::fhlNTCIndirect][state.hourInTheYear] + 10e-6)
+					pValuesForTheCurrentYear[numSpace][1].hour[state.hourInTheYear] += pRatio;
+			}
 
 			// Next item in the list
 			NextType::hourForEachLink(state, numSpace);
@@ -329,7 +341,7 @@ namespace Economy
 
 		}
 
-		Antares::Memory::Stored<double>::ConstReturnType retrieveRawHourlyValuesForCurrentYear(uint column, uint numSpace) const
+		Antares::Memory::Stored<IntermediateValues::HourlyType>::ConstReturnType retrieveRawHourlyValuesForCurrentYear(uint column, uint numSpace) const
 		{
 			return pValuesForTheCurrentYear[numSpace][column].hour;
 		}
@@ -185,8 +185,11 @@ namespace Economy
 
 		void yearBegin(uint year, unsigned int numSpace)
 		{
-			// Reset
-			pValuesForTheCurrentYear[numSpace].reset();
+			if (AncestorType::isComputed)
+			{
+				// Reset
+				pValuesForTheCurrentYear[numSpace].reset();
+			}
 			// Next variable
 			NextType::yearBegin(year, numSpace);
 		}
@@ -212,8 +215,11 @@ namespace Economy
 
 		void yearEnd(unsigned int year, unsigned int numSpace)
 		{
-			// Compute all statistics for the current year (daily,weekly,monthly)
-			pValuesForTheCurrentYear[numSpace].computeStatisticsForTheCurrentYear();
+			if (AncestorType::isComputed)
+			{
+				// Compute all statistics for the current year (daily,weekly,monthly)
+				pValuesForTheCurrentYear[numSpace].computeStatisticsForTheCurrentYear();
+			}
 
 			// Next variable
 			NextType::yearEnd(year, numSpace);
@@ -221,10 +227,13 @@ namespace Economy
 
 		void computeSummary(std::map<unsigned int, unsigned int> & numSpaceToYear, unsigned int nbYearsForCurrentSummary)
 		{
-			for (unsigned int numSpace = 0; numSpace < nbYearsForCurrentSummary; ++numSpace)
+			if (AncestorType::isComputed)
 			{
-				// Merge all those values with the global results
-				AncestorType::pResults.merge(numSpaceToYear[numSpace], pValuesForTheCurrentYear[numSpace]);
+				for (auto it = numSpaceToYear.begin(); it != numSpaceToYear.end(); ++it)
+				{
+					// Merge all those values with the global results
+					AncestorType::pResults.merge(it->second, pValuesForTheCurrentYear[it->first]);
+				}
 			}
 			
 			// Next variable
@@ -251,9 +260,12 @@ namespace Economy
 
 		void hourForEachLink(State& state, unsigned int numSpace)
 		{
-			// Flow assessed over all MC years (linear)
-			pValuesForTheCurrentYear[numSpace].hour[state.hourInTheYear]
-				+= Yuni::Math::Abs(state.ntc->ValeurDuFlux[state.link->index]);
+			if (AncestorType::isComputed)
+			{
+				// Flow assessed over all MC years (linear)
+				pValuesForTheCurrentYear[numSpace].hour[state.hourInTheYear]
+					+= Yuni::Math::Abs(state.ntc->ValeurDuFlux[state.link->index]);
+			}
 			// Next item in the list
 			NextType::hourForEachLink(state, numSpace);
 		}
@@ -270,7 +282,7 @@ namespace Economy
 			NextType::buildDigest(results, digestLevel, dataLevel);
 		}
 
-		Antares::Memory::Stored<double>::ConstReturnType retrieveRawHourlyValuesForCurrentYear(uint, uint numSpace) const
+		Antares::Memory::Stored<IntermediateValues::HourlyType>::ConstReturnType retrieveRawHourlyValuesForCurrentYear(uint, uint numSpace) const
 		{
 			return pValuesForTheCurrentYear[numSpace].hour;
 		}
@@ -168,14 +168,17 @@ namespace Economy
 
 		void simulationEnd()
 		{
-			// Flow assessed over all MC years (linear)
-			(void)::memcpy(pValuesForTheCurrentYear.hour, ResultatsParInterconnexion[pLinkGlobalIndex]->TransitMoyenRecalculQuadratique,
-				sizeof(double) * pNbHours);
-
-			// Compute all statistics for the current year (daily,weekly,monthly)
-			pValuesForTheCurrentYear.computeStatisticsForTheCurrentYear();
-			// Merge all those values with the global results
-			AncestorType::pResults.merge(0, pValuesForTheCurrentYear);
+			if (AncestorType::isComputed)
+			{
+				// Flow assessed over all MC years (linear)
+				pValuesForTheCurrentYear.copyHourlyValues(ResultatsParInterconnexion[pLinkGlobalIndex]->TransitMoyenRecalculQuadratique,
+					pNbHours);
+
+				// Compute all statistics for the current year (daily,weekly,monthly)
+				pValuesForTheCurrentYear.computeStatisticsForTheCurrentYear();
+				// Merge all those values with the global results
+				AncestorType::pResults.merge(0, pValuesForTheCurrentYear);
+			}
 
 			// Next
 			NextType::simulationEnd();
@@ -265,7 +268,7 @@ namespace Economy
 			NextType::buildDigest(results, digestLevel, dataLevel);
 		}
 
-		Antares::Memory::Stored<double>::ConstReturnType retrieveRawHourlyValuesForCurrentYear(uint, uint) const
+		Antares::Memory::Stored<IntermediateValues::HourlyType>::ConstReturnType retrieveRawHourlyValuesForCurrentYear(uint, uint) const
 		{
 			return pValuesForTheCurrentYear.hour;
 		}
@@ -160,7 +160,7 @@ namespace Antares
 						{
 							// Flow assessed over all MC years (linear)
 							unsigned int height = link->data.height;
-							(void)::memcpy(pValuesForTheCurrentYear.hour, link->data[Data::fhlLoopFlow], sizeof(double) * height);
+							pValuesForTheCurrentYear.copyHourlyValues(link->data[Data::fhlLoopFlow], height);
 						}
 						
 						// Next
@@ -181,10 +181,13 @@ namespace Antares
 
 					void simulationEnd()
 					{
-						// Compute all statistics for the current year (daily,weekly,monthly)
-						pValuesForTheCurrentYear.computeStatisticsForTheCurrentYear();
-						// Merge all those values with the global results
-						AncestorType::pResults.merge(0, pValuesForTheCurrentYear);
+						if (AncestorType::isComputed)
+						{
+							// Compute all statistics for the current year (daily,weekly,monthly)
+							pValuesForTheCurrentYear.computeStatisticsForTheCurrentYear();
+							// Merge all those values with the global results
+							AncestorType::pResults.merge(0, pValuesForTheCurrentYear);
+						}
 
 						// Next
 						NextType::simulationEnd();
@@ -264,7 +267,7 @@ namespace Antares
 						NextType::buildDigest(results, digestLevel, dataLevel);
 					}
 
-					Antares::Memory::Stored<double>::ConstReturnType retrieveRawHourlyValuesForCurrentYear(uint, uint) const
+					Antares::Memory::Stored<IntermediateValues::HourlyType>::ConstReturnType retrieveRawHourlyValuesForCurrentYear(uint, uint) const
 					{
 						return pValuesForTheCurrentYear.hour;
 					}
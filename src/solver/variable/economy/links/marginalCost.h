@@ -182,8 +182,11 @@ namespace Economy
 
 		void yearBegin(uint year, unsigned int numSpace)
 		{
-			// Reset
-			pValuesForTheCurrentYear[numSpace].reset();
+			if (AncestorType::isComputed)
+			{
+				// Reset
+				pValuesForTheCurrentYear[numSpace].reset();
+			}
 			// Next variable
 			NextType::yearBegin(year, numSpace);
 		}
@@ -209,8 +212,11 @@ namespace Economy
 		
 		void yearEnd(unsigned int year, unsigned int numSpace)
 		{
-			// Compute all statistics for the current year (daily,weekly,monthly)
-			pValuesForTheCurrentYear[numSpace].computeStatisticsForTheCurrentYear();
+			if (AncestorType::isComputed)
+			{
+				// Compute all statistics for the current year (daily,weekly,monthly)
+				pValuesForTheCurrentYear[numSpace].computeStatisticsForTheCurrentYear();
+			}
 
 			// Next variable
 			NextType::yearEnd(year, numSpace);
@@ -218,10 +224,13 @@ namespace Economy
 
 		void computeSummary(std::map<unsigned int, unsigned int> & numSpaceToYear, unsigned int nbYearsForCurrentSummary)
 		{
-			for (unsigned int numSpace = 0; numSpace < nbYearsForCurrentSummary; ++numSpace)
+			if (AncestorType::isComputed)
 			{
-				// Merge all those values with the global results
-				AncestorType::pResults.merge(numSpaceToYear[numSpace], pValuesForTheCurrentYear[numSpace]);
+				for (auto it = numSpaceToYear.begin(); it != numSpaceToYear.end(); ++it)
+				{
+					// Merge all those values with the global results
+					AncestorType::pResults.merge(it->second, pValuesForTheCurrentYear[it->first]);
+				}
 			}
 			
 			// Next variable
@@ -248,16 +257,19 @@ namespace Economy
 
 		void hourForEachLink(State& state, unsigned int numSpace)
 		{
-			pValuesForTheCurrentYear[numSpace][state.hourInTheYear] =
-				Yuni::Math::Abs(state.problemeHebdo->VariablesDualesDesContraintesDeNTC[state.hourInTheWeek]->VariableDualeParInterconnexion[state.link->index]);
+			if (AncestorType::isComputed)
+			{
+				pValuesForTheCurrentYear[numSpace][state.hourInTheYear] =
+					Yuni::Math::Abs(state.problemeHebdo->VariablesDualesDesContraintesDeNTC[state.hourInTheWeek]->VariableDualeParInterconnexion[state.link->index]);
 
-			// This value should be reset to zero if  (flow_lowerbound) < flow < (flow_upperbound)  (with signed values)
-			double flow = state.problemeHebdo->ValeursDeNTC[state.hourInTheWeek]->ValeurDuFlux[state.link->index];
-			double flow_lowerbound = -state.problemeHebdo->ValeursDeNTC[state.hourInTheWeek]->ValeurDeNTCExtremiteVersOrigine[state.link->index];
-			double flow_upperbound = state.problemeHebdo->ValeursDeNTC[state.hourInTheWeek]->ValeurDeNTCOrigineVersExtremite[state.link->index];
+				// This value should be reset to zero if  (flow_lowerbound) < flow < (flow_upperbound)  (with signed values)
+				double flow = state.problemeHebdo->ValeursDeNTC[state.hourInTheWeek]->ValeurDuFlux[state.link->index];
+				double flow_lowerbound = -state.problemeHebdo->ValeursDeNTC[state.hourInTheWeek]->ValeurDeNTCExtremiteVersOrigine[state.link->index];
+				double flow_upperbound = state.problemeHebdo->ValeursDeNTC[state.hourInTheWeek]->ValeurDeNTCOrigineVersExtremite[state.link->index];
 
-			if (flow - 0.001 > flow_lowerbound && flow + 0.001 < flow_upperbound)
-				pValuesForTheCurrentYear[numSpace][state.hourInTheYear] = 0.;
+				if (flow - 0.001 > flow_lowerbound && flow + 0.001 < flow_upperbound)
+					pValuesForTheCurrentYear[numSpace][state.hourInTheYear] = 0.;
+			}
 		
 			// Next item in the list
 			NextType::hourForEachLink(state, numSpace);
@@ -275,7 +287,7 @@ namespace Economy
 			NextType:: buildDigest(results, digestLevel, dataLevel);
 		}
 
-		Antares::Memory::Stored<double>::ConstReturnType retrieveRawHourlyValuesForCurrentYear(uint, uint numSpace) const
+		Antares::Memory::Stored<IntermediateValues::HourlyType>::ConstReturnType retrieveRawHourlyValuesForCurrentYear(uint, uint numSpace) const
 		{
 			return pValuesForTheCurrentYear[numSpace].hour;
 		}
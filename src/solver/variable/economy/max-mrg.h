@@ -200,8 +200,11 @@ namespace Economy
 
 		void yearBegin(unsigned int year, unsigned int numSpace)
 		{
-			// Reset the values for the current year
-			pValuesForTheCurrentYear[numSpace].reset();
+			if (AncestorType::isComputed)
+			{
+				// Reset the values for the current year
+				pValuesForTheCurrentYear[numSpace].reset();
+			}
 			// Next variable
 			NextType::yearBegin(year, numSpace);
 		}
@@ -227,8 +230,11 @@ namespace Economy
 		
 		void yearEnd(unsigned int year, unsigned int numSpace)
 		{
-			// Compute all statistics for the current year (daily,weekly,monthly)
-			pValuesForTheCurrentYear[numSpace].computeStatisticsForTheCurrentYear();
+			if (AncestorType::isComputed)
+			{
+				// Compute all statistics for the current year (daily,weekly,monthly)
+				pValuesForTheCurrentYear[numSpace].computeStatisticsForTheCurrentYear();
+			}
 			// Merge all those values with the global results
 			// AncestorType::pResults.merge(year, pValuesForTheCurrentYear);
 
@@ -238,10 +244,13 @@ namespace Economy
 
 		void computeSummary(std::map<unsigned int, unsigned int> & numSpaceToYear, unsigned int nbYearsForCurrentSummary)
 		{
-			for (unsigned int numSpace = 0; numSpace < nbYearsForCurrentSummary; ++numSpace)
+			if (AncestorType::isComputed)
 			{
-				// Merge all those values with the global results
-				AncestorType::pResults.merge(numSpaceToYear[numSpace] /*year*/, pValuesForTheCurrentYear[numSpace]);
+				for (auto it = numSpaceToYear.begin(); it != numSpaceToYear.end(); ++it)
+				{
+					// Merge all those values with the global results
+					AncestorType::pResults.merge(it->second /*year*/, pValuesForTheCurrentYear[it->first]);
+				}
 			}
 			
 			// Next variable
@@ -274,16 +283,28 @@ namespace Economy
 
 		void weekForEachArea(State& state, unsigned int numSpace)
 		{
+			if (AncestorType::isComputed)
 			{
+				# ifdef ANTARES_COMPACT_INTERMEDIATE_VALUES
+				// The values of the week are computed in double precision
+				auto& hourly = pValuesForTheCurrentYear[numSpace].hour;
+				double opmrg[168];
+				for (uint i = 0; i != 168; ++i)
+					opmrg[i] = hourly[state.hourInTheYear + i];
+				PrepareMaxMRG(state, opmrg, numSpace);
+				for (uint i = 0; i != 168; ++i)
+					hourly[state.hourInTheYear + i] = (IntermediateValues::HourlyType) opmrg[i];
+				# else
 				double* rawhourly = Memory::RawPointer(pValuesForTheCurrentYear[numSpace].hour);
 				PrepareMaxMRG(state, rawhourly + state.hourInTheYear, numSpace);
+				# endif
 			}
 			// next
 			NextType::weekForEachArea(state, numSpace);
 		}
 
 
-		Antares::Memory::Stored<double>::ConstReturnType retrieveRawHourlyValuesForCurrentYear(unsigned int, unsigned int numSpace) const
+		Antares::Memory::Stored<IntermediateValues::HourlyType>::ConstReturnType retrieveRawHourlyValuesForCurrentYear(unsigned int, unsigned int numSpace) const
 		{
 			return pValuesForTheCurrentYear[numSpace].hour;
 		}
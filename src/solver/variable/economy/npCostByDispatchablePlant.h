@@ -248,9 +248,12 @@ namespace Economy
 
 		void yearBegin(unsigned int year, unsigned int numSpace)
 		{
-			// Reset the values for the current year
-			for (unsigned int i = 0; i != pSize; ++i)
-				pValuesForTheCurrentYear[numSpace][i].reset();
+			if (AncestorType::isComputed)
+			{
+				// Reset the values for the current year
+				for (unsigned int i = 0; i != pSize; ++i)
+					pValuesForTheCurrentYear[numSpace][i].reset();
+			}
 
 			// Next variable
 			NextType::yearBegin(year, numSpace);
@@ -264,10 +267,13 @@ namespace Economy
 
 		void yearEndBuildForEachThermalCluster(State& state, uint year, unsigned int numSpace)
 		{
-			// Get end year calculations
-			for (unsigned int i = state.study.runtime->rangeLimits.hour[Data::rangeBegin]; i <= state.study.runtime->rangeLimits.hour[Data::rangeEnd]; ++i)
+			if (AncestorType::isComputed)
 			{
-				 pValuesForTheCurrentYear[numSpace][state.cluster->areaWideIndex].hour[i] = state.thermalClusterNonProportionalCostForYear[i];
+				// Get end year calculations
+				for (unsigned int i = state.study.runtime->rangeLimits.hour[Data::rangeBegin]; i <= state.study.runtime->rangeLimits.hour[Data::rangeEnd]; ++i)
+				{
+					 pValuesForTheCurrentYear[numSpace][state.cluster->areaWideIndex].hour[i] = state.thermalClusterNonProportionalCostForYear[i];
+				}
 			}
 
 			// Next variable
@@ -282,21 +288,24 @@ namespace Economy
 
 		void yearEnd(unsigned int year, unsigned int numSpace)
 		{
-			// Merge all results for all thermal clusters
+			if (AncestorType::isComputed)
 			{
-				// to automatically flush the memory from times to times
-				unsigned int autoflush = 5;
-
-				for (unsigned int i = 0; i < pSize; ++i)
+				// Merge all results for all thermal clusters
 				{
-					// Compute all statistics for the current year (daily,weekly,monthly)
-					pValuesForTheCurrentYear[numSpace][i].computeStatisticsForTheCurrentYear();
+					// to automatically flush the memory from times to times
+					unsigned int autoflush = 5;
 
-					if (!--autoflush)
+					for (unsigned int i = 0; i < pSize; ++i)
 					{
-						autoflush = 5;
-						if (Antares::Memory::swapSupport)
-							Antares::memory.flushAll();
+						// Compute all statistics for the current year (daily,weekly,monthly)
+						pValuesForTheCurrentYear[numSpace][i].computeStatisticsForTheCurrentYear();
+
+						if (!--autoflush)
+						{
+							autoflush = 5;
+							if (Antares::Memory::swapSupport)
+								Antares::memory.flushAll();
+						}
 					}
 				}
 			}
@@ -306,12 +315,15 @@ namespace Economy
 
 		void computeSummary(std::map<unsigned int, unsigned int> & numSpaceToYear, unsigned int nbYearsForCurrentSummary)
 		{
-			for (unsigned int numSpace = 0; numSpace < nbYearsForCurrentSummary; ++numSpace)
+			if (AncestorType::isComputed)
 			{
-				for (unsigned int i = 0; i < pSize; ++i)
+				for (auto it = numSpaceToYear.begin(); it != numSpaceToYear.end(); ++it)
 				{
-					// Merge all those values with the global results
-					AncestorType::pResults[i].merge(numSpaceToYear[numSpace], pValuesForTheCurrentYear[numSpace][i]);
+					for (unsigned int i = 0; i < pSize; ++i)
+					{
+						// Merge all those values with the global results
+						AncestorType::pResults[i].merge(it->second, pValuesForTheCurrentYear[it->first][i]);
+					}
 				}
 			}
 			
@@ -350,7 +362,7 @@ namespace Economy
 		}
 
 
-		Antares::Memory::Stored<double>::ConstReturnType retrieveRawHourlyValuesForCurrentYear(unsigned int, unsigned int numSpace) const
+		Antares::Memory::Stored<IntermediateValues::HourlyType>::ConstReturnType retrieveRawHourlyValuesForCurrentYear(unsigned int, unsigned int numSpace) const
 		{
 			return pValuesForTheCurrentYear[numSpace]->hour;
 		}
@@ -195,8 +195,11 @@ namespace Economy
 
 		void yearBegin(unsigned int year, unsigned int numSpace)
 		{
-			// Reset the values for the current year
-			pValuesForTheCurrentYear[numSpace].reset();
+			if (AncestorType::isComputed)
+			{
+				// Reset the values for the current year
+				pValuesForTheCurrentYear[numSpace].reset();
+			}
 			// Next variable
 			NextType::yearBegin(year, numSpace);
 		}
@@ -209,10 +212,13 @@ namespace Economy
 
 		void yearEndBuildForEachThermalCluster(State& state, uint year, unsigned int numSpace)
 		{
-			// Get end year calculations
-			for (unsigned int i = state.study.runtime->rangeLimits.hour[Data::rangeBegin]; i <= state.study.runtime->rangeLimits.hour[Data::rangeEnd]; ++i)
+			if (AncestorType::isComputed)
 			{
-				 pValuesForTheCurrentYear[numSpace][i] += state.thermalClusterOperatingCostForYear[i];
+				// Get end year calculations
+				for (unsigned int i = state.study.runtime->rangeLimits.hour[Data::rangeBegin]; i <= state.study.runtime->rangeLimits.hour[Data::rangeEnd]; ++i)
+				{
+					 pValuesForTheCurrentYear[numSpace][i] += state.thermalClusterOperatingCostForYear[i];
+				}
 			}
 
 			// Next variable
@@ -227,8 +233,11 @@ namespace Economy
 
 		void yearEnd(unsigned int year, unsigned int numSpace)
 		{
-			// Compute all statistics for the current year (daily,weekly,monthly)
-			pValuesForTheCurrentYear[numSpace].computeStatisticsForTheCurrentYear();
+			if (AncestorType::isComputed)
+			{
+				// Compute all statistics for the current year (daily,weekly,monthly)
+				pValuesForTheCurrentYear[numSpace].computeStatisticsForTheCurrentYear();
+			}
 
 			// Next variable
 			NextType::yearEnd(year, numSpace);
@@ -236,10 +245,13 @@ namespace Economy
 
 		void computeSummary(std::map<unsigned int, unsigned int> & numSpaceToYear, unsigned int nbYearsForCurrentSummary)
 		{
-			for (unsigned int numSpace = 0; numSpace < nbYearsForCurrentSummary; ++numSpace)
+			if (AncestorType::isComputed)
 			{
-				// Merge all those values with the global results
-				AncestorType::pResults.merge(numSpaceToYear[numSpace] /*year*/, pValuesForTheCurrentYear[numSpace]);
+				for (auto it = numSpaceToYear.begin(); it != numSpaceToYear.end(); ++it)
+				{
+					// Merge all those values with the global results
+					AncestorType::pResults.merge(it->second /*year*/, pValuesForTheCurrentYear[it->first]);
+				}
 			}
 			
 			// Next variable
@@ -273,7 +285,7 @@ namespace Economy
 		}
 
 
-		Antares::Memory::Stored<double>::ConstReturnType retrieveRawHourlyValuesForCurrentYear(unsigned int, unsigned int numSpace) const
+		Antares::Memory::Stored<IntermediateValues::HourlyType>::ConstReturnType retrieveRawHourlyValuesForCurrentYear(unsigned int, unsigned int numSpace) const
 		{
 			return pValuesForTheCurrentYear[numSpace].hour;
 		}
@@ -327,12 +327,12 @@ namespace Economy
 
 		void computeSummary(std::map<unsigned int, unsigned int> & numSpaceToYear, unsigned int nbYearsForCurrentSummary)
 		{
-			for (unsigned int numSpace = 0; numSpace < nbYearsForCurrentSummary; ++numSpace)
+			for (auto it = numSpaceToYear.begin(); it != numSpaceToYear.end(); ++it)
 			{
 				for (unsigned int i = 0; i < pSize; ++i)
 				{
 					// Merge all those values with the global results
-					AncestorType::pResults[i].merge(numSpaceToYear[numSpace], pValuesForTheCurrentYear[numSpace][i]);
+					AncestorType::pResults[i].merge(it->second, pValuesForTheCurrentYear[it->first][i]);
 				}
 			}
 			
@@ -380,7 +380,7 @@ namespace Economy
 			NextType::buildDigest(results, digestLevel, dataLevel);
 		}
 
-		Antares::Memory::Stored<double>::ConstReturnType retrieveRawHourlyValuesForCurrentYear(unsigned int column, unsigned int numSpace) const
+		Antares::Memory::Stored<IntermediateValues::HourlyType>::ConstReturnType retrieveRawHourlyValuesForCurrentYear(unsigned int column, unsigned int numSpace) const
 		{
 			return pValuesForTheCurrentYear[numSpace][column].hour;
 		}
@@ -192,8 +192,11 @@ namespace Antares
 
 					void yearBegin(unsigned int year, unsigned int numSpace)
 					{
-						// Reset the values for the current year
-						pValuesForTheCurrentYear[numSpace].reset();
+						if (AncestorType::isComputed)
+						{
+							// Reset the values for the current year
+							pValuesForTheCurrentYear[numSpace].reset();
+						}
 
 						// Next variable
 						NextType::yearBegin(year, numSpace);
@@ -220,8 +223,11 @@ namespace Antares
 
 					void yearEnd(unsigned int year, unsigned int numSpace)
 					{
-						// Compute all statistics for the current year (daily, weekly, monthly, annual).
-						pValuesForTheCurrentYear[numSpace].computeAVGstatisticsForCurrentYear();
+						if (AncestorType::isComputed)
+						{
+							// Compute all statistics for the current year (daily, weekly, monthly, annual).
+							pValuesForTheCurrentYear[numSpace].computeAVGstatisticsForCurrentYear();
+						}
 
 						// Next variable
 						NextType::yearEnd(year, numSpace);
@@ -229,10 +235,13 @@ namespace Antares
 
 					void computeSummary(std::map<unsigned int, unsigned int> & numSpaceToYear, unsigned int nbYearsForCurrentSummary)
 					{
-						for (unsigned int numSpace = 0; numSpace < nbYearsForCurrentSummary; ++numSpace)
+						if (AncestorType::isComputed)
 						{
-							// Merge all those values with the global results
-							AncestorType::pResults.merge(numSpaceToYear[numSpace] /*year*/, pValuesForTheCurrentYear[numSpace]);
+							for (auto it = numSpaceToYear.begin(); it != numSpaceToYear.end(); ++it)
+							{
+								// Merge all those values with the global results
+								AncestorType::pResults.merge(it->second /*year*/, pValuesForTheCurrentYear[it->first]);
+							}
 						}
 
 						// Next variable
@@ -247,8 +256,11 @@ namespace Antares
 
 					void hourForEachArea(State& state, unsigned int numSpace)
 					{
-						// Retrieving hourly reservoir levels of week simulation
-						pValuesForTheCurrentYear[numSpace].hour[state.hourInTheYear] = state.hourlyResults->niveauxHoraires[state.hourInTheWeek];
+						if (AncestorType::isComputed)
+						{
+							// Retrieving hourly reservoir levels of week simulation
+							pValuesForTheCurrentYear[numSpace].hour[state.hourInTheYear] = state.hourlyResults->niveauxHoraires[state.hourInTheWeek];
+						}
 
 						// Next variable
 						NextType::hourForEachArea(state, numSpace);
@@ -266,7 +278,7 @@ namespace Antares
 						NextType::hourEnd(state, hourInTheYear);
 					}
 
-					Antares::Memory::Stored<double>::ConstReturnType retrieveRawHourlyValuesForCurrentYear(unsigned int, unsigned int numSpace) const
+					Antares::Memory::Stored<IntermediateValues::HourlyType>::ConstReturnType retrieveRawHourlyValuesForCurrentYear(unsigned int, unsigned int numSpace) const
 					{
 						return pValuesForTheCurrentYear[numSpace].hour;
 					}
@@ -80,7 +80,7 @@ namespace Variable
 			assert(!Yuni::Math::NaN(v));
 			for (uint i = 0; i != ColumnCountT; ++i)
 			{
-				Antares::Memory::Stored<double>::ReturnType array = intermediateValues[i].hour;
+				auto& array = intermediateValues[i].hour;
 				for (uint y = 0; y != maxHoursInAYear; ++y)
 					array[y] *= v;
 			}
@@ -91,7 +91,7 @@ namespace Variable
 		{
 			for (uint i = 0; i != ColumnCountT; ++i)
 			{
-				Antares::Memory::Stored<double>::ReturnType array = intermediateValues[i].hour;
+				auto& array = intermediateValues[i].hour;
 				for (uint y = 0; y != maxHoursInAYear; ++y)
 				{
 					array[y] = Yuni::Math::Abs(array[y]) > 0. ? 1. : 0.;
@@ -105,7 +105,7 @@ namespace Variable
 		{
 			for (uint i = 0; i != ColumnCountT; ++i)
 			{
-				Antares::Memory::Stored<double>::ReturnType array = intermediateValues[i].hour;
+				auto& array = intermediateValues[i].hour;
 				for (uint y = 0; y != maxHoursInAYear; ++y)
 					array[y] = Yuni::Math::Abs(array[y]) > 0. ? 100. : 0.;
 			}
@@ -221,7 +221,7 @@ namespace Variable
 		{
 			for (uint i = 0; i != ColumnCountT; ++i)
 			{
-				Antares::Memory::Stored<double>::ConstReturnType src = var.retrieveRawHourlyValuesForCurrentYear(i, numSpace);
+				const auto& src = var.retrieveRawHourlyValuesForCurrentYear(i, numSpace);
 				# ifdef ANTARES_SWAP_SUPPORT
 				assert(src.valid());
 				# else
@@ -237,7 +237,7 @@ namespace Variable
 		{
 			for (uint i = 0; i != ColumnCountT; ++i)
 			{
-				Antares::Memory::Stored<double>::ConstReturnType src = var.retrieveRawHourlyValuesForCurrentYear(i, numSpace);
+				const auto& src = var.retrieveRawHourlyValuesForCurrentYear(i, numSpace);
 				# ifdef ANTARES_SWAP_SUPPORT
 				assert(src.valid());
 				# else
@@ -265,11 +265,10 @@ namespace Variable
 		static void MultiplyHourlyResultsBy(U& intermediateValues, const double v)
 		{
 			assert(!Yuni::Math::NaN(v));
-			double* array;
 			const typename Type::const_iterator end = intermediateValues.end();
 			for (typename Type::const_iterator i = intermediateValues.begin(); i != end; ++i)
 			{
-				array = (*i).hour;
+				auto& array = (*i).hour;
 				for (uint y = 0; y != maxHoursInAYear; ++y)
 					array[y] *= v;
 			}
@@ -278,11 +277,10 @@ namespace Variable
 		template<class U>
 		static void SetTo1IfPositive(U& intermediateValues)
 		{
-			double* array;
 			const typename Type::const_iterator end = intermediateValues.end();
 			for (typename Type::const_iterator i = intermediateValues.begin(); i != end; ++i)
 			{
-				array = (*i).hour;
+				auto& array = (*i).hour;
 				for (uint y = 0; y != maxHoursInAYear; ++y)
 					array[y] = Yuni::Math::Abs(array[y]) > 0. ? 1. : 0.;
 			}
@@ -292,11 +290,10 @@ namespace Variable
 		template<class U>
 		static void Or(U& intermediateValues)
 		{
-			double* array;
 			const typename Type::const_iterator end = intermediateValues.end();
 			for (typename Type::const_iterator i = intermediateValues.begin(); i != end; ++i)
 			{
-				array = (*i).hour;
+				auto& array = (*i).hour;
 				for (uint y = 0; y != maxHoursInAYear; ++y)
 					array[y] = Yuni::Math::Abs(array[y]) > 0. ? 100. : 0.;
 			}
@@ -410,7 +407,7 @@ namespace Variable
 		{
 			for (uint i = 0; i != var.results().size(); ++i)
 			{
-				Antares::Memory::Stored<double>::ConstReturnType src = var.retrieveRawHourlyValuesForCurrentYear(i, numSpace);
+				const auto& src = var.retrieveRawHourlyValuesForCurrentYear(i, numSpace);
 				# ifdef ANTARES_SWAP_SUPPORT
 				assert(src.valid());
 				# else
@@ -427,7 +424,7 @@ namespace Variable
 		{
 			for (uint i = 0; i != var.results().size(); ++i)
 			{
-				Antares::Memory::Stored<double>::ConstReturnType src = var.retrieveRawHourlyValuesForCurrentYear(i, numSpace);
+				const auto& src = var.retrieveRawHourlyValuesForCurrentYear(i, numSpace);
 				# ifdef ANTARES_SWAP_SUPPORT
 				assert(src.valid());
 				# else
@@ -552,7 +549,7 @@ namespace Variable
 		template<class U, class VarT>
 		static void ComputeSum(U& out, const VarT& var, uint numSpace)
 		{
-			Antares::Memory::Stored<double>::ConstReturnType src = var.retrieveRawHourlyValuesForCurrentYear(-1, numSpace);
+			const auto& src = var.retrieveRawHourlyValuesForCurrentYear(-1, numSpace);
 			# ifdef ANTARES_SWAP_SUPPORT
 			assert(src.valid());
 			# else
@@ -566,7 +563,7 @@ namespace Variable
 		template<class U, class VarT>
 		static void ComputeMax(U& out, const VarT& var, uint numSpace)
 		{
-			Antares::Memory::Stored<double>::ConstReturnType src = var.retrieveRawHourlyValuesForCurrentYear(-1, numSpace);
+			const auto& src = var.retrieveRawHourlyValuesForCurrentYear(-1, numSpace);
 			# ifdef ANTARES_SWAP_SUPPORT
 			assert(src.valid());
 			# else
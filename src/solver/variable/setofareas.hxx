@@ -28,6 +28,7 @@
 # define __SOLVER_VARIABLE_SET_OF_AREAS_HXX__
 
 # include <antares/memory/memory.h>
+# include "summary.h"
 
 
 namespace Antares
@@ -346,7 +347,9 @@ namespace Variable
 	void
 	SetsOfAreas<NextT>::computeSpatialAggregatesSummary(V& allVars, std::map<unsigned int, unsigned int> & numSpaceToYear, unsigned int nbYearsForCurrentSummary)
 	{
-		for (uint setindex = 0; setindex != pSetsOfAreas.size(); ++setindex)
+		// The results of a set of areas only depend on its own variables, the values of
+		// the current years having already been aggregated
+		MergeItemsIntoSummary((uint) pSetsOfAreas.size(), [&] (uint setindex)
 		{
 			assert(setindex < pOriginalSets.size());
 			pSetsOfAreas[setindex]->computeSpatialAggregatesSummary(allVars, numSpaceToYear, nbYearsForCurrentSummary);
@@ -355,7 +358,7 @@ namespace Variable
 			// (only if the support is available)
 			if (Memory::swapSupport)
 				memory.flushAll();
-		}
+		});
 	}
 
 
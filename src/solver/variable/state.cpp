@@ -42,7 +42,8 @@ namespace Variable
 
 	State::State(Data::Study& s) :
 		hourInTheSimulation(0u),
-		dispatchableMargin(nullptr),
+		problemeHoraireAdequation(nullptr),
+		hourlyAdequacyResults(nullptr),
 		studyMode(s.parameters.mode),
 		study(s),
 		simplexHasBeenRan(true),
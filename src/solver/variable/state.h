@@ -123,6 +123,8 @@ namespace Variable
 
 		//! \name Adequacy Draft
 		//@{
+		//! The hourly flow problem of the current year
+		PROBLEME_HORAIRE_ADEQUATION* problemeHoraireAdequation;
 		RESULTATS_HORAIRES_ADEQUATION* hourlyAdequacyResults;
 		double eensSystemIS;
 		double eensSystemCN;
@@ -169,9 +171,6 @@ namespace Variable
 		double thermalClusterNonProportionalCostForYear[Variable::maxHoursInAYear];
 		//! Minimum power of the cluster for the whole year
 		double thermalClusterPMinOfTheClusterForYear[Variable::maxHoursInAYear];
-
-		//! Dispatchable margin for the current area (valid only from weekForEachArea)
-		const double* dispatchableMargin;
 		//@}
 
 
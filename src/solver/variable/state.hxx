@@ -82,7 +82,7 @@ namespace Variable
 				}
 			case Data::stdmAdequacyDraft:
 				{
-					hourlyAdequacyResults = ProblemeHoraireAdequation.ResultatsParPays[areaIndex];
+					hourlyAdequacyResults = problemeHoraireAdequation->ResultatsParPays[areaIndex];
 					break;
 				}
 			case Data::stdmUnknown:
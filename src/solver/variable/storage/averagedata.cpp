@@ -29,6 +29,7 @@
 #include <antares/study/memory-usage.h>
 #include "intermediate.h"
 #include "averagedata.h"
+#include "kernels.h"
 
 using namespace Yuni;
 
@@ -82,19 +83,14 @@ namespace AllYears
 
 	void AverageData::merge(unsigned int y, const IntermediateValues& rhs)
 	{
-		unsigned int i;
 		// Average value for each hour throughout all years
-		for (i = 0; i != maxHoursInAYear; ++i)
-			hourly[i] += rhs.hour[i] * ratio;
+		Kernel::AddScaled(maxHoursInAYear, Antares::Memory::RawPointer(hourly), Antares::Memory::RawPointer(rhs.hour), ratio);
 		// Average value for each day throughout all years
-		for (i = 0; i != maxDaysInAYear; ++i)
-			daily[i] += rhs.day[i] * ratio;
+		Kernel::AddScaled(maxDaysInAYear, daily, rhs.day, ratio);
 		// Average value for each week throughout all years
-		for (i = 0; i != maxWeeksInAYear; ++i)
-			weekly[i] += rhs.week[i] * ratio;
+		Kernel::AddScaled(maxWeeksInAYear, weekly, rhs.week, ratio);
 		// Average value for each month throughout all years
-		for (i = 0; i != maxMonths; ++i)
-			monthly[i] += rhs.month[i] * ratio;
+		Kernel::AddScaled(maxMonths, monthly, rhs.month, ratio);
 		// Average value throughout all years
 		year[y] += rhs.year * ratio;
 	}
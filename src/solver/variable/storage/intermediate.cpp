@@ -30,6 +30,7 @@
 #include <antares/study/memory-usage.h>
 #include <antares/study.h>
 #include "intermediate.h"
+#include "kernels.h"
 
 
 using namespace Yuni;
@@ -48,7 +49,7 @@ namespace Variable
 		calendar(nullptr),
 		year(0.)
 	{
-		Antares::Memory::Allocate<Type>(hour, maxHoursInAYear);
+		Antares::Memory::Allocate<HourlyType>(hour, maxHoursInAYear);
 		Antares::Memory::Zero(maxHoursInAYear, hour);
 		Antares::Memory::Flush(hour);
 		(void)::memset(month, 0, sizeof(Type) * maxMonths);
@@ -97,20 +98,14 @@ namespace Variable
 		// x(d)
 		// For each day in the year
 		uint indx = pRange->hour[Data::rangeBegin];
-
-		for (i = pRange->day[Data::rangeBegin]; i <= pRange->day[Data::rangeEnd]; ++i)
 		{
-			double d = 0.;
-			// One day
-			for (j = 0; j != maxHoursInADay; ++j)
-			{
-				assert(indx < maxHoursInAYear);
-				d += hour[indx];
-				++indx;
-			}
-			day[i] = d;
-			year += d;
+			const uint dayCount = pRange->day[Data::rangeEnd] - pRange->day[Data::rangeBegin] + 1;
+			assert(indx + dayCount * maxHoursInADay <= maxHoursInAYear);
+			Kernel::SumPerDay(dayCount, day + pRange->day[Data::rangeBegin],
+				Antares::Memory::RawPointer(hour) + indx);
 		}
+		for (i = pRange->day[Data::rangeBegin]; i <= pRange->day[Data::rangeEnd]; ++i)
+			year += day[i];
 
 		// weeks
 		for (i = 0; i != maxWeeksInAYear; ++i)
@@ -212,17 +207,12 @@ namespace Variable
 		// Ratio
 		double ratioDay = 1. / maxHoursInADay;
 
+		Kernel::SumPerDay(pRange->day[Data::rangeEnd] - pRange->day[Data::rangeBegin] + 1,
+			day + pRange->day[Data::rangeBegin], Antares::Memory::RawPointer(hour) + indx);
 		for (i = pRange->day[Data::rangeBegin]; i <= pRange->day[Data::rangeEnd]; ++i)
 		{
-			d = 0.;
-			// One day
-			for (j = 0; j != maxHoursInADay; ++j)
-			{
-				d += hour[indx];
-				++indx;
-			}
-			year += d;
-			day[i] = d * ratioDay;
+			year += day[i];
+			day[i] *= ratioDay;
 		}
 
 		// weeks
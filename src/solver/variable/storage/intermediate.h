@@ -53,6 +53,18 @@ namespace Variable
 	public:
 		//! Basic type
 		typedef double Type;
+		/*!
+		** \brief Type of the hourly values
+		**
+		** The hourly values are the largest part of the buffer. They are kept in
+		** single precision when the build option ANTARES_COMPACT_INTERMEDIATE_VALUES
+		** is enabled (all other values and all results remain in double precision).
+		*/
+		# ifdef ANTARES_COMPACT_INTERMEDIATE_VALUES
+		typedef float HourlyType;
+		# else
+		typedef double HourlyType;
+		# endif
 
 	public:
 		//! Try to estimate the amount of memory that will be required for a simulation
@@ -85,6 +97,11 @@ namespace Variable
 		*/
 		void flush() const;
 
+		/*!
+		** \brief Copy some hourly values, from the first hour of the year
+		*/
+		template<class U> void copyHourlyValues(const U& values, uint count);
+
 		/*!
 		** \brief Compute statistics for the current year
 		*/
@@ -133,8 +150,8 @@ namespace Variable
 		/*!
 		** \brief Vector alias for an hour in the year
 		*/
-		Type& operator [] (const uint index);
-		const Type& operator [] (const uint index) const;
+		HourlyType& operator [] (const uint index);
+		const HourlyType& operator [] (const uint index) const;
 		//@}
 
 
@@ -157,7 +174,7 @@ namespace Variable
 		//! Values for each day in the year
 		Type day[maxDaysInAYear];
 		//! Values for each hour in the year
-		mutable Antares::Memory::Stored<Type>::Type hour;
+		mutable Antares::Memory::Stored<HourlyType>::Type hour;
 		//! Year
 		Type year;
 
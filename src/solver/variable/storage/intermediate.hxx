@@ -57,12 +57,26 @@ namespace Variable
 	}
 
 
-	inline IntermediateValues::Type& IntermediateValues::operator [] (const unsigned int index)
+	template<class U>
+	inline void IntermediateValues::copyHourlyValues(const U& values, uint count)
+	{
+		assert(count <= maxHoursInAYear);
+		const double* src = Antares::Memory::RawPointer(values);
+		# ifdef ANTARES_COMPACT_INTERMEDIATE_VALUES
+		for (uint i = 0; i != count; ++i)
+			hour[i] = (HourlyType) src[i];
+		# else
+		(void)::memcpy(Antares::Memory::RawPointer(hour), src, sizeof(double) * count);
+		# endif
+	}
+
+
+	inline IntermediateValues::HourlyType& IntermediateValues::operator [] (const unsigned int index)
 	{
 		return hour[index];
 	}
 
-	inline const IntermediateValues::Type& IntermediateValues::operator [] (const unsigned int index) const
+	inline const IntermediateValues::HourlyType& IntermediateValues::operator [] (const unsigned int index) const
 	{
 		return hour[index];
 	}
@@ -71,7 +85,7 @@ namespace Variable
 	inline void
 	IntermediateValues::EstimateMemoryUsage(Data::StudyMemoryUsage& u)
 	{
-		Antares::Memory::EstimateMemoryUsage(sizeof(double), maxHoursInAYear, u, true);
+		Antares::Memory::EstimateMemoryUsage(sizeof(HourlyType), maxHoursInAYear, u, true);
 	}
 
 
@@ -82,7 +96,7 @@ namespace Variable
 		# ifdef ANTARES_SWAP_SUPPORT
 			0
 		# else
-			+ sizeof(Type) * maxHoursInAYear
+			+ sizeof(HourlyType) * maxHoursInAYear
 		# endif
 			;
 	}
@@ -144,7 +158,10 @@ namespace Variable
 		// Values
 		if (not annual)
 		{
-			(void)::memcpy(report.values[report.data.columnIndex], array, sizeof(double) * Size);
+			// the hourly values may be stored in single precision
+			double* target = report.values[report.data.columnIndex];
+			for (uint i = 0; i != Size; ++i)
+				target[i] = array[i];
 		}
 		else
 		{
@@ -0,0 +1,171 @@
+/*
+** Copyright 2007-2018 RTE
+** Authors: Antares_Simulator Team
+**
+** This file is part of Antares_Simulator.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** There are special exceptions to the terms and conditions of the
+** license as they are applied to this software. View the full text of
+** the exceptions in file COPYING.txt in the directory of this software
+** distribution
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with Antares_Simulator. If not, see <http://www.gnu.org/licenses/>.
+**
+** SPDX-License-Identifier: licenceRef-GPL3_WITH_RTE-Exceptions
+*/
+#ifndef __SOLVER_VARIABLE_STORAGE_KERNELS_H__
+# define __SOLVER_VARIABLE_STORAGE_KERNELS_H__
+
+# include <yuni/yuni.h>
+# include "../constants.h"
+
+
+namespace Antares
+{
+namespace Solver
+{
+namespace Variable
+{
+namespace Kernel
+{
+
+	/*
+	** The loops below work on raw pointers which do not alias, with all the
+	** parameters copied into local variables, so that the compiler can keep them
+	** into registers and vectorize the loops.
+	** The floating point operations are performed in the same order as a naive
+	** loop would do, the results are exactly the same.
+	*/
+
+
+	/*!
+	** \brief out[i] += in[i] * ratio
+	*/
+	template<class U>
+	inline void AddScaled(uint count, double* __restrict out, const U* __restrict in, const double ratio)
+	{
+		for (uint i = 0; i != count; ++i)
+			out[i] += (double) in[i] * ratio;
+	}
+
+
+	/*!
+	** \brief out[i] += in[i] * in[i] * ratio
+	*/
+	template<class U>
+	inline void AddSquaresScaled(uint count, double* __restrict out, const U* __restrict in, const double ratio)
+	{
+		for (uint i = 0; i != count; ++i)
+		{
+			const double v = (double) in[i];
+			out[i] += v * v * ratio;
+		}
+	}
+
+
+	/*!
+	** \brief out[i] += in[i]
+	*/
+	template<class U>
+	inline void Add(uint count, double* __restrict out, const U* __restrict in)
+	{
+		for (uint i = 0; i != count; ++i)
+			out[i] += (double) in[i];
+	}
+
+
+	/*!
+	** \brief Keep the lowest values (lower by more than `eps`), and the year they come from
+	**
+	** The stores are unconditional, thus the loop does not have any branch.
+	*/
+	template<class U>
+	inline void MergeInf(uint count, double* __restrict values, Yuni::uint32* __restrict indices,
+		const U* __restrict in, const Yuni::uint32 indice, const double eps)
+	{
+		for (uint i = 0; i != count; ++i)
+		{
+			const double v = (double) in[i];
+			const bool lower = (v < values[i] - eps);
+			values[i]  = lower ? v : values[i];
+			indices[i] = lower ? indice : indices[i];
+		}
+	}
+
+
+	/*!
+	** \brief Keep the greatest values (greater by more than `eps`), and the year they come from
+	*/
+	template<class U>
+	inline void MergeSup(uint count, double* __restrict values, Yuni::uint32* __restrict indices,
+		const U* __restrict in, const Yuni::uint32 indice, const double eps)
+	{
+		for (uint i = 0; i != count; ++i)
+		{
+			const double v = (double) in[i];
+			const bool greater = (v > values[i] + eps);
+			values[i]  = greater ? v : values[i];
+			indices[i] = greater ? indice : indices[i];
+		}
+	}
+
+
+	/*!
+	** \brief Sum of the hourly values of each day
+	**
+	** The days are summed four by four, with independent accumulators. The hours of
+	** a single day are still summed in their natural order.
+	*/
+	template<class U>
+	inline void SumPerDay(uint dayCount, double* __restrict days, const U* __restrict hours)
+	{
+		uint d = 0;
+		for (; d + 4 <= dayCount; d += 4)
+		{
+			const U* h = hours + d * maxHoursInADay;
+			double s0 = 0.;
+			double s1 = 0.;
+			double s2 = 0.;
+			double s3 = 0.;
+			for (uint j = 0; j != maxHoursInADay; ++j)
+			{
+				s0 += (double) h[j];
+				s1 += (double) h[j +     maxHoursInADay];
+				s2 += (double) h[j + 2 * maxHoursInADay];
+				s3 += (double) h[j + 3 * maxHoursInADay];
+			}
+			days[d]     = s0;
+			days[d + 1] = s1;
+			days[d + 2] = s2;
+			days[d + 3] = s3;
+		}
+		for (; d != dayCount; ++d)
+		{
+			const U* h = hours + d * maxHoursInADay;
+			double s = 0.;
+			for (uint j = 0; j != maxHoursInADay; ++j)
+				s += (double) h[j];
+			days[d] = s;
+		}
+	}
+
+
+
+
+} // namespace Kernel
+} // namespace Variable
+} // namespace Solver
+} // namespace Antares
+
+#endif // __SOLVER_VARIABLE_STORAGE_KERNELS_H__
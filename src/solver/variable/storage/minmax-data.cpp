@@ -29,6 +29,7 @@
 #include <antares/study/memory-usage.h>
 #include "intermediate.h"
 #include "minmax-data.h"
+#include "kernels.h"
 #include <float.h>
 
 
@@ -51,130 +52,14 @@ namespace AllYears
 	{
 		double eps = 1.e-7;
 
-		template<uint Size, bool OpInferior>
-		struct ArrayInitializer
+		static inline void Init(uint count, double* values, Yuni::uint32* indices, const double value)
 		{
-			static void Init(Antares::Memory::Array<MinMaxData::Data>& array)
+			for (uint i = 0; i != count; ++i)
 			{
-				for (uint i = 0; i != Size; ++i)
-				{
-					MinMaxData::Data& data = array[i];
-					data.value  = DBL_MAX;             // +inf
-					data.indice = (Yuni::uint32)(-1); // invalid indice
-				}
+				values[i]  = value;
+				indices[i] = (Yuni::uint32)(-1); // invalid indice
 			}
-
-			static void Init(MinMaxData::Data* array)
-			{
-				for (uint i = 0; i != Size; ++i)
-				{
-					MinMaxData::Data& data = array[i];
-					data.value  = DBL_MAX;             // +inf
-					data.indice = (Yuni::uint32)(-1); // invalid indice
-				}
-			}
-
-		}; // class ArrayInitializer
-
-
-		template<uint Size>
-		struct ArrayInitializer<Size, false>
-		{
-			static void Init(Antares::Memory::Array<MinMaxData::Data>& array)
-			{
-				for (uint i = 0; i != Size; ++i)
-				{
-					// Contrary to what we could guess, DBL_MIN is not the smallest number
-					// you can hold in a double, but the smallest positive number you can
-					// hold in a double
-					MinMaxData::Data& data = array[i];
-					data.value  = - DBL_MAX;           // -inf
-					data.indice = (Yuni::uint32)(-1); // invalid indice
-				}
-			}
-
-			static void Init(MinMaxData::Data* array)
-			{
-				for (uint i = 0; i != Size; ++i)
-				{
-					// Contrary to what we could guess, DBL_MIN is not the smallest number
-					// you can hold in a double, but the smallest positive number you can
-					// hold in a double
-					MinMaxData::Data& data = array[i];
-					data.value  = - DBL_MAX;           // -inf
-					data.indice = (Yuni::uint32)(-1); // invalid indice
-				}
-			}
-
-		}; // class ArrayInitializer
-
-
-		template<bool OpInferior, uint Size>
-		struct MergeArray
-		{
-			template<class U>
-			static void Do(const uint year, Antares::Memory::Array<MinMaxData::Data>& results, const U& values)
-			{
-				for (uint i = 0; i != Size; ++i)
-				{
-					MinMaxData::Data& data = results[i];
-					if (values[i] < data.value - eps)
-					{
-						data.value  = values[i];
-						data.indice = year + 1; // The year is zero-based
-					}
-				}
-			}
-
-			template<class U>
-			static void Do(const uint year, MinMaxData::Data* results, const U& values)
-			{
-				for (uint i = 0; i != Size; ++i)
-				{
-					if (values[i] < results[i].value - eps)
-					{
-						results[i].value  = values[i];
-						results[i].indice = year + 1; // The year is zero-based
-					}
-				}
-			}
-
-		}; // class MergeArray
-
-
-		template<uint Size>
-		struct MergeArray<0, Size>
-		{
-			template<class U>
-			static void Do(const uint year, Antares::Memory::Array<MinMaxData::Data>& results, const U& values)
-			{
-				for (uint i = 0; i != Size; ++i)
-				{
-					MinMaxData::Data& data = results[i];
-					if (values[i] > data.value + eps)
-					{
-						data.value = values[i];
-						data.indice = year + 1; // The year is zero-based
-					}
-				}
-			}
-
-			template<class U>
-			static void Do(const uint year, MinMaxData::Data* results, const U& values)
-			{
-				for (uint i = 0; i != Size; ++i)
-				{
-					MinMaxData::Data& data = results[i];
-					if (values[i] > data.value + eps)
-					{
-						data.value = values[i];
-						data.indice = year + 1; // The year is zero-based
-					}
-				}
-			}
-
-		}; // class MergeArray
-
+		}
 
 	} // anonymous namespace
 
@@ -182,7 +67,8 @@ namespace AllYears
 
 
 	MinMaxData::MinMaxData()
-		:hourly(nullptr)
+		:hourly(nullptr),
+		hourlyIndices(nullptr)
 	{
 	}
 
@@ -190,25 +76,29 @@ namespace AllYears
 	MinMaxData::~MinMaxData()
 	{
 		Antares::Memory::Release(hourly);
+		Antares::Memory::Release(hourlyIndices);
 	}
 
 
 	void MinMaxData::resetInf()
 	{
-		ArrayInitializer<1,               true>::Init(&annual);
-		ArrayInitializer<maxMonths,       true>::Init(monthly);
-		ArrayInitializer<maxWeeksInAYear, true>::Init(weekly);
-		ArrayInitializer<maxDaysInAYear,  true>::Init(daily);
-		ArrayInitializer<maxHoursInAYear, true>::Init(hourly);
+		Init(1,               &annual, &annualIndice,  DBL_MAX); // +inf
+		Init(maxMonths,       monthly, monthlyIndices, DBL_MAX);
+		Init(maxWeeksInAYear, weekly,  weeklyIndices,  DBL_MAX);
+		Init(maxDaysInAYear,  daily,   dailyIndices,   DBL_MAX);
+		Init(maxHoursInAYear, Antares::Memory::RawPointer(hourly), Antares::Memory::RawPointer(hourlyIndices), DBL_MAX);
 	}
 
 	void MinMaxData::resetSup()
 	{
-		ArrayInitializer<1,               false>::Init(&annual);
-		ArrayInitializer<maxMonths,       false>::Init(monthly);
-		ArrayInitializer<maxWeeksInAYear, false>::Init(weekly);
-		ArrayInitializer<maxDaysInAYear,  false>::Init(daily);
-		ArrayInitializer<maxHoursInAYear, false>::Init(hourly);
+		// Contrary to what we could guess, DBL_MIN is not the smallest number
+		// you can hold in a double, but the smallest positive number you can
+		// hold in a double
+		Init(1,               &annual, &annualIndice,  - DBL_MAX); // -inf
+		Init(maxMonths,       monthly, monthlyIndices, - DBL_MAX);
+		Init(maxWeeksInAYear, weekly,  weeklyIndices,  - DBL_MAX);
+		Init(maxDaysInAYear,  daily,   dailyIndices,   - DBL_MAX);
+		Init(maxHoursInAYear, Antares::Memory::RawPointer(hourly), Antares::Memory::RawPointer(hourlyIndices), - DBL_MAX);
 	}
 
 
@@ -216,26 +106,31 @@ namespace AllYears
 	void MinMaxData::initialize()
 	{
 		Antares::Memory::Allocate(hourly, maxHoursInAYear);
+		Antares::Memory::Allocate(hourlyIndices, maxHoursInAYear);
 	}
 
 
 	void MinMaxData::mergeInf(uint year, const IntermediateValues& rhs)
 	{
-		MergeArray<true, maxMonths       >::Do (year, monthly, rhs.month);
-		MergeArray<true, maxWeeksInAYear >::Do (year, weekly,  rhs.week);
-		MergeArray<true, maxDaysInAYear  >::Do (year, daily,   rhs.day);
-		MergeArray<true, maxHoursInAYear >::Do (year, hourly,  rhs.hour);
-		MergeArray<true, 1               >::Do (year, &annual, &rhs.year);
+		const Yuni::uint32 indice = year + 1; // The year is zero-based
+		Kernel::MergeInf(maxMonths,       monthly, monthlyIndices, rhs.month, indice, eps);
+		Kernel::MergeInf(maxWeeksInAYear, weekly,  weeklyIndices,  rhs.week,  indice, eps);
+		Kernel::MergeInf(maxDaysInAYear,  daily,   dailyIndices,   rhs.day,   indice, eps);
+		Kernel::MergeInf(maxHoursInAYear, Antares::Memory::RawPointer(hourly), Antares::Memory::RawPointer(hourlyIndices),
+			Antares::Memory::RawPointer(rhs.hour), indice, eps);
+		Kernel::MergeInf(1,               &annual, &annualIndice,  &rhs.year, indice, eps);
 	}
 
 
 	void MinMaxData::mergeSup(uint year, const IntermediateValues& rhs)
 	{
-		MergeArray<false, maxMonths       >::Do (year, monthly, rhs.month);
-		MergeArray<false, maxWeeksInAYear >::Do (year, weekly,  rhs.week);
-		MergeArray<false, maxDaysInAYear  >::Do (year, daily,   rhs.day);
-		MergeArray<false, maxHoursInAYear >::Do (year, hourly,  rhs.hour);
-		MergeArray<false, 1               >::Do (year, &annual, &rhs.year);
+		const Yuni::uint32 indice = year + 1; // The year is zero-based
+		Kernel::MergeSup(maxMonths,       monthly, monthlyIndices, rhs.month, indice, eps);
+		Kernel::MergeSup(maxWeeksInAYear, weekly,  weeklyIndices,  rhs.week,  indice, eps);
+		Kernel::MergeSup(maxDaysInAYear,  daily,   dailyIndices,   rhs.day,   indice, eps);
+		Kernel::MergeSup(maxHoursInAYear, Antares::Memory::RawPointer(hourly), Antares::Memory::RawPointer(hourlyIndices),
+			Antares::Memory::RawPointer(rhs.hour), indice, eps);
+		Kernel::MergeSup(1,               &annual, &annualIndice,  &rhs.year, indice, eps);
 	}
 
 
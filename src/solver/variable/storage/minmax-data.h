@@ -45,13 +45,6 @@ namespace AllYears
 
 	class MinMaxData
 	{
-	public:
-		struct Data
-		{
-			double value;
-			Yuni::uint32 indice;
-		};
-
 	public:
 		//! \name Constructor & Destructor
 		//@{
@@ -72,11 +65,19 @@ namespace AllYears
 		void mergeSup(uint year, const IntermediateValues& rhs);
 
 	public:
-		Data annual;
-		Data monthly[maxMonths];
-		Data weekly[maxWeeksInAYear];
-		Data daily[maxDaysInAYear];
-		Antares::Memory::Stored<Data>::Type  hourly;
+		//! The min or max values
+		double annual;
+		double monthly[maxMonths];
+		double weekly[maxWeeksInAYear];
+		double daily[maxDaysInAYear];
+		Antares::Memory::Stored<double>::Type  hourly;
+
+		//! The years (one-based) of the values, kept apart to get contiguous values
+		Yuni::uint32 annualIndice;
+		Yuni::uint32 monthlyIndices[maxMonths];
+		Yuni::uint32 weeklyIndices[maxWeeksInAYear];
+		Yuni::uint32 dailyIndices[maxDaysInAYear];
+		Antares::Memory::Stored<Yuni::uint32>::Type  hourlyIndices;
 
 	}; // class MinMaxData
 
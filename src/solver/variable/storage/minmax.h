@@ -88,19 +88,19 @@ namespace AllYears
 						switch (precision)
 						{
 							case Category::hourly:
-								InternalExportIndices<maxHoursInAYear, VCardT>(report, Memory::RawPointer(minmax.hourly), fileLevel);
+								InternalExportIndices<maxHoursInAYear, VCardT>(report, Memory::RawPointer(minmax.hourlyIndices), fileLevel);
 								break;
 							case Category::daily:
-								InternalExportIndices<maxDaysInAYear, VCardT>(report, minmax.daily, fileLevel);
+								InternalExportIndices<maxDaysInAYear, VCardT>(report, minmax.dailyIndices, fileLevel);
 								break;
 							case Category::weekly:
-								InternalExportIndices<maxWeeksInAYear, VCardT>(report, minmax.weekly, fileLevel);
+								InternalExportIndices<maxWeeksInAYear, VCardT>(report, minmax.weeklyIndices, fileLevel);
 								break;
 							case Category::monthly:
-								InternalExportIndices<maxMonths, VCardT>(report, minmax.monthly, fileLevel);
+								InternalExportIndices<maxMonths, VCardT>(report, minmax.monthlyIndices, fileLevel);
 								break;
 							case Category::annual:
-								InternalExportIndices<1, VCardT>(report, &minmax.annual, fileLevel);
+								InternalExportIndices<1, VCardT>(report, &minmax.annualIndice, fileLevel);
 								break;
 						}
 						break;
@@ -144,7 +144,7 @@ namespace AllYears
 			# ifdef ANTARES_SWAP_SUPPORT
 				0
 			# else
-				sizeof(double) * maxHoursInAYear
+				(sizeof(double) + sizeof(Yuni::uint32)) * maxHoursInAYear
 			# endif
 				+ NextType::memoryUsage();
 
@@ -152,7 +152,7 @@ namespace AllYears
 
 		static void EstimateMemoryUsage(Data::StudyMemoryUsage& u)
 		{
-			Antares::Memory::EstimateMemoryUsage(sizeof(MinMaxData::Data), maxHoursInAYear, u, false);
+			Antares::Memory::EstimateMemoryUsage(sizeof(double) + sizeof(Yuni::uint32), maxHoursInAYear, u, false);
 			u.takeIntoConsiderationANewTimeserieForDiskOutput(true);
 			NextType::EstimateMemoryUsage(u);
 
@@ -169,10 +169,10 @@ namespace AllYears
 
 	private:
 		template<uint Size, class VCardT>
-		static void InternalExportIndices(SurveyResults& report, const MinMaxData::Data* array, int fileLevel);
+		static void InternalExportIndices(SurveyResults& report, const Yuni::uint32* array, int fileLevel);
 
 		template<uint Size, class VCardT>
-		static void InternalExportValues(SurveyResults& report, const MinMaxData::Data* array);
+		static void InternalExportValues(SurveyResults& report, const double* array);
 
 	}; // class MinMaxBase
 
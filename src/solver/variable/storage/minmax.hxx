@@ -86,7 +86,7 @@ namespace AllYears
 
 	template<bool OpInferior, class NextT>
 	template<uint Size, class VCardT>
-	void MinMaxBase<OpInferior,NextT>::InternalExportIndices(SurveyResults& report, const MinMaxData::Data* array, int fileLevel)
+	void MinMaxBase<OpInferior,NextT>::InternalExportIndices(SurveyResults& report, const Yuni::uint32* array, int fileLevel)
 	{
 		assert(array);
 		assert(report.data.columnIndex < report.maxVariables && "Column index out of bounds");
@@ -109,7 +109,7 @@ namespace AllYears
 		// Values
 		double* v = report.values[report.data.columnIndex];
 		for (uint i = 0; i != Size; ++i)
-			v[i] = (double) array[i].indice;
+			v[i] = (double) array[i];
 
 		// Next column index
 		++report.data.columnIndex;
@@ -118,7 +118,7 @@ namespace AllYears
 
 	template<bool OpInferior, class NextT>
 	template<uint Size, class VCardT>
-	inline void MinMaxBase<OpInferior,NextT>::InternalExportValues(SurveyResults& report, const MinMaxData::Data* array)
+	inline void MinMaxBase<OpInferior,NextT>::InternalExportValues(SurveyResults& report, const double* array)
 	{
 		assert(array);
 		assert(report.data.columnIndex < report.maxVariables && "Column index out of bounds");
@@ -136,7 +136,7 @@ namespace AllYears
 		// Values
 		double* v = report.values[report.data.columnIndex];
 		for (uint i = 0; i != Size; ++i)
-			v[i] = array[i].value;
+			v[i] = array[i];
 
 		// Next column index
 		++report.data.columnIndex;
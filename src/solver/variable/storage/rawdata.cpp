@@ -27,6 +27,7 @@
 
 #include <yuni/yuni.h>
 #include "rawdata.h"
+#include "kernels.h"
 
 
 using namespace Yuni;
@@ -78,19 +79,14 @@ namespace AllYears
 
 	void RawData::merge(unsigned int y, const IntermediateValues& rhs)
 	{
-		unsigned int i;
 		// StdDeviation value for each hour throughout all years
-		for (i = 0; i != maxHoursInAYear; ++i)
-			hourly[i] += rhs.hour[i];
+		Kernel::Add(maxHoursInAYear, Antares::Memory::RawPointer(hourly), Antares::Memory::RawPointer(rhs.hour));
 		// StdDeviation value for each day throughout all years
-		for (i = 0; i != maxDaysInAYear; ++i)
-			daily[i] += rhs.day[i];
+		Kernel::Add(maxDaysInAYear, daily, rhs.day);
 		// StdDeviation value for each week throughout all years
-		for (i = 0; i != maxWeeksInAYear; ++i)
-			weekly[i] += rhs.week[i];
+		Kernel::Add(maxWeeksInAYear, weekly, rhs.week);
 		// StdDeviation value for each month throughout all years
-		for (i = 0; i != maxMonths; ++i)
-			monthly[i] += rhs.month[i];
+		Kernel::Add(maxMonths, monthly, rhs.month);
 		// StdDeviation value throughout all years
 		year[y] += rhs.year;
 	}
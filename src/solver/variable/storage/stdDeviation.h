@@ -30,6 +30,7 @@
 # include <float.h>
 # include <limits>
 # include <yuni/core/math.h>
+# include "kernels.h"
 
 
 namespace Antares
@@ -112,19 +113,15 @@ namespace AllYears
 
 		void merge(unsigned int year, const IntermediateValues& rhs)
 		{
-			unsigned int i;
 			// StdDeviation value for each hour throughout all years
-			for (i = 0; i != maxHoursInAYear; ++i)
-				stdDeviationHourly[i] += rhs.hour[i] * rhs.hour[i] * pRatio;
+			Kernel::AddSquaresScaled(maxHoursInAYear, Antares::Memory::RawPointer(stdDeviationHourly),
+				Antares::Memory::RawPointer(rhs.hour), pRatio);
 			// StdDeviation value for each day throughout all years
-			for (i = 0; i != maxDaysInAYear; ++i)
-				stdDeviationDaily[i] += rhs.day[i] * rhs.day[i] * pRatio;
+			Kernel::AddSquaresScaled(maxDaysInAYear, stdDeviationDaily, rhs.day, pRatio);
 			// StdDeviation value for each week throughout all years
-			for (i = 0; i != maxWeeksInAYear; ++i)
-				stdDeviationWeekly[i] += rhs.week[i] * rhs.week[i] * pRatio;
+			Kernel::AddSquaresScaled(maxWeeksInAYear, stdDeviationWeekly, rhs.week, pRatio);
 			// StdDeviation value for each month throughout all years
-			for (i = 0; i != maxMonths; ++i)
-				stdDeviationMonthly[i] += rhs.month[i] * rhs.month[i] * pRatio;
+			Kernel::AddSquaresScaled(maxMonths, stdDeviationMonthly, rhs.month, pRatio);
 			// StdDeviation value throughout all years
 			stdDeviationYear += rhs.year * rhs.year * pRatio;
 
@@ -0,0 +1,137 @@
+/*
+** Copyright 2007-2018 RTE
+** Authors: Antares_Simulator Team
+**
+** This file is part of Antares_Simulator.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** There are special exceptions to the terms and conditions of the
+** license as they are applied to this software. View the full text of
+** the exceptions in file COPYING.txt in the directory of this software
+** distribution
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with Antares_Simulator. If not, see <http://www.gnu.org/licenses/>.
+**
+** SPDX-License-Identifier: licenceRef-GPL3_WITH_RTE-Exceptions
+*/
+
+#include "summary.h"
+#include <yuni/job/job.h>
+#include <antares/memory/memory.h>
+#include <cassert>
+
+
+namespace Antares
+{
+namespace Solver
+{
+namespace Variable
+{
+
+	namespace // anonymous
+	{
+
+		class MergeJob final : public Yuni::Job::IJob
+		{
+		public:
+			MergeJob(const std::function<void (uint)>& merge, uint first, uint end) :
+				merge(merge),
+				first(first),
+				end(end)
+			{}
+
+		protected:
+			virtual void onExecute() override
+			{
+				for (uint i = first; i != end; ++i)
+					merge(i);
+			}
+
+		private:
+			const std::function<void (uint)>& merge;
+			const uint first;
+			const uint end;
+		};
+
+	} // anonymous namespace
+
+
+
+	namespace // anonymous
+	{
+
+		//! The pool of the simulation currently running, if any
+		SummaryThreadPool* gPool = nullptr;
+
+	} // anonymous namespace
+
+
+
+	SummaryThreadPool::SummaryThreadPool(uint maxThreadCount) :
+		pMaxThreadCount(maxThreadCount),
+		pIdleThreadCount(maxThreadCount)
+	{
+		assert(gPool == nullptr && "a single simulation at once");
+		if (pMaxThreadCount > 1)
+		{
+			pQueue.maximumThreadCount(pMaxThreadCount);
+			pQueue.start();
+		}
+		gPool = this;
+	}
+
+
+	SummaryThreadPool::~SummaryThreadPool()
+	{
+		gPool = nullptr;
+		if (pMaxThreadCount > 1)
+			pQueue.stop();
+	}
+
+
+	void SummaryThreadPool::idleThreads(uint count)
+	{
+		pIdleThreadCount = (count < pMaxThreadCount) ? count : pMaxThreadCount;
+	}
+
+
+	void MergeItemsIntoSummary(uint itemCount, const std::function<void (uint)>& merge)
+	{
+		uint threadCount = (gPool) ? gPool->pIdleThreadCount : 1;
+		if (threadCount > itemCount)
+			threadCount = itemCount;
+
+		if (threadCount < 2 || Antares::Memory::swapSupport)
+		{
+			for (uint i = 0; i != itemCount; ++i)
+				merge(i);
+			return;
+		}
+
+		// The threads of the pool are already running : only as many jobs as idle
+		// threads are queued, the others keep sleeping
+		for (uint t = 0; t != threadCount; ++t)
+		{
+			uint first = (uint) (((Yuni::uint64) itemCount * t) / threadCount);
+			uint end   = (uint) (((Yuni::uint64) itemCount * (t + 1)) / threadCount);
+			gPool->pQueue.add(new MergeJob(merge, first, end));
+		}
+		gPool->pQueue.wait(Yuni::qseIdle);
+	}
+
+
+
+
+} // namespace Variable
+} // namespace Solver
+} // namespace Antares
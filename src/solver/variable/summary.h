@@ -0,0 +1,107 @@
+/*
+** Copyright 2007-2018 RTE
+** Authors: Antares_Simulator Team
+**
+** This file is part of Antares_Simulator.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** There are special exceptions to the terms and conditions of the
+** license as they are applied to this software. View the full text of
+** the exceptions in file COPYING.txt in the directory of this software
+** distribution
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with Antares_Simulator. If not, see <http://www.gnu.org/licenses/>.
+**
+** SPDX-License-Identifier: licenceRef-GPL3_WITH_RTE-Exceptions
+*/
+#ifndef __SOLVER_VARIABLE_SUMMARY_H__
+# define __SOLVER_VARIABLE_SUMMARY_H__
+
+# include <yuni/yuni.h>
+# include <yuni/job/queue/service.h>
+# include <functional>
+
+
+namespace Antares
+{
+namespace Solver
+{
+namespace Variable
+{
+
+	/*!
+	** \brief Threads merging the items into the MC synthesis
+	**
+	** The threads are started once and kept by the simulation until the last year is merged.
+	** They sleep between two merges. Before each merge, the simulation gives the number of
+	** year workers that are idle : no more threads are used, so that the merge does not
+	** compete with the years still running.
+	** While a pool exists, it is used by MergeItemsIntoSummary().
+	*/
+	class SummaryThreadPool final
+	{
+	public:
+		//! \name Constructor & Destructor
+		//@{
+		/*!
+		** \brief Start the threads
+		**
+		** \param maxThreadCount The maximum number of threads (the number of years run in parallel)
+		*/
+		explicit SummaryThreadPool(uint maxThreadCount);
+		//! Destructor, stop the threads
+		~SummaryThreadPool();
+		//@}
+
+		/*!
+		** \brief Set the number of threads available for the next merges
+		*/
+		void idleThreads(uint count);
+
+	private:
+		SummaryThreadPool(const SummaryThreadPool&) = delete;
+		SummaryThreadPool& operator = (const SummaryThreadPool&) = delete;
+		friend void MergeItemsIntoSummary(uint, const std::function<void (uint)>&);
+
+		//! The threads
+		Yuni::Job::QueueService pQueue;
+		//! The maximum number of threads
+		const uint pMaxThreadCount;
+		//! The number of threads available for the next merges
+		uint pIdleThreadCount;
+
+	}; // class SummaryThreadPool
+
+
+	/*!
+	** \brief Merge the results of independent items (areas, sets of areas...) into the MC synthesis
+	**
+	** The items are split into contiguous ranges, each range being merged by an idle thread
+	** of the pool of the simulation. An item is always merged by a single thread, in the order
+	** of the years, thus the results do not depend on the number of threads.
+	** The items are merged by the calling thread when there is no pool, no idle thread, or
+	** when the swap support is enabled.
+	**
+	** \param itemCount The number of items
+	** \param merge The merge of a single item, from its index
+	*/
+	void MergeItemsIntoSummary(uint itemCount, const std::function<void (uint)>& merge);
+
+
+
+
+} // namespace Variable
+} // namespace Solver
+} // namespace Antares
+
+#endif // __SOLVER_VARIABLE_SUMMARY_H__
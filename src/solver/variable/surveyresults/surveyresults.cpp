@@ -32,6 +32,7 @@
 #include <antares/logs.h>
 #include <yuni/io/file.h>
 #include <antares/io/file.h>
+#include <antares/io/survey-binary.h>
 
 using namespace Yuni;
 using namespace Antares;
@@ -564,6 +565,7 @@ namespace Variable
 		data(s, o, year),
 		maxVariables(Math::Max<uint>(maxVars, 3 * s.runtime->maxThermalClustersForSingleArea)),
 		yearByYearResults(false),
+		binaryFormat(s.parameters.resultFormat == Data::rfBinary),
 		isCurrentVarNA(nullptr),
 		isPrinted(nullptr)
 	{
@@ -791,15 +793,21 @@ namespace Variable
 			WriteIndexHeaderToFileDescriptor<2>(precisionLevel, data.fileBuffer, "system", captions, data.columnIndex);
 		}
 
-		char conversionBuffer[256];
-		conversionBuffer[0] = '\t';
-		uint error = 0;
-
 		# ifndef NDEBUG
 		// A few preliminary checks
 		for (uint x = 0; x != data.columnIndex; ++x)
 			assert(not precision[x].empty() && "invalid precision");
 		# endif
+
+		if (binaryFormat)
+		{
+			saveToBinaryFile(dataLevel, fileLevel, precisionLevel, heightBegin, heightEnd);
+			return;
+		}
+
+		char conversionBuffer[256];
+		conversionBuffer[0] = '\t';
+		uint error = 0;
 		
 		if (fileLevel & Category::mc)
 		{			
@@ -847,6 +855,61 @@ namespace Variable
 	}
 
 
+	void SurveyResults::saveToBinaryFile(int dataLevel, int fileLevel, int precisionLevel,
+		uint heightBegin, uint heightEnd)
+	{
+		// The text header is kept as it is, for the conversion to the text format
+		const Clob textHeader = data.fileBuffer;
+
+		// Row labels (index, date...)
+		data.fileBuffer.clear();
+		for (uint y = heightBegin; y < heightEnd; ++y)
+		{
+			writeDateToFileDescriptor(y + 1, fileLevel, precisionLevel);
+			data.fileBuffer += '\n';
+		}
+		const Clob rowLabels = data.fileBuffer;
+
+		const uint rowCount = heightEnd - heightBegin;
+		const bool mc = (0 != (fileLevel & Category::mc));
+
+		SurveyBinary::Writer writer(data.fileBuffer);
+		writer.header((uint) dataLevel, (uint) fileLevel, (uint) precisionLevel, data.columnIndex,
+			heightBegin + 1, rowCount, textHeader);
+
+		for (uint x = 0; x != data.columnIndex; ++x)
+		{
+			// precision : "%.<decimals>f"
+			uint decimals = (precision[x].size() > 2) ? (uint) (precision[x][2] - '0') : 0;
+			writer.column(captions[0][x], captions[1][x], captions[2][x], decimals,
+				(not mc) and nonApplicableStatus[x]);
+		}
+
+		writer.rowLabels(rowLabels);
+
+		uint error = 0;
+		for (uint x = 0; x != data.columnIndex; ++x)
+		{
+			for (uint y = heightBegin; y < heightEnd; ++y)
+			{
+				double v = (mc) ? data.matrix[x][y] : values[x][y];
+				if (Math::NaN(v) and ++error == 1)
+				{
+					// We should disabled errors on NaN if the quadratic optimization has failed
+					if (not data.study.runtime->quadraticOptimizationHasFailed)
+						logs.error() << "'NaN' value detected";
+				}
+				writer.value(v);
+			}
+		}
+
+		if (data.filename.endsWith(".txt"))
+			data.filename.chop(4);
+		data.filename << SurveyBinary::extension;
+		IOFileSetContent(data.filename, data.fileBuffer);
+	}
+
+
 
 	void SurveyResults::EstimateMemoryUsage(uint maxVars, Data::StudyMemoryUsage& u)
 	{
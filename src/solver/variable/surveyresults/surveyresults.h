@@ -139,6 +139,9 @@ namespace Variable
 		//! Flag to known if we are in the year-by-year mode
 		bool yearByYearResults;
 
+		//! Write the results in the binary columnar format instead of text
+		const bool binaryFormat;
+
 		//! When looping over output variables, is current variable non applicable ?
 		//! In the static type list of variables, there is a need to convey the non applicable status to variables
 		//! statistic results through an instance of the current class.
@@ -162,6 +165,14 @@ namespace Variable
 
 		void writeDateToFileDescriptor(uint row, int fileLevel, int precisionLevel);
 
+		/*!
+		** \brief Write the data into a binary file (see io/survey-binary.h)
+		**
+		** The text header must already be in the file buffer.
+		*/
+		void saveToBinaryFile(int dataLevel, int fileLevel, int precisionLevel,
+			uint heightBegin, uint heightEnd);
+
 	}; // class SurveyResults
 
 
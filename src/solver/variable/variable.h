@@ -336,6 +336,11 @@ namespace Variable
 		bool* isNonApplicable;
 		// Do we print results regarding the current variable in output files ? Or do we skip them ?
 		bool* isPrinted;
+		// Do we compute the current variable ? False when none of its columns is printed, the
+		// variable can then skip all its hourly, weekly and annual work.
+		// Variables whose results are needed by other parts of the solver (costs, balance, ...)
+		// do not take it into account.
+		bool isComputed;
 		// Positive column count (original column count can be < 0 for some variable [see variables "by plant"])
 		uint pColumnCount;
 
@@ -87,6 +87,7 @@ namespace Variable
 		// Initializing default print to true
 		for (uint i = 0; i < pColumnCount; i++)
 			isPrinted[i] = true;
+		isComputed = true;
 
 	}
 
@@ -214,6 +215,12 @@ namespace Variable
 	IVariable<ChildT, NextT, VCardT>::getPrintStatusFromStudy(Data::Study& study)
 	{
 		GetPrintStatusHelper<VCardType::columnCount, VCardType>::Do(study, isPrinted);
+
+		// The variable is computed as soon as one of its columns is printed
+		isComputed = false;
+		for (uint i = 0; i != pColumnCount; ++i)
+			isComputed = isComputed || isPrinted[i];
+
 		// Go to the next variable
 		NextType::getPrintStatusFromStudy(study);
 	}
@@ -0,0 +1,161 @@
+/*
+** Copyright 2007-2018 RTE
+** Authors: Antares_Simulator Team
+**
+** This file is part of Antares_Simulator.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** There are special exceptions to the terms and conditions of the
+** license as they are applied to this software. View the full text of
+** the exceptions in file COPYING.txt in the directory of this software
+** distribution
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with Antares_Simulator. If not, see <http://www.gnu.org/licenses/>.
+**
+** SPDX-License-Identifier: licenceRef-GPL3_WITH_RTE-Exceptions
+*/
+
+#include <antares/logs.h>
+#include <yuni/core/getopt.h>
+#include <yuni/io/file.h>
+#include <yuni/io/directory/info.h>
+#include "../../ui/common/winmain.hxx"
+#include <antares/version.h>
+#include <antares/sys/policy.h>
+#include <antares/locale.h>
+#include <antares/io/file.h>
+#include <antares/io/survey-binary.h>
+
+using namespace Yuni;
+using namespace Antares;
+
+
+
+/*!
+** \brief Convert a binary survey file into a text file, next to it
+*/
+static bool ConvertFile(const String& filename, bool removeBinary, Clob& buffer)
+{
+	if (not SurveyBinary::ConvertToText(filename, buffer))
+		return false;
+
+	String target = filename;
+	target.chop((uint) strlen(SurveyBinary::extension));
+	target << ".txt";
+
+	if (not IOFileSetContent(target, buffer))
+	{
+		logs.error() << "impossible to write " << target;
+		return false;
+	}
+	if (removeBinary)
+		IO::File::Delete(filename);
+	return true;
+}
+
+
+
+
+
+int main(int argc, char* argv[])
+{
+	// locale
+	InitializeDefaultLocale();
+
+	Antares::logs.applicationName("results-converter");
+	argv = AntaresGetUTF8Arguments(argc, argv);
+
+	String::Vector optInput;
+	bool optRemove = false;
+
+	// Command Line options
+	{
+		// Parser
+		GetOpt::Parser options;
+		//
+		options.addParagraph(String()
+			<< "Antares Results Converter v" << VersionToCString() << "\n"
+			<< "Convert the binary results of a simulation (*.bin) into text files\n");
+		// Input
+		options.remainingArguments(optInput);
+		// Output
+		options.add(optInput, 'i', "input", "An output folder or a binary file to convert");
+		// Cleanup
+		options.addFlag(optRemove, ' ', "remove", "Remove the binary files once converted");
+
+		// Version
+		bool optVersion = false;
+		options.addFlag(optVersion, 'v', "version", "Print the version and exit");
+
+		if (!options(argc, argv))
+			return options.errors() ? 1 : 0;
+
+		if (optVersion)
+		{
+			PrintVersionToStdCout();
+			return 0;
+		}
+	}
+
+	// Load the local policy settings
+	LocalPolicy::Open();
+	LocalPolicy::CheckRootPrefix(argv[0]);
+
+	uint converted = 0;
+	uint failed = 0;
+	Clob buffer;
+
+	for (uint i = 0; i != optInput.size(); ++i)
+	{
+		const String& path = optInput[i];
+		if (IO::File::Exists(path))
+		{
+			if (ConvertFile(path, optRemove, buffer))
+				++converted;
+			else
+				++failed;
+			continue;
+		}
+		if (not IO::Directory::Exists(path))
+		{
+			logs.error() << "not found: " << path;
+			++failed;
+			continue;
+		}
+
+		// All binary files within the folder
+		String::Vector files;
+		IO::Directory::Info info(path);
+		auto end = info.recursive_file_end();
+		for (auto it = info.recursive_file_begin(); it != end; ++it)
+		{
+			if (it.filename().endsWith(SurveyBinary::extension))
+				files.push_back(it.filename());
+		}
+
+		for (uint f = 0; f != files.size(); ++f)
+		{
+			if (ConvertFile(files[f], optRemove, buffer))
+				++converted;
+			else
+				++failed;
+		}
+	}
+
+	logs.info() << converted << " file(s) converted";
+	if (failed)
+		logs.error() << failed << " file(s) could not be converted";
+
+	LocalPolicy::Close();
+	return (failed) ? 1 : 0;
+}
@@ -877,10 +877,6 @@ namespace Simulation
 		// cleanup
 		pMappingSolverMode.clear();
 
-		// Simulation mode is adequacy-draft mode ?
-		auto& study = *Data::Study::Current::Get();
-		bool draftMode = study.parameters.adequacyDraft();
-
 		for (uint i = 0; i != featuresCount; ++i)
 		{
 			wxMenuItem* it = Menu::CreateItem(&menu, wxID_ANY, featuresNames[i],
@@ -890,10 +886,6 @@ namespace Simulation
 			pMappingSolverMode[it->GetId()] = i;
 			menu.Connect(it->GetId(), wxEVT_COMMAND_MENU_SELECTED,
 				wxCommandEventHandler(Run::onSelectMode), nullptr, this);
-
-			// In case of adequacy-draft mode, parallel mode is disabled
-			if (i == Solver::parallel && draftMode)
-				it->Enable(false);
 		}
 	}
 